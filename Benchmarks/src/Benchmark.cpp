@@ -0,0 +1,201 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "Benchmark.h"
+#include <RmlUi/Core/Core.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+Benchmark::Benchmark(const Rml::Core::String& name, const Rml::Core::String& description, int default_iterations) : name(name), description(description), default_iterations(default_iterations)
+{
+}
+
+Benchmark::~Benchmark()
+{
+}
+
+const Rml::Core::String& Benchmark::GetName() const
+{
+	return name;
+}
+
+const Rml::Core::String& Benchmark::GetDescription() const
+{
+	return description;
+}
+
+int Benchmark::GetDefaultIterations() const
+{
+	return default_iterations;
+}
+
+void Benchmark::Teardown(BenchmarkEnvironment& /*environment*/)
+{
+}
+
+bool Benchmark::Verify(const BenchmarkResult& /*result*/) const
+{
+	return true;
+}
+
+bool RunBenchmark(Benchmark& benchmark, BenchmarkEnvironment& environment, int iterations, int warmup_iterations, BenchmarkResult& result)
+{
+	using Clock = std::chrono::steady_clock;
+
+	if (iterations <= 0)
+		iterations = benchmark.GetDefaultIterations();
+
+	result = BenchmarkResult();
+	result.name = benchmark.GetName();
+
+	if (!benchmark.Setup(environment))
+	{
+		benchmark.Teardown(environment);
+		return false;
+	}
+
+	for (int i = 0; i < warmup_iterations; i++)
+		benchmark.Run(environment);
+
+	std::vector< double > times;
+	times.reserve(iterations);
+
+	environment.render_interface->ResetCounters();
+
+	for (int i = 0; i < iterations; i++)
+	{
+		const Clock::time_point start = Clock::now();
+		benchmark.Run(environment);
+		const Clock::time_point end = Clock::now();
+
+		times.push_back(std::chrono::duration< double, std::milli >(end - start).count());
+	}
+
+	result.counters = environment.render_interface->GetCounters();
+
+	benchmark.Teardown(environment);
+
+	// Remove the documents closed during teardown, so they don't affect the next benchmark.
+	environment.context->Update();
+
+	result.iterations = iterations;
+
+	if (!times.empty())
+	{
+		double sum = 0;
+		for (double time : times)
+			sum += time;
+		result.mean = sum / double(times.size());
+
+		double sum_squared_deviations = 0;
+		for (double time : times)
+			sum_squared_deviations += (time - result.mean) * (time - result.mean);
+		result.stddev = std::sqrt(sum_squared_deviations / double(times.size()));
+
+		std::sort(times.begin(), times.end());
+		result.min = times.front();
+		result.max = times.back();
+		const size_t middle = times.size() / 2;
+		result.median = (times.size() % 2 == 0 ? 0.5 * (times[middle - 1] + times[middle]) : times[middle]);
+	}
+
+	return true;
+}
+
+// The render counters, averaged per iteration.
+static void GetCountersPerIteration(const BenchmarkResult& result, double& render_calls, double& compiled_render_calls, double& vertices, double& indices, double& compile_calls, double& scissor_calls, double& texture_uploads, double& transform_calls)
+{
+	const double scale = (result.iterations > 0 ? 1.0 / double(result.iterations) : 0.0);
+	render_calls = result.counters.render_calls * scale;
+	compiled_render_calls = result.counters.compiled_render_calls * scale;
+	vertices = result.counters.vertices * scale;
+	indices = result.counters.indices * scale;
+	compile_calls = result.counters.compile_calls * scale;
+	scissor_calls = result.counters.scissor_calls * scale;
+	texture_uploads = result.counters.texture_uploads * scale;
+	transform_calls = result.counters.transform_calls * scale;
+}
+
+void WriteResults(FILE* file, const std::vector< BenchmarkResult >& results, ResultFormat format)
+{
+	double render_calls, compiled_render_calls, vertices, indices, compile_calls, scissor_calls, texture_uploads, transform_calls;
+
+	switch (format)
+	{
+	case ResultFormat::Json:
+	{
+		fprintf(file, "{\n\t\"version\": \"%s\",\n\t\"unit\": \"ms\",\n\t\"benchmarks\": [", Rml::Core::GetVersion().c_str());
+
+		for (size_t i = 0; i < results.size(); i++)
+		{
+			const BenchmarkResult& result = results[i];
+			GetCountersPerIteration(result, render_calls, compiled_render_calls, vertices, indices, compile_calls, scissor_calls, texture_uploads, transform_calls);
+
+			fprintf(file, "%s\n\t\t{\n", i == 0 ? "" : ",");
+			fprintf(file, "\t\t\t\"name\": \"%s\",\n", result.name.c_str());
+			fprintf(file, "\t\t\t\"iterations\": %d,\n", result.iterations);
+			fprintf(file, "\t\t\t\"mean\": %.6f,\n\t\t\t\"median\": %.6f,\n\t\t\t\"min\": %.6f,\n\t\t\t\"max\": %.6f,\n\t\t\t\"stddev\": %.6f,\n", result.mean, result.median, result.min, result.max, result.stddev);
+			fprintf(file, "\t\t\t\"per_iteration\": {\n");
+			fprintf(file, "\t\t\t\t\"render_calls\": %.1f,\n\t\t\t\t\"compiled_render_calls\": %.1f,\n\t\t\t\t\"vertices\": %.1f,\n\t\t\t\t\"indices\": %.1f,\n", render_calls, compiled_render_calls, vertices, indices);
+			fprintf(file, "\t\t\t\t\"compile_calls\": %.1f,\n\t\t\t\t\"scissor_calls\": %.1f,\n\t\t\t\t\"texture_uploads\": %.1f,\n\t\t\t\t\"transform_calls\": %.1f\n", compile_calls, scissor_calls, texture_uploads, transform_calls);
+			fprintf(file, "\t\t\t}\n\t\t}");
+		}
+
+		fprintf(file, "\n\t]\n}\n");
+	}
+	break;
+	case ResultFormat::Csv:
+	{
+		fprintf(file, "name,iterations,mean_ms,median_ms,min_ms,max_ms,stddev_ms,render_calls,compiled_render_calls,vertices,indices,compile_calls,scissor_calls,texture_uploads,transform_calls\n");
+
+		for (const BenchmarkResult& result : results)
+		{
+			GetCountersPerIteration(result, render_calls, compiled_render_calls, vertices, indices, compile_calls, scissor_calls, texture_uploads, transform_calls);
+
+			fprintf(file, "%s,%d,%.6f,%.6f,%.6f,%.6f,%.6f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f\n", result.name.c_str(), result.iterations,
+				result.mean, result.median, result.min, result.max, result.stddev,
+				render_calls, compiled_render_calls, vertices, indices, compile_calls, scissor_calls, texture_uploads, transform_calls);
+		}
+	}
+	break;
+	case ResultFormat::Text:
+	{
+		fprintf(file, "%-24s %10s %10s %10s %10s %10s %10s %10s\n", "Benchmark", "Iterations", "Mean ms", "Median ms", "Min ms", "Max ms", "Draw calls", "Vertices");
+
+		for (const BenchmarkResult& result : results)
+		{
+			GetCountersPerIteration(result, render_calls, compiled_render_calls, vertices, indices, compile_calls, scissor_calls, texture_uploads, transform_calls);
+
+			fprintf(file, "%-24s %10d %10.3f %10.3f %10.3f %10.3f %10.1f %10.1f\n", result.name.c_str(), result.iterations,
+				result.mean, result.median, result.min, result.max, render_calls + compiled_render_calls, vertices);
+		}
+	}
+	break;
+	}
+}
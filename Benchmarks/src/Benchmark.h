@@ -0,0 +1,117 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_BENCHMARKS_BENCHMARK_H
+#define RMLUI_BENCHMARKS_BENCHMARK_H
+
+#include "BenchmarkInterfaces.h"
+#include <RmlUi/Core/Context.h>
+#include <cstdio>
+#include <vector>
+
+struct BenchmarkResult;
+
+/**
+	The state shared by all benchmarks: the context they run in, the interfaces installed into RmlUi, and the directory
+	the fonts were loaded from.
+ */
+
+struct BenchmarkEnvironment
+{
+	Rml::Core::Context* context = nullptr;
+	NullRenderInterface* render_interface = nullptr;
+	BenchmarkSystemInterface* system_interface = nullptr;
+	Rml::Core::String assets_directory;
+};
+
+/**
+	Base class for all benchmarks. Setup is called once before the iterations are run, followed by a number of
+	untimed warm-up iterations and then the timed iterations. Each iteration should do the same amount of work.
+ */
+
+class Benchmark
+{
+public:
+	Benchmark(const Rml::Core::String& name, const Rml::Core::String& description, int default_iterations);
+	virtual ~Benchmark();
+
+	const Rml::Core::String& GetName() const;
+	const Rml::Core::String& GetDescription() const;
+	int GetDefaultIterations() const;
+
+	/// Prepares the benchmark, called once before any iterations are run.
+	/// @return True if the benchmark can be run.
+	virtual bool Setup(BenchmarkEnvironment& environment) = 0;
+	/// Runs a single iteration of the benchmark.
+	virtual void Run(BenchmarkEnvironment& environment) = 0;
+	/// Releases anything created during setup.
+	virtual void Teardown(BenchmarkEnvironment& environment);
+	/// Checks the render counters of the timed iterations against what the benchmark expects, any failures are printed.
+	/// @return True if the expectations were met.
+	virtual bool Verify(const BenchmarkResult& result) const;
+
+private:
+	Rml::Core::String name;
+	Rml::Core::String description;
+	int default_iterations;
+};
+
+/**
+	The timings of a benchmark, in milliseconds per iteration, along with the render counters summed over all timed
+	iterations.
+ */
+
+struct BenchmarkResult
+{
+	Rml::Core::String name;
+	int iterations = 0;
+
+	double mean = 0;
+	double median = 0;
+	double min = 0;
+	double max = 0;
+	double stddev = 0;
+
+	RenderCounters counters;
+};
+
+enum class ResultFormat { Text, Json, Csv };
+
+/// Runs a benchmark and measures the time of each iteration.
+/// @param[in] benchmark The benchmark to run.
+/// @param[in] environment The environment to run the benchmark in.
+/// @param[in] iterations The number of timed iterations, or zero to use the benchmark's default.
+/// @param[in] warmup_iterations The number of untimed iterations run before the timed ones.
+/// @param[out] result The measured result.
+/// @return True if the benchmark was run, false if its setup failed.
+bool RunBenchmark(Benchmark& benchmark, BenchmarkEnvironment& environment, int iterations, int warmup_iterations, BenchmarkResult& result);
+
+/// Writes the results of all benchmarks in the given format.
+void WriteResults(FILE* file, const std::vector< BenchmarkResult >& results, ResultFormat format);
+
+#endif
@@ -0,0 +1,162 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "BenchmarkInterfaces.h"
+#include <RmlUi/Core/Log.h>
+#include <cstdio>
+
+NullRenderInterface::NullRenderInterface() : last_geometry_handle(0), last_texture_handle(0)
+{
+}
+
+void NullRenderInterface::RenderGeometry(Rml::Core::Vertex* /*vertices*/, int num_vertices, int* /*indices*/, int num_indices, Rml::Core::TextureHandle texture, const Rml::Core::Vector2f& /*translation*/)
+{
+	counters.render_calls += 1;
+	counters.vertices += num_vertices;
+	counters.indices += num_indices;
+
+	if (texture && render_textures.find(texture) != render_textures.end())
+		counters.render_texture_draws += 1;
+}
+
+Rml::Core::CompiledGeometryHandle NullRenderInterface::CompileGeometry(Rml::Core::Vertex* /*vertices*/, int num_vertices, int* /*indices*/, int num_indices, Rml::Core::TextureHandle /*texture*/)
+{
+	counters.compile_calls += 1;
+	counters.vertices += num_vertices;
+
+	Rml::Core::CompiledGeometryHandle handle = ++last_geometry_handle;
+	compiled_geometry[handle] = num_indices;
+	return handle;
+}
+
+void NullRenderInterface::RenderCompiledGeometry(Rml::Core::CompiledGeometryHandle geometry, const Rml::Core::Vector2f& /*translation*/)
+{
+	counters.compiled_render_calls += 1;
+
+	auto it = compiled_geometry.find(geometry);
+	if (it != compiled_geometry.end())
+		counters.indices += it->second;
+}
+
+void NullRenderInterface::ReleaseCompiledGeometry(Rml::Core::CompiledGeometryHandle geometry)
+{
+	compiled_geometry.erase(geometry);
+}
+
+void NullRenderInterface::EnableScissorRegion(bool /*enable*/)
+{
+	counters.scissor_calls += 1;
+}
+
+void NullRenderInterface::SetScissorRegion(int /*x*/, int /*y*/, int /*width*/, int /*height*/)
+{
+	counters.scissor_calls += 1;
+}
+
+// Pretends to load any texture, with a fixed size.
+bool NullRenderInterface::LoadTexture(Rml::Core::TextureHandle& texture_handle, Rml::Core::Vector2i& texture_dimensions, const Rml::Core::String& /*source*/)
+{
+	counters.texture_uploads += 1;
+	texture_handle = ++last_texture_handle;
+	texture_dimensions = Rml::Core::Vector2i(64, 64);
+	return true;
+}
+
+bool NullRenderInterface::GenerateTexture(Rml::Core::TextureHandle& texture_handle, const Rml::Core::byte* /*source*/, const Rml::Core::Vector2i& /*source_dimensions*/)
+{
+	counters.texture_uploads += 1;
+	texture_handle = ++last_texture_handle;
+	return true;
+}
+
+void NullRenderInterface::ReleaseTexture(Rml::Core::TextureHandle texture)
+{
+	render_textures.erase(texture);
+}
+
+void NullRenderInterface::SetTransform(const Rml::Core::Matrix4f* /*transform*/)
+{
+	counters.transform_calls += 1;
+}
+
+bool NullRenderInterface::GenerateRenderTexture(Rml::Core::TextureHandle& texture_handle, const Rml::Core::Vector2i& /*dimensions*/)
+{
+	texture_handle = ++last_texture_handle;
+	render_textures.insert(texture_handle);
+	return true;
+}
+
+void NullRenderInterface::PushRenderTexture(Rml::Core::TextureHandle /*texture_handle*/, const Rml::Core::Vector2i& /*origin*/)
+{
+	counters.render_texture_captures += 1;
+}
+
+void NullRenderInterface::PopRenderTexture()
+{
+}
+
+const RenderCounters& NullRenderInterface::GetCounters() const
+{
+	return counters;
+}
+
+void NullRenderInterface::ResetCounters()
+{
+	counters = RenderCounters();
+}
+
+
+BenchmarkSystemInterface::BenchmarkSystemInterface() : elapsed_time(0.0), num_errors(0)
+{
+}
+
+double BenchmarkSystemInterface::GetElapsedTime()
+{
+	return elapsed_time;
+}
+
+bool BenchmarkSystemInterface::LogMessage(Rml::Core::Log::Type type, const Rml::Core::String& message)
+{
+	if (type == Rml::Core::Log::LT_ERROR || type == Rml::Core::Log::LT_ASSERT || type == Rml::Core::Log::LT_WARNING)
+	{
+		num_errors += 1;
+		fprintf(stderr, "%s\n", message.c_str());
+	}
+
+	return true;
+}
+
+void BenchmarkSystemInterface::AdvanceTime(double seconds)
+{
+	elapsed_time += seconds;
+}
+
+int BenchmarkSystemInterface::GetNumErrors() const
+{
+	return num_errors;
+}
@@ -0,0 +1,125 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_BENCHMARKS_BENCHMARKINTERFACES_H
+#define RMLUI_BENCHMARKS_BENCHMARKINTERFACES_H
+
+#include <RmlUi/Core/RenderInterface.h>
+#include <RmlUi/Core/SystemInterface.h>
+
+/**
+	Counters of the calls made to the null render interface.
+ */
+
+struct RenderCounters
+{
+	int render_calls = 0;
+	int compiled_render_calls = 0;
+	int vertices = 0;
+	int indices = 0;
+	int compile_calls = 0;
+	int scissor_calls = 0;
+	int texture_uploads = 0;
+	int transform_calls = 0;
+	int render_texture_captures = 0;
+	int render_texture_draws = 0;
+};
+
+/**
+	A render interface which renders nothing, it only counts the calls made to it. Geometry compilation and textures
+	are supported, so that the library takes the same paths it does with a real renderer.
+ */
+
+class NullRenderInterface : public Rml::Core::RenderInterface
+{
+public:
+	NullRenderInterface();
+
+	void RenderGeometry(Rml::Core::Vertex* vertices, int num_vertices, int* indices, int num_indices, Rml::Core::TextureHandle texture, const Rml::Core::Vector2f& translation) override;
+
+	Rml::Core::CompiledGeometryHandle CompileGeometry(Rml::Core::Vertex* vertices, int num_vertices, int* indices, int num_indices, Rml::Core::TextureHandle texture) override;
+	void RenderCompiledGeometry(Rml::Core::CompiledGeometryHandle geometry, const Rml::Core::Vector2f& translation) override;
+	void ReleaseCompiledGeometry(Rml::Core::CompiledGeometryHandle geometry) override;
+
+	void EnableScissorRegion(bool enable) override;
+	void SetScissorRegion(int x, int y, int width, int height) override;
+
+	bool LoadTexture(Rml::Core::TextureHandle& texture_handle, Rml::Core::Vector2i& texture_dimensions, const Rml::Core::String& source) override;
+	bool GenerateTexture(Rml::Core::TextureHandle& texture_handle, const Rml::Core::byte* source, const Rml::Core::Vector2i& source_dimensions) override;
+	void ReleaseTexture(Rml::Core::TextureHandle texture) override;
+
+	void SetTransform(const Rml::Core::Matrix4f* transform) override;
+
+	bool GenerateRenderTexture(Rml::Core::TextureHandle& texture_handle, const Rml::Core::Vector2i& dimensions) override;
+	void PushRenderTexture(Rml::Core::TextureHandle texture_handle, const Rml::Core::Vector2i& origin) override;
+	void PopRenderTexture() override;
+
+	/// Returns the counters accumulated since the last reset.
+	const RenderCounters& GetCounters() const;
+	/// Resets all counters to zero.
+	void ResetCounters();
+
+private:
+	RenderCounters counters;
+
+	// The last handle returned for compiled geometry and textures.
+	Rml::Core::CompiledGeometryHandle last_geometry_handle;
+	Rml::Core::TextureHandle last_texture_handle;
+
+	// The number of indices of each compiled geometry, by handle.
+	Rml::Core::UnorderedMap< Rml::Core::CompiledGeometryHandle, int > compiled_geometry;
+	// The textures generated to be rendered into.
+	Rml::Core::UnorderedSet< Rml::Core::TextureHandle > render_textures;
+};
+
+/**
+	A system interface with a simulated clock, so that animations advance by exactly the same amount in every run.
+	Log messages are counted, and only errors and warnings are printed.
+ */
+
+class BenchmarkSystemInterface : public Rml::Core::SystemInterface
+{
+public:
+	BenchmarkSystemInterface();
+
+	double GetElapsedTime() override;
+	bool LogMessage(Rml::Core::Log::Type type, const Rml::Core::String& message) override;
+
+	/// Advances the simulated clock.
+	/// @param[in] seconds The time to advance the clock by.
+	void AdvanceTime(double seconds);
+
+	/// Returns the number of errors and warnings logged.
+	int GetNumErrors() const;
+
+private:
+	double elapsed_time;
+	int num_errors;
+};
+
+#endif
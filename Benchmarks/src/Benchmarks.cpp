@@ -0,0 +1,1266 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "Benchmarks.h"
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/EventListener.h>
+#include <RmlUi/Core/FileInterface.h>
+#include <RmlUi/Core/FontEngineInterface.h>
+#include <RmlUi/Core/Geometry.h>
+#include <RmlUi/Core/StringUtilities.h>
+#include <RmlUi/Controls/DataSource.h>
+#include <RmlUi/Controls/ElementFormControlDataSelect.h>
+#include <chrono>
+#include <thread>
+
+using Rml::Core::String;
+using Rml::Core::CreateString;
+
+// The style sheet shared by all benchmark documents.
+static const char* benchmark_rcss = R"(
+body { display: block; width: 1000px; height: 700px; font-family: Delicious; font-size: 14px; color: #222; }
+div, p, h1 { display: block; }
+h1 { font-size: 20px; font-weight: bold; margin: 4px 0; }
+p { margin: 2px 0; }
+em { font-style: italic; }
+strong { font-weight: bold; }
+.row { height: 20px; padding: 2px; border-bottom: 1px #ccc; background-color: #eee; }
+.row:hover { background-color: #ccf; }
+.col { display: inline-block; width: 120px; }
+.col.wide { width: 300px; }
+.alt .row { background-color: #ddd; color: #226; border-bottom-color: #aaa; }
+.alt .row .col.wide { color: #622; }
+.dark { color: #ddd; }
+.cell { float: left; width: 23px; height: 23px; margin: 1px; background-color: #ccc; }
+.cell:hover { background-color: #f80; }
+.log { height: 600px; overflow: auto; }
+.entry { padding: 2px; border-bottom: 1px #ccc; }
+.entry .author { display: inline; color: #226; }
+@keyframes pulse {
+	from { opacity: 0.3; left: 0px; transform: rotate(0deg); }
+	to { opacity: 1.0; left: 40px; transform: rotate(30deg); }
+}
+.animated { position: relative; width: 40px; height: 10px; margin: 1px; background-color: #48c; animation: 1.3s cubic-in-out infinite alternate pulse; }
+@keyframes spin {
+	from { transform: rotate(0deg); }
+	to { transform: rotate(360deg); }
+}
+.spin-group { height: 60px; margin: 4px; transform: rotate(3deg); perspective: 800px; }
+.spin { float: left; width: 12px; height: 12px; margin: 1px; background-color: #8c4; animation: 2s linear infinite spin; }
+.spin .tilt { width: 6px; height: 6px; background-color: #c48; transform: rotate(15deg) scale(0.8); }
+)";
+
+static const char* lorem_ipsum = "Lorem ipsum dolor sit amet, <em>consectetur</em> adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua. "
+	"Ut enim ad minim veniam, quis <strong>nostrud exercitation</strong> ullamco laboris nisi ut aliquip ex ea commodo consequat. "
+	"Duis aute irure dolor in reprehenderit in voluptate velit esse cillum dolore eu fugiat nulla pariatur.";
+
+// Returns a complete document with the benchmark style sheet and the given body contents.
+static String CreateDocumentRml(const String& body)
+{
+	return "<rml><head><style>" + String(benchmark_rcss) + "</style></head><body>" + body + "</body></rml>";
+}
+
+// Returns a number of table-like rows, the seed varies their contents.
+static String CreateRowsRml(int num_rows, int seed)
+{
+	String rml;
+	for (int i = 0; i < num_rows; i++)
+	{
+		const int value = (i * 7919 + seed * 104729) % 1000;
+		rml += CreateString(512,
+			"<div class=\"row\" id=\"row%d\">"
+			"<div class=\"col\">Route %d</div>"
+			"<div class=\"col wide\">Assigned to <em>vehicle %d</em></div>"
+			"<div class=\"col\" id=\"value%d\">%d</div>"
+			"<div class=\"col\"><strong>%d%%</strong></div>"
+			"</div>",
+			i, i + seed, value, i, value * 3, value % 100
+		);
+	}
+	return rml;
+}
+
+// Returns a number of text paragraphs.
+static String CreateTextRml(int num_paragraphs)
+{
+	String rml;
+	for (int i = 0; i < num_paragraphs; i++)
+	{
+		if (i % 10 == 0)
+			rml += CreateString(64, "<h1>Section %d</h1>", i / 10 + 1);
+		rml += "<p>" + String(lorem_ipsum) + "</p>";
+	}
+	return rml;
+}
+
+/**
+	Base class for benchmarks operating on a single document loaded during setup.
+ */
+
+class DocumentBenchmark : public Benchmark
+{
+public:
+	DocumentBenchmark(const String& name, const String& description, int default_iterations) : Benchmark(name, description, default_iterations), document(nullptr) {}
+
+	bool Setup(BenchmarkEnvironment& environment) override
+	{
+		document = environment.context->LoadDocumentFromMemory(CreateDocumentRml(CreateBody()));
+		if (!document)
+			return false;
+
+		document->Show();
+		environment.context->Update();
+		environment.context->Render();
+
+		return true;
+	}
+
+	void Teardown(BenchmarkEnvironment& /*environment*/) override
+	{
+		if (document)
+			document->Close();
+		document = nullptr;
+	}
+
+protected:
+	// Returns the body contents of the document.
+	virtual String CreateBody() = 0;
+
+	Rml::Core::ElementDocument* document;
+};
+
+/**
+	Loads, shows, lays out and closes a document with a large number of rows.
+ */
+
+class BenchmarkDocumentLoad : public Benchmark
+{
+public:
+	BenchmarkDocumentLoad() : Benchmark("document_load", "Load, lay out and close a document with 250 rows.", 20) {}
+
+	bool Setup(BenchmarkEnvironment& /*environment*/) override
+	{
+		rml = CreateDocumentRml(CreateRowsRml(250, 0));
+		return true;
+	}
+
+	void Run(BenchmarkEnvironment& environment) override
+	{
+		Rml::Core::ElementDocument* document = environment.context->LoadDocumentFromMemory(rml);
+		if (!document)
+			return;
+
+		document->Show();
+		environment.context->Update();
+		document->Close();
+		environment.context->Update();
+	}
+
+private:
+	String rml;
+};
+
+/**
+	Loads a document incrementally with the smallest load budget, updating the context until the load finishes, and checks
+	that the result matches a document loaded all at once.
+ */
+
+class BenchmarkDocumentLoadIncremental : public Benchmark
+{
+public:
+	BenchmarkDocumentLoadIncremental() : Benchmark("document_load_incremental", "Load a document with 50 rows incrementally, one tag per update.", 20), previous_budget(0), num_failures(0) {}
+
+	bool Setup(BenchmarkEnvironment& environment) override
+	{
+		rml = CreateDocumentRml(CreateRowsRml(50, 0));
+
+		Rml::Core::ElementDocument* document = environment.context->LoadDocumentFromMemory(rml);
+		if (!document)
+			return false;
+
+		expected_rml = document->GetInnerRML();
+		document->Close();
+		environment.context->Update();
+
+		previous_budget = environment.context->GetDocumentLoadBudget();
+		environment.context->SetDocumentLoadBudget(0);
+		num_failures = 0;
+
+		return true;
+	}
+
+	bool Verify(const BenchmarkResult& /*result*/) const override
+	{
+		if (num_failures > 0)
+		{
+			fprintf(stderr, "Expected each incremental load to take multiple updates and match the synchronous load, %d loads did not.\n", num_failures);
+			return false;
+		}
+		return true;
+	}
+
+	void Run(BenchmarkEnvironment& environment) override
+	{
+		Rml::Core::ElementDocument* document = environment.context->LoadDocumentFromMemoryIncremental(rml);
+		if (!document)
+		{
+			num_failures++;
+			return;
+		}
+
+		int num_updates = 0;
+		for (; num_updates < 100000 && environment.context->IsDocumentLoading(document); num_updates++)
+			environment.context->Update();
+
+		if (num_updates <= 1 || environment.context->IsDocumentLoading(document) || document->GetInnerRML() != expected_rml)
+			num_failures++;
+
+		document->Close();
+		environment.context->Update();
+	}
+
+	void Teardown(BenchmarkEnvironment& environment) override
+	{
+		environment.context->SetDocumentLoadBudget(previous_budget);
+	}
+
+private:
+	String rml;
+	String expected_rml;
+	float previous_budget;
+	int num_failures;
+};
+
+/**
+	Replaces a large set of rows using SetInnerRML, as a data-driven table would.
+ */
+
+class BenchmarkSetInnerRml : public DocumentBenchmark
+{
+public:
+	BenchmarkSetInnerRml() : DocumentBenchmark("set_inner_rml", "Replace 200 rows with SetInnerRML, then update.", 30), container(nullptr), iteration(0) {}
+
+	bool Setup(BenchmarkEnvironment& environment) override
+	{
+		if (!DocumentBenchmark::Setup(environment))
+			return false;
+
+		container = document->GetElementById("rows");
+
+		// Generate the contents up front, only the library work should be measured.
+		for (int i = 0; i < 4; i++)
+			rows_rml[i] = CreateRowsRml(200, i);
+
+		return container != nullptr;
+	}
+
+	void Run(BenchmarkEnvironment& environment) override
+	{
+		container->SetInnerRML(rows_rml[iteration++ % 4]);
+		environment.context->Update();
+	}
+
+protected:
+	String CreateBody() override
+	{
+		return "<div id=\"rows\"/>";
+	}
+
+private:
+	Rml::Core::Element* container;
+	String rows_rml[4];
+	int iteration;
+};
+
+/**
+	Toggles a class on the body, causing style recalculation of every row.
+ */
+
+class BenchmarkStyleClassToggle : public DocumentBenchmark
+{
+public:
+	BenchmarkStyleClassToggle() : DocumentBenchmark("style_class_toggle", "Toggle a class on the body of 500 rows, then update.", 50), enabled(false) {}
+
+	void Run(BenchmarkEnvironment& environment) override
+	{
+		enabled = !enabled;
+		document->SetClass("alt", enabled);
+		environment.context->Update();
+	}
+
+protected:
+	String CreateBody() override
+	{
+		return CreateRowsRml(500, 0);
+	}
+
+private:
+	bool enabled;
+};
+
+/**
+	Changes the width of the body, forcing the layout of the whole document.
+ */
+
+class BenchmarkLayoutFull : public DocumentBenchmark
+{
+public:
+	BenchmarkLayoutFull() : DocumentBenchmark("layout_full", "Resize the body of 300 rows and 30 paragraphs, then update.", 50), wide(false) {}
+
+	void Run(BenchmarkEnvironment& environment) override
+	{
+		wide = !wide;
+		document->SetProperty(Rml::Core::PropertyId::Width, Rml::Core::Property(wide ? 1001.f : 1000.f, Rml::Core::Property::PX));
+		environment.context->Update();
+	}
+
+protected:
+	String CreateBody() override
+	{
+		return CreateRowsRml(300, 0) + CreateTextRml(30);
+	}
+
+private:
+	bool wide;
+};
+
+/**
+	Changes the text of a single cell in a large document.
+ */
+
+class BenchmarkLayoutPartial : public DocumentBenchmark
+{
+public:
+	BenchmarkLayoutPartial() : DocumentBenchmark("layout_partial", "Change the text of a single cell among 300 rows, then update.", 100), iteration(0) {}
+
+	bool Setup(BenchmarkEnvironment& environment) override
+	{
+		if (!DocumentBenchmark::Setup(environment))
+			return false;
+
+		for (int i = 0; i < 300; i++)
+		{
+			if (Rml::Core::Element* element = document->GetElementById(CreateString(32, "value%d", i)))
+				cells.push_back(element);
+		}
+
+		return !cells.empty();
+	}
+
+	void Run(BenchmarkEnvironment& environment) override
+	{
+		Rml::Core::Element* cell = cells[(iteration * 37) % cells.size()];
+		cell->SetInnerRML(CreateString(32, "%d", iteration));
+		iteration++;
+
+		environment.context->Update();
+	}
+
+	void Teardown(BenchmarkEnvironment& environment) override
+	{
+		cells.clear();
+		DocumentBenchmark::Teardown(environment);
+	}
+
+protected:
+	String CreateBody() override
+	{
+		return CreateRowsRml(300, 0);
+	}
+
+private:
+	std::vector< Rml::Core::Element* > cells;
+	int iteration;
+};
+
+/**
+	Renders a text-heavy document, where all geometry is already generated.
+ */
+
+class BenchmarkRenderText : public DocumentBenchmark
+{
+public:
+	BenchmarkRenderText() : DocumentBenchmark("render_text", "Render 100 paragraphs of generated text.", 200) {}
+
+	void Run(BenchmarkEnvironment& environment) override
+	{
+		environment.context->Render();
+	}
+
+protected:
+	String CreateBody() override
+	{
+		return CreateTextRml(100);
+	}
+};
+
+/**
+	Measures the width of words directly through the font engine, as done while laying out text.
+ */
+
+class BenchmarkTextMeasure : public Benchmark
+{
+public:
+	BenchmarkTextMeasure() : Benchmark("text_measure", "Measure the width of 10000 words through the font engine.", 200), font_face_handle(0) {}
+
+	bool Setup(BenchmarkEnvironment& /*environment*/) override
+	{
+		font_face_handle = Rml::Core::GetFontEngineInterface()->GetFontFaceHandle("delicious", Rml::Core::Style::FontStyle::Normal, Rml::Core::Style::FontWeight::Normal, 14);
+		if (!font_face_handle)
+			return false;
+
+		// Mostly ASCII words, with some accented and non-Latin words mixed in.
+		String text = String(lorem_ipsum) + " Fj\xc3\xb6rd na\xc3\xafve caf\xc3\xa9 \xce\xb1\xce\xb2\xce\xb3 M\xc3\xbcller";
+		Rml::Core::StringUtilities::ExpandString(words, text, ' ');
+
+		// The non-ASCII glyphs would otherwise be measured as placeholders while they are rasterized in the background.
+		Rml::Core::GetFontEngineInterface()->PrewarmGlyphs(font_face_handle, 0, text, nullptr);
+
+		return !words.empty();
+	}
+
+	void Run(BenchmarkEnvironment& /*environment*/) override
+	{
+		Rml::Core::FontEngineInterface* font_engine_interface = Rml::Core::GetFontEngineInterface();
+
+		int width = 0;
+		for (int i = 0; i < 10000; i++)
+			width += font_engine_interface->GetStringWidth(font_face_handle, words[i % words.size()]);
+
+		total_width = width;
+	}
+
+private:
+	Rml::Core::FontFaceHandle font_face_handle;
+	Rml::Core::StringList words;
+	volatile int total_width = 0;
+};
+
+/**
+	Changes the colour of a text-heavy document, regenerating all its text geometry.
+ */
+
+class BenchmarkRegenerateText : public DocumentBenchmark
+{
+public:
+	BenchmarkRegenerateText() : DocumentBenchmark("regenerate_text", "Recolour 100 paragraphs of text, then update and render.", 50), dark(false) {}
+
+	void Run(BenchmarkEnvironment& environment) override
+	{
+		dark = !dark;
+		document->SetClass("dark", dark);
+		environment.context->Update();
+		environment.context->Render();
+	}
+
+protected:
+	String CreateBody() override
+	{
+		return CreateTextRml(100);
+	}
+
+private:
+	bool dark;
+};
+
+/**
+	Lays out the same text again at different widths. When the font engine shapes text, the shaped runs of the text
+	should be reused from its cache, while new text is shaped once.
+ */
+
+class BenchmarkTextShaping : public DocumentBenchmark
+{
+public:
+	BenchmarkTextShaping() : DocumentBenchmark("text_shaping", "Resize the body of 30 paragraphs, laying out their text again, then update and render.", 50), wide(false), shaping(false), cache_failure(false), runs_shaped(0) {}
+
+	bool Setup(BenchmarkEnvironment& environment) override
+	{
+		environment.context->EnableStatistics(true);
+		if (!DocumentBenchmark::Setup(environment))
+			return false;
+
+		// Nothing is shaped unless the font engine is built with a shaper, the cache is then not checked.
+		shaping = (environment.context->GetStatistics().num_text_runs_shaped > 0);
+		cache_failure = false;
+		runs_shaped = 0;
+
+		if (shaping)
+		{
+			// New text must be shaped, while the same text again must be found in the cache.
+			Rml::Core::Element* paragraph = document->GetElementById("changed");
+			if (!paragraph)
+				return false;
+
+			paragraph->SetInnerRML("Quixotic jackdaws vex fjords");
+			const int new_text_runs = RenderFrame(environment);
+
+			paragraph->SetInnerRML(lorem_ipsum);
+			const int cached_text_runs = RenderFrame(environment);
+
+			if (new_text_runs == 0 || cached_text_runs != 0)
+			{
+				fprintf(stderr, "Expected new text to be shaped and cached text to be reused, shaped %d runs for new text and %d runs for cached text.\n", new_text_runs, cached_text_runs);
+				cache_failure = true;
+			}
+		}
+
+		return true;
+	}
+
+	bool Verify(const BenchmarkResult& /*result*/) const override
+	{
+		if (cache_failure)
+			return false;
+
+		if (runs_shaped != 0)
+		{
+			fprintf(stderr, "Expected the text laid out again to be reused from the cache, shaped %d runs.\n", runs_shaped);
+			return false;
+		}
+		return true;
+	}
+
+	void Run(BenchmarkEnvironment& environment) override
+	{
+		wide = !wide;
+		document->SetProperty(Rml::Core::PropertyId::Width, Rml::Core::Property(wide ? 700.f : 1000.f, Rml::Core::Property::PX));
+		runs_shaped += RenderFrame(environment);
+	}
+
+	void Teardown(BenchmarkEnvironment& environment) override
+	{
+		DocumentBenchmark::Teardown(environment);
+		environment.context->EnableStatistics(false);
+	}
+
+protected:
+	String CreateBody() override
+	{
+		return "<p id=\"changed\">" + String(lorem_ipsum) + "</p>" + CreateTextRml(30);
+	}
+
+private:
+	// Updates and renders the context, returning the number of text runs shaped.
+	static int RenderFrame(BenchmarkEnvironment& environment)
+	{
+		environment.context->Update();
+		environment.context->Render();
+		return environment.context->GetStatistics().num_text_runs_shaped;
+	}
+
+	bool wide;
+	bool shaping;
+	bool cache_failure;
+	int runs_shaped;
+};
+
+/**
+	Measures text in new glyphs rasterized on the background thread, waiting until they arrive. The same font is loaded
+	a second time as another family and prewarmed, which rasterizes its glyphs at once, and the measured widths and
+	generated glyph quads of both must match.
+ */
+
+class BenchmarkAsyncGlyphs : public Benchmark
+{
+public:
+	BenchmarkAsyncGlyphs() : Benchmark("async_glyphs", "Measure accented text at a new size rasterized in the background, and compare it with prewarmed glyphs.", 20), font_size_index(0), num_failures(0) {}
+
+	bool Setup(BenchmarkEnvironment& environment) override
+	{
+		if (!Rml::Core::IsAsyncGlyphRasterizationEnabled())
+			return false;
+
+		// Each family needs its own copy of the font data, as faces loaded from the same memory share their glyphs.
+		if (font_data[0].empty())
+		{
+			Rml::Core::FileInterface* file_interface = Rml::Core::GetFileInterface();
+			Rml::Core::FileHandle handle = file_interface->Open(environment.assets_directory + "Delicious-Roman.otf");
+			if (!handle)
+				return false;
+
+			font_data[0].resize(file_interface->Length(handle));
+			font_data[0].resize(file_interface->Read(font_data[0].data(), font_data[0].size(), handle));
+			file_interface->Close(handle);
+			font_data[1] = font_data[0];
+
+			const char* families[] = { "benchmark-async", "benchmark-sync" };
+			for (int i = 0; i < 2; i++)
+			{
+				if (!Rml::Core::LoadFontFace(font_data[i].data(), (int)font_data[i].size(), families[i], Rml::Core::Style::FontStyle::Normal, Rml::Core::Style::FontWeight::Normal))
+					return false;
+			}
+		}
+
+		// The accented letters of Latin-1, which are not rasterized until used.
+		text.clear();
+		for (Rml::Core::Character character = Rml::Core::Character(0xC0); character <= Rml::Core::Character(0xFF); character = Rml::Core::Character((int)character + 1))
+			text += Rml::Core::StringUtilities::ToUTF8(character);
+
+		font_size_index = 0;
+		num_failures = 0;
+		return true;
+	}
+
+	bool Verify(const BenchmarkResult& /*result*/) const override
+	{
+		if (num_failures > 0)
+		{
+			fprintf(stderr, "Expected glyphs rasterized in the background to match those rasterized at once, %d sizes did not.\n", num_failures);
+			return false;
+		}
+		return true;
+	}
+
+	void Run(BenchmarkEnvironment& /*environment*/) override
+	{
+		Rml::Core::FontEngineInterface* font_engine_interface = Rml::Core::GetFontEngineInterface();
+
+		// A new size creates new handles, so their glyphs are rasterized again. Sizes are reused after many iterations.
+		const int font_size = 12 + font_size_index;
+		font_size_index = (font_size_index + 1) % 40;
+
+		Rml::Core::FontFaceHandle async_handle = font_engine_interface->GetFontFaceHandle("benchmark-async", Rml::Core::Style::FontStyle::Normal, Rml::Core::Style::FontWeight::Normal, font_size);
+		Rml::Core::FontFaceHandle sync_handle = font_engine_interface->GetFontFaceHandle("benchmark-sync", Rml::Core::Style::FontStyle::Normal, Rml::Core::Style::FontWeight::Normal, font_size);
+		if (!async_handle || !sync_handle)
+		{
+			num_failures++;
+			return;
+		}
+
+		// Measuring the text queues its glyphs, the font engine hands back the completed glyphs when asked for its version.
+		font_engine_interface->GetStringWidth(async_handle, text);
+		for (int i = 0; i < 5000 && font_engine_interface->HasPendingGlyphs(async_handle); i++)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			font_engine_interface->GetVersion(async_handle);
+		}
+
+		font_engine_interface->PrewarmGlyphs(sync_handle, 0, text, nullptr);
+
+		if (font_engine_interface->HasPendingGlyphs(async_handle) || !GlyphsMatch(font_engine_interface, async_handle, sync_handle))
+			num_failures++;
+	}
+
+private:
+	// Returns true if each character, and the text as a whole, is measured and generated the same by both handles.
+	bool GlyphsMatch(Rml::Core::FontEngineInterface* font_engine_interface, Rml::Core::FontFaceHandle async_handle, Rml::Core::FontFaceHandle sync_handle) const
+	{
+		if (font_engine_interface->GetStringWidth(async_handle, text) != font_engine_interface->GetStringWidth(sync_handle, text))
+			return false;
+
+		for (auto it = Rml::Core::StringIteratorU8(text); it; ++it)
+		{
+			const String character = Rml::Core::StringUtilities::ToUTF8(*it);
+			if (font_engine_interface->GetStringWidth(async_handle, character) != font_engine_interface->GetStringWidth(sync_handle, character))
+				return false;
+		}
+
+		Rml::Core::GeometryList async_geometry, sync_geometry;
+		font_engine_interface->GenerateString(async_handle, 0, text, Rml::Core::Vector2f(0, 0), Rml::Core::Colourb(255, 255, 255), async_geometry);
+		font_engine_interface->GenerateString(sync_handle, 0, text, Rml::Core::Vector2f(0, 0), Rml::Core::Colourb(255, 255, 255), sync_geometry);
+
+		std::vector< Rml::Core::Vector2f > async_positions, sync_positions;
+		for (Rml::Core::Geometry& geometry : async_geometry)
+			for (const Rml::Core::Vertex& vertex : geometry.GetVertices())
+				async_positions.push_back(vertex.position);
+		for (Rml::Core::Geometry& geometry : sync_geometry)
+			for (const Rml::Core::Vertex& vertex : geometry.GetVertices())
+				sync_positions.push_back(vertex.position);
+
+		return !async_positions.empty() && async_positions == sync_positions;
+	}
+
+	// Kept alive until the font engine is shut down, as the font faces are loaded from memory.
+	static std::vector< Rml::Core::byte > font_data[2];
+
+	String text;
+	int font_size_index;
+	int num_failures;
+};
+
+std::vector< Rml::Core::byte > BenchmarkAsyncGlyphs::font_data[2];
+
+/**
+	Sweeps the mouse across a grid of cells with hover styles.
+ */
+
+class BenchmarkHoverHitTest : public DocumentBenchmark
+{
+public:
+	BenchmarkHoverHitTest() : DocumentBenchmark("hover_hit_test", "Move the mouse 100 times across 1000 hoverable cells, updating after each move.", 20), iteration(0) {}
+
+	void Run(BenchmarkEnvironment& environment) override
+	{
+		const int offset = (iteration++ % 2) * 12;
+
+		for (int i = 0; i < 100; i++)
+		{
+			const int x = (i * 97 + offset) % 1000;
+			const int y = (i * 61 + offset) % 625;
+			environment.context->ProcessMouseMove(x, y, 0);
+			environment.context->Update();
+		}
+	}
+
+protected:
+	String CreateBody() override
+	{
+		String rml;
+		for (int i = 0; i < 1000; i++)
+			rml += "<div class=\"cell\"/>";
+		return rml;
+	}
+
+private:
+	int iteration;
+};
+
+/**
+	Advances the clock by one frame with a large number of running animations.
+ */
+
+class BenchmarkAnimationTick : public DocumentBenchmark
+{
+public:
+	BenchmarkAnimationTick() : DocumentBenchmark("animation_tick", "Advance 300 animated elements by one frame, then update and render.", 200) {}
+
+	void Run(BenchmarkEnvironment& environment) override
+	{
+		environment.system_interface->AdvanceTime(1.0 / 60.0);
+		environment.context->Update();
+		environment.context->Render();
+	}
+
+protected:
+	String CreateBody() override
+	{
+		String rml;
+		for (int i = 0; i < 300; i++)
+			rml += "<div class=\"animated\"/>";
+		return rml;
+	}
+};
+
+/**
+	Animates the rotation of a large number of elements inside rotated groups, and hit-tests the transformed elements.
+ */
+
+class BenchmarkTransformAnimation : public DocumentBenchmark
+{
+public:
+	BenchmarkTransformAnimation() : DocumentBenchmark("transform_animation", "Advance 1000 rotating elements by one frame, render, then move the mouse 20 times across them.", 100), iteration(0) {}
+
+	void Run(BenchmarkEnvironment& environment) override
+	{
+		environment.system_interface->AdvanceTime(1.0 / 60.0);
+		environment.context->Update();
+		environment.context->Render();
+
+		const int offset = (iteration++ % 2) * 7;
+
+		for (int i = 0; i < 20; i++)
+		{
+			const int x = (i * 47 + offset) % 1000;
+			const int y = (i * 31 + offset) % 680;
+			environment.context->ProcessMouseMove(x, y, 0);
+		}
+	}
+
+protected:
+	String CreateBody() override
+	{
+		String rml;
+		for (int i = 0; i < 10; i++)
+		{
+			rml += "<div class=\"spin-group\">";
+			for (int j = 0; j < 100; j++)
+				rml += "<div class=\"spin\"><div class=\"tilt\"/></div>";
+			rml += "</div>";
+		}
+		return rml;
+	}
+
+private:
+	int iteration;
+};
+
+/**
+	Dispatches a storm of mouse events through deeply nested elements, where only some of the events have listeners.
+ */
+
+class BenchmarkEventDispatch : public DocumentBenchmark
+{
+public:
+	BenchmarkEventDispatch() : DocumentBenchmark("event_dispatch", "Move the mouse 500 times across 1000 cells nested 16 levels deep, dispatching mousemove, mouseover and mouseout.", 50), iteration(0) {}
+
+	bool Setup(BenchmarkEnvironment& environment) override
+	{
+		if (!DocumentBenchmark::Setup(environment))
+			return false;
+
+		// Only mouseover and click have listeners, mousemove and mouseout have none.
+		document->AddEventListener("mouseover", &listener, true);
+		document->AddEventListener("click", &listener);
+		return true;
+	}
+
+	void Run(BenchmarkEnvironment& environment) override
+	{
+		const int offset = (iteration++ % 2) * 5;
+
+		for (int i = 0; i < 500; i++)
+		{
+			const int x = (i * 37 + offset) % 1000;
+			const int y = (i * 23 + offset) % 625;
+			environment.context->ProcessMouseMove(x, y, 0);
+		}
+	}
+
+	void Teardown(BenchmarkEnvironment& environment) override
+	{
+		if (document)
+		{
+			document->RemoveEventListener("mouseover", &listener, true);
+			document->RemoveEventListener("click", &listener);
+		}
+		DocumentBenchmark::Teardown(environment);
+	}
+
+protected:
+	String CreateBody() override
+	{
+		String rml;
+		for (int i = 0; i < 16; i++)
+			rml += "<div>";
+		for (int i = 0; i < 1000; i++)
+			rml += "<div class=\"cell\"/>";
+		for (int i = 0; i < 16; i++)
+			rml += "</div>";
+		return rml;
+	}
+
+private:
+	class Listener : public Rml::Core::EventListener
+	{
+	public:
+		void ProcessEvent(Rml::Core::Event& /*event*/) override { num_events++; }
+		int num_events = 0;
+	};
+
+	Listener listener;
+	int iteration;
+};
+
+/**
+	Switches a data select between two tables of a data source. The options must be rebuilt from the new table during
+	the update following each switch, without anything else asking the control for its options.
+ */
+
+class BenchmarkDataSelectSource : public DocumentBenchmark
+{
+public:
+	BenchmarkDataSelectSource() : DocumentBenchmark("data_select_source", "Switch a data select between two tables of 100 rows, then update.", 100), select(nullptr), use_second_table(false), num_failures(0) {}
+
+	bool Setup(BenchmarkEnvironment& environment) override
+	{
+		data_source = std::make_unique< TableSource >();
+
+		if (!DocumentBenchmark::Setup(environment))
+			return false;
+
+		select = rmlui_dynamic_cast< Rml::Controls::ElementFormControlDataSelect* >(document->GetElementById("select"));
+		use_second_table = false;
+		num_failures = 0;
+
+		return select != nullptr && data_source->GetNumQueries("first") > 0;
+	}
+
+	bool Verify(const BenchmarkResult& /*result*/) const override
+	{
+		if (num_failures > 0)
+		{
+			fprintf(stderr, "Expected the options to be rebuilt after each change of the data source, %d changes were not picked up.\n", num_failures);
+			return false;
+		}
+		return true;
+	}
+
+	void Run(BenchmarkEnvironment& environment) override
+	{
+		use_second_table = !use_second_table;
+		const char* table = (use_second_table ? "second" : "first");
+
+		const int num_queries = data_source->GetNumQueries(table);
+		select->SetDataSource(CreateString(32, "benchmark.%s", table));
+		environment.context->Update();
+
+		if (data_source->GetNumQueries(table) == num_queries)
+			num_failures++;
+	}
+
+	void Teardown(BenchmarkEnvironment& environment) override
+	{
+		DocumentBenchmark::Teardown(environment);
+
+		// Remove the closed document, so the data select detaches before the data source is destroyed.
+		environment.context->Update();
+		data_source.reset();
+		select = nullptr;
+	}
+
+protected:
+	String CreateBody() override
+	{
+		return "<dataselect id=\"select\" source=\"benchmark.first\" fields=\"name\"/>";
+	}
+
+private:
+	class TableSource : public Rml::Controls::DataSource
+	{
+	public:
+		TableSource() : Rml::Controls::DataSource("benchmark") {}
+
+		void GetRow(Rml::Core::StringList& row, const String& table, int row_index, const Rml::Core::StringList& columns) override
+		{
+			for (size_t i = 0; i < columns.size(); i++)
+				row.push_back(CreateString(64, "%s %d", table.c_str(), row_index));
+		}
+
+		int GetNumRows(const String& table) override
+		{
+			num_queries[table] += 1;
+			return 100;
+		}
+
+		int GetNumQueries(const String& table)
+		{
+			return num_queries[table];
+		}
+
+	private:
+		Rml::Core::UnorderedMap< String, int > num_queries;
+	};
+
+	std::unique_ptr< TableSource > data_source;
+	Rml::Controls::ElementFormControlDataSelect* select;
+	bool use_second_table;
+	int num_failures;
+};
+
+/**
+	Updates and renders a large document where nothing has changed, measuring the cost of traversing its elements.
+ */
+
+class BenchmarkUpdateTraversal : public DocumentBenchmark
+{
+public:
+	BenchmarkUpdateTraversal() : DocumentBenchmark("update_traversal", "Update and render a document of 2000 unchanged rows.", 100) {}
+
+	void Run(BenchmarkEnvironment& environment) override
+	{
+		environment.context->Update();
+		environment.context->Render();
+	}
+
+protected:
+	String CreateBody() override
+	{
+		return CreateRowsRml(2000, 0);
+	}
+};
+
+/**
+	Updates and renders a large unchanged document with damage tracking enabled, where nothing should be redrawn.
+ */
+
+class BenchmarkDamageIdle : public DocumentBenchmark
+{
+public:
+	BenchmarkDamageIdle() : DocumentBenchmark("damage_idle", "Update and render 2000 unchanged rows with damage tracking enabled.", 100) {}
+
+	bool Setup(BenchmarkEnvironment& environment) override
+	{
+		environment.context->EnableDamageTracking(true);
+		return DocumentBenchmark::Setup(environment);
+	}
+
+	bool Verify(const BenchmarkResult& result) const override
+	{
+		const RenderCounters& counters = result.counters;
+		if (counters.render_calls + counters.compiled_render_calls != 0)
+		{
+			fprintf(stderr, "Expected no draw calls for unchanged frames, got %d draw calls in %d frames.\n", counters.render_calls + counters.compiled_render_calls, result.iterations);
+			return false;
+		}
+		return true;
+	}
+
+	void Run(BenchmarkEnvironment& environment) override
+	{
+		environment.context->Update();
+		environment.context->Render();
+	}
+
+	void Teardown(BenchmarkEnvironment& environment) override
+	{
+		DocumentBenchmark::Teardown(environment);
+		environment.context->EnableDamageTracking(false);
+	}
+
+protected:
+	String CreateBody() override
+	{
+		return CreateRowsRml(2000, 0);
+	}
+};
+
+/**
+	Updates and renders a large unchanged document cached in a layer, which should be drawn as a single textured quad.
+ */
+
+class BenchmarkLayerRender : public DocumentBenchmark
+{
+public:
+	BenchmarkLayerRender() : DocumentBenchmark("layer_render", "Update and render 150 unchanged rows cached in a layer.", 200) {}
+
+	bool Verify(const BenchmarkResult& result) const override
+	{
+		const RenderCounters& counters = result.counters;
+		if (counters.render_texture_captures != 0 || counters.render_texture_draws != result.iterations || counters.render_calls + counters.compiled_render_calls != result.iterations)
+		{
+			fprintf(stderr, "Expected one layer quad per frame and no captures, got %d captures and %d layer draws out of %d draw calls in %d frames.\n",
+				counters.render_texture_captures, counters.render_texture_draws, counters.render_calls + counters.compiled_render_calls, result.iterations);
+			return false;
+		}
+		return true;
+	}
+
+	void Run(BenchmarkEnvironment& environment) override
+	{
+		environment.context->Update();
+		environment.context->Render();
+	}
+
+protected:
+	String CreateBody() override
+	{
+		return "<div style=\"render-cache: layer\">" + CreateRowsRml(150, 0) + "</div>";
+	}
+};
+
+/**
+	Scrolls through a long log where only a small part of the entries are visible, then updates and renders it.
+ */
+
+class BenchmarkScrollLog : public DocumentBenchmark
+{
+public:
+	BenchmarkScrollLog() : DocumentBenchmark("scroll_log", "Scroll a log of 3000 entries by one entry, then update and render.", 200), log(nullptr), scroll_position(0) {}
+
+	bool Setup(BenchmarkEnvironment& environment) override
+	{
+		if (!DocumentBenchmark::Setup(environment))
+			return false;
+
+		log = document->GetElementById("log");
+		scroll_position = 0;
+		return log != nullptr;
+	}
+
+	void Run(BenchmarkEnvironment& environment) override
+	{
+		scroll_position = (scroll_position + 1) % 100;
+		log->SetScrollTop(log->GetScrollHeight() * 0.5f + scroll_position * 20.f);
+
+		environment.context->Update();
+		environment.context->Render();
+	}
+
+protected:
+	String CreateBody() override
+	{
+		String rml = "<div class=\"log\" id=\"log\">";
+		for (int i = 0; i < 3000; i++)
+			rml += CreateString(256, "<div class=\"entry\"><div class=\"author\">User %d:</div> Message number %d of the log.</div>", i % 17, i);
+		rml += "</div>";
+		return rml;
+	}
+
+private:
+	Rml::Core::Element* log;
+	int scroll_position;
+};
+
+const char* glyph_cache_check_name = "glyph_cache";
+const char* glyph_cache_check_description = "Check that prewarmed glyphs are read back from the glyph cache unchanged.";
+
+/**
+	The glyph metrics of a font face at a few sizes, as gathered by a single run of RmlUi during the glyph cache check.
+ */
+
+struct GlyphCacheMetrics
+{
+	// Number of glyphs of each size when its handle was created, before any were prewarmed.
+	std::vector< int > num_initial_glyphs;
+	// Number of glyphs of each size after prewarming.
+	std::vector< int > num_glyphs;
+	// The line metrics of each size, followed by the widths of the text and each of its characters.
+	std::vector< int > values;
+	// The positions of the glyph quads generated for the text at each size.
+	std::vector< Rml::Core::Vector2f > positions;
+};
+
+// Returns the number of glyphs of the given size of the Delicious font face.
+static int GetNumGlyphs(int font_size)
+{
+	std::vector< Rml::Core::FontFaceStatistics > statistics;
+	Rml::Core::GetFontEngineInterface()->GetFontFaceStatistics(statistics);
+
+	for (const Rml::Core::FontFaceStatistics& font : statistics)
+	{
+		if (font.size == font_size && font.style == Rml::Core::Style::FontStyle::Normal && font.weight == Rml::Core::Style::FontWeight::Normal)
+			return font.num_glyphs;
+	}
+	return 0;
+}
+
+// Initialises RmlUi with the given glyph cache directory, and gathers the metrics of the Delicious font face at a few
+// sizes, optionally prewarming the accented letters of Latin-1 first. The cache is written when RmlUi is shut down.
+static bool GatherGlyphCacheMetrics(const String& assets_directory, const String& cache_directory, bool prewarm, NullRenderInterface& render_interface, BenchmarkSystemInterface& system_interface, GlyphCacheMetrics& metrics)
+{
+	Rml::Core::SetRenderInterface(&render_interface);
+	Rml::Core::SetSystemInterface(&system_interface);
+	Rml::Core::SetGlyphCacheDirectory(cache_directory);
+
+	if (!Rml::Core::Initialise())
+		return false;
+
+	bool result = Rml::Core::LoadFontFace(assets_directory + "Delicious-Roman.otf");
+
+	String text = "Glyph cache ";
+	for (Rml::Core::Character character = Rml::Core::Character(0xC0); character <= Rml::Core::Character(0xFF); character = Rml::Core::Character((int)character + 1))
+		text += Rml::Core::StringUtilities::ToUTF8(character);
+
+	Rml::Core::FontEngineInterface* font_engine_interface = Rml::Core::GetFontEngineInterface();
+	const int font_sizes[] = { 14, 20, 32 };
+
+	for (int font_size : font_sizes)
+	{
+		if (!result)
+			break;
+
+		Rml::Core::FontFaceHandle handle = font_engine_interface->GetFontFaceHandle("delicious", Rml::Core::Style::FontStyle::Normal, Rml::Core::Style::FontWeight::Normal, font_size);
+		if (!handle)
+		{
+			result = false;
+			break;
+		}
+
+		metrics.num_initial_glyphs.push_back(GetNumGlyphs(font_size));
+
+		if (prewarm)
+			result = Rml::Core::PrewarmFontFace("Delicious", Rml::Core::Style::FontStyle::Normal, Rml::Core::Style::FontWeight::Normal, font_size, String(), text);
+
+		metrics.num_glyphs.push_back(GetNumGlyphs(font_size));
+
+		metrics.values.push_back(font_engine_interface->GetLineHeight(handle));
+		metrics.values.push_back(font_engine_interface->GetBaseline(handle));
+		metrics.values.push_back(font_engine_interface->GetXHeight(handle));
+		metrics.values.push_back(font_engine_interface->GetStringWidth(handle, text));
+		for (auto it = Rml::Core::StringIteratorU8(text); it; ++it)
+			metrics.values.push_back(font_engine_interface->GetStringWidth(handle, Rml::Core::StringUtilities::ToUTF8(*it)));
+
+		Rml::Core::GeometryList geometry;
+		font_engine_interface->GenerateString(handle, 0, text, Rml::Core::Vector2f(0, 0), Rml::Core::Colourb(255, 255, 255), geometry);
+		for (Rml::Core::Geometry& layer_geometry : geometry)
+			for (const Rml::Core::Vertex& vertex : layer_geometry.GetVertices())
+				metrics.positions.push_back(vertex.position);
+	}
+
+	Rml::Core::Shutdown();
+	Rml::Core::SetGlyphCacheDirectory(String());
+
+	return result;
+}
+
+bool RunGlyphCacheCheck(const String& assets_directory, const String& cache_directory, NullRenderInterface& render_interface, BenchmarkSystemInterface& system_interface)
+{
+	// The reference metrics are gathered without the cache. The cache is then written by a run prewarming the same
+	// glyphs, and read back by a run using them without prewarming.
+	GlyphCacheMetrics reference, written, read;
+	if (!GatherGlyphCacheMetrics(assets_directory, String(), true, render_interface, system_interface, reference) ||
+		!GatherGlyphCacheMetrics(assets_directory, cache_directory, true, render_interface, system_interface, written) ||
+		!GatherGlyphCacheMetrics(assets_directory, cache_directory, false, render_interface, system_interface, read))
+	{
+		fprintf(stderr, "Could not gather the glyph metrics using the glyph cache in '%s'.\n", cache_directory.c_str());
+		return false;
+	}
+
+	if (read.num_initial_glyphs != written.num_glyphs)
+	{
+		fprintf(stderr, "Expected the prewarmed glyphs to be read from the glyph cache in '%s'.\n", cache_directory.c_str());
+		return false;
+	}
+
+	if (read.values != reference.values || read.positions != reference.positions)
+	{
+		fprintf(stderr, "Expected the glyphs read from the glyph cache to match glyphs rasterized without it.\n");
+		return false;
+	}
+
+	return true;
+}
+
+std::vector< std::unique_ptr< Benchmark > > CreateBenchmarks()
+{
+	std::vector< std::unique_ptr< Benchmark > > benchmarks;
+
+	benchmarks.push_back(std::make_unique< BenchmarkDocumentLoad >());
+	benchmarks.push_back(std::make_unique< BenchmarkDocumentLoadIncremental >());
+	benchmarks.push_back(std::make_unique< BenchmarkSetInnerRml >());
+	benchmarks.push_back(std::make_unique< BenchmarkStyleClassToggle >());
+	benchmarks.push_back(std::make_unique< BenchmarkLayoutFull >());
+	benchmarks.push_back(std::make_unique< BenchmarkLayoutPartial >());
+	benchmarks.push_back(std::make_unique< BenchmarkRenderText >());
+	benchmarks.push_back(std::make_unique< BenchmarkTextMeasure >());
+	benchmarks.push_back(std::make_unique< BenchmarkRegenerateText >());
+	benchmarks.push_back(std::make_unique< BenchmarkTextShaping >());
+	benchmarks.push_back(std::make_unique< BenchmarkAsyncGlyphs >());
+	benchmarks.push_back(std::make_unique< BenchmarkHoverHitTest >());
+	benchmarks.push_back(std::make_unique< BenchmarkAnimationTick >());
+	benchmarks.push_back(std::make_unique< BenchmarkTransformAnimation >());
+	benchmarks.push_back(std::make_unique< BenchmarkEventDispatch >());
+	benchmarks.push_back(std::make_unique< BenchmarkDataSelectSource >());
+	benchmarks.push_back(std::make_unique< BenchmarkUpdateTraversal >());
+	benchmarks.push_back(std::make_unique< BenchmarkDamageIdle >());
+	benchmarks.push_back(std::make_unique< BenchmarkLayerRender >());
+	benchmarks.push_back(std::make_unique< BenchmarkScrollLog >());
+
+	return benchmarks;
+}
@@ -0,0 +1,49 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_BENCHMARKS_BENCHMARKS_H
+#define RMLUI_BENCHMARKS_BENCHMARKS_H
+
+#include "Benchmark.h"
+#include <memory>
+
+/// Creates all the benchmarks of the suite, in the order they are run.
+std::vector< std::unique_ptr< Benchmark > > CreateBenchmarks();
+
+/// Name and description of the glyph cache check, which is run separately from the benchmarks.
+extern const char* glyph_cache_check_name;
+extern const char* glyph_cache_check_description;
+
+/// Checks that glyphs written to the glyph cache are read back with identical metrics. RmlUi is initialised and shut
+/// down several times, so this must be called before it is initialised for the benchmarks.
+/// @param[in] assets_directory The directory containing the Delicious fonts.
+/// @param[in] cache_directory An existing directory to store the cache files in.
+/// @return True if the check passed.
+bool RunGlyphCacheCheck(const Rml::Core::String& assets_directory, const Rml::Core::String& cache_directory, NullRenderInterface& render_interface, BenchmarkSystemInterface& system_interface);
+
+#endif
@@ -0,0 +1,247 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "Benchmark.h"
+#include "Benchmarks.h"
+#include <RmlUi/Core.h>
+#include <RmlUi/Controls.h>
+#include <cstdlib>
+#include <cstring>
+
+#ifndef RMLUI_BENCHMARKS_ASSETS_DIR
+	#define RMLUI_BENCHMARKS_ASSETS_DIR "Samples/assets/"
+#endif
+
+static void PrintUsage(const char* program)
+{
+	fprintf(stderr,
+		"Usage: %s [options]\n"
+		"  --format <json|csv|text>  Output format, json by default.\n"
+		"  --output <file>           Write the results to a file instead of the standard output.\n"
+		"  --filter <text>           Only run the benchmarks whose name contains the text.\n"
+		"  --iterations <n>          Number of timed iterations, overriding each benchmark's default.\n"
+		"  --warmup <n>              Number of untimed iterations before the timed ones, 3 by default.\n"
+		"  --assets <directory>      Directory containing the Delicious fonts.\n"
+		"  --glyph-cache <directory> Existing directory for the glyph cache check, the temporary directory by default.\n"
+		"  --list                    List the benchmarks and exit.\n",
+		program);
+}
+
+// Returns the temporary directory of the system, or an empty string if it is unknown.
+static Rml::Core::String GetTemporaryDirectory()
+{
+	const char* variables[] = { "TMPDIR", "TEMP", "TMP" };
+	for (const char* variable : variables)
+	{
+		if (const char* directory = getenv(variable))
+			return directory;
+	}
+
+#ifdef _WIN32
+	return Rml::Core::String();
+#else
+	return "/tmp";
+#endif
+}
+
+int main(int argc, char** argv)
+{
+	ResultFormat format = ResultFormat::Json;
+	const char* output_path = nullptr;
+	const char* filter = nullptr;
+	int iterations = 0;
+	int warmup_iterations = 3;
+	Rml::Core::String assets_directory = RMLUI_BENCHMARKS_ASSETS_DIR;
+	Rml::Core::String glyph_cache_directory = GetTemporaryDirectory();
+	bool list = false;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const char* argument = argv[i];
+		const char* value = (i + 1 < argc ? argv[i + 1] : nullptr);
+		bool consumed_value = true;
+
+		if (strcmp(argument, "--format") == 0 && value)
+		{
+			if (strcmp(value, "json") == 0)
+				format = ResultFormat::Json;
+			else if (strcmp(value, "csv") == 0)
+				format = ResultFormat::Csv;
+			else if (strcmp(value, "text") == 0)
+				format = ResultFormat::Text;
+			else
+			{
+				PrintUsage(argv[0]);
+				return 1;
+			}
+		}
+		else if (strcmp(argument, "--output") == 0 && value)
+			output_path = value;
+		else if (strcmp(argument, "--filter") == 0 && value)
+			filter = value;
+		else if (strcmp(argument, "--iterations") == 0 && value)
+			iterations = atoi(value);
+		else if (strcmp(argument, "--warmup") == 0 && value)
+			warmup_iterations = atoi(value);
+		else if (strcmp(argument, "--assets") == 0 && value)
+			assets_directory = value;
+		else if (strcmp(argument, "--glyph-cache") == 0 && value)
+			glyph_cache_directory = value;
+		else if (strcmp(argument, "--list") == 0)
+		{
+			list = true;
+			consumed_value = false;
+		}
+		else
+		{
+			PrintUsage(argv[0]);
+			return 1;
+		}
+
+		if (consumed_value)
+			i++;
+	}
+
+	std::vector< std::unique_ptr< Benchmark > > benchmarks = CreateBenchmarks();
+
+	if (list)
+	{
+		for (const auto& benchmark : benchmarks)
+			printf("%-24s %s\n", benchmark->GetName().c_str(), benchmark->GetDescription().c_str());
+		printf("%-24s %s\n", glyph_cache_check_name, glyph_cache_check_description);
+		return 0;
+	}
+
+	if (!assets_directory.empty() && assets_directory.back() != '/' && assets_directory.back() != '\\')
+		assets_directory += '/';
+
+	NullRenderInterface render_interface;
+	BenchmarkSystemInterface system_interface;
+
+	bool success = true;
+
+	// The glyph cache is only written when RmlUi shuts down, so it is checked before RmlUi is initialised for the benchmarks.
+	if (!filter || Rml::Core::String(glyph_cache_check_name).find(filter) != Rml::Core::String::npos)
+	{
+		fprintf(stderr, "Running %s...\n", glyph_cache_check_name);
+
+		if (glyph_cache_directory.empty())
+		{
+			fprintf(stderr, "Skipping %s, use --glyph-cache to set the directory.\n", glyph_cache_check_name);
+		}
+		else if (!RunGlyphCacheCheck(assets_directory, glyph_cache_directory, render_interface, system_interface))
+		{
+			fprintf(stderr, "Check %s failed.\n", glyph_cache_check_name);
+			success = false;
+		}
+	}
+
+	Rml::Core::SetRenderInterface(&render_interface);
+	Rml::Core::SetSystemInterface(&system_interface);
+
+	// Only glyphs outside of ASCII are rasterized in the background, the benchmarks using them prewarm their glyphs.
+	Rml::Core::EnableAsyncGlyphRasterization(true);
+
+	if (!Rml::Core::Initialise())
+		return 1;
+
+	Rml::Controls::Initialise();
+
+	const char* font_faces[] = { "Delicious-Roman.otf", "Delicious-Italic.otf", "Delicious-Bold.otf", "Delicious-BoldItalic.otf" };
+	for (const char* font_face : font_faces)
+	{
+		if (!Rml::Core::LoadFontFace(assets_directory + font_face))
+		{
+			fprintf(stderr, "Could not load the font '%s' from '%s', use --assets to set the directory.\n", font_face, assets_directory.c_str());
+			Rml::Core::Shutdown();
+			return 1;
+		}
+	}
+
+	BenchmarkEnvironment environment;
+	environment.context = Rml::Core::CreateContext("benchmarks", Rml::Core::Vector2i(1024, 768));
+	environment.render_interface = &render_interface;
+	environment.system_interface = &system_interface;
+	environment.assets_directory = assets_directory;
+
+	if (!environment.context)
+	{
+		Rml::Core::Shutdown();
+		return 1;
+	}
+
+	std::vector< BenchmarkResult > results;
+
+	for (const auto& benchmark : benchmarks)
+	{
+		if (filter && benchmark->GetName().find(filter) == Rml::Core::String::npos)
+			continue;
+
+		fprintf(stderr, "Running %s...\n", benchmark->GetName().c_str());
+
+		BenchmarkResult result;
+		if (RunBenchmark(*benchmark, environment, iterations, warmup_iterations, result))
+		{
+			if (!benchmark->Verify(result))
+			{
+				fprintf(stderr, "Benchmark %s failed its checks.\n", benchmark->GetName().c_str());
+				success = false;
+			}
+
+			results.push_back(result);
+		}
+		else
+		{
+			fprintf(stderr, "Benchmark %s failed during setup.\n", benchmark->GetName().c_str());
+			success = false;
+		}
+	}
+
+	Rml::Core::Shutdown();
+
+	FILE* file = stdout;
+	if (output_path)
+	{
+		file = fopen(output_path, "w");
+		if (!file)
+		{
+			fprintf(stderr, "Could not open '%s' for writing.\n", output_path);
+			return 1;
+		}
+	}
+
+	WriteResults(file, results, format);
+
+	if (file != stdout)
+		fclose(file);
+
+	if (system_interface.GetNumErrors() > 0)
+		fprintf(stderr, "%d errors or warnings were logged while running the benchmarks.\n", system_interface.GetNumErrors());
+
+	return success ? 0 : 1;
+}
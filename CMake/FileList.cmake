@@ -4,6 +4,8 @@ set(Core_HDR_FILES
     ${PROJECT_SOURCE_DIR}/Source/Core/Clock.h
     ${PROJECT_SOURCE_DIR}/Source/Core/ComputeProperty.h
     ${PROJECT_SOURCE_DIR}/Source/Core/ContextInstancerDefault.h
+    ${PROJECT_SOURCE_DIR}/Source/Core/ContextStatistics.h
+    ${PROJECT_SOURCE_DIR}/Source/Core/DecoratorGeometryCache.h
     ${PROJECT_SOURCE_DIR}/Source/Core/DecoratorGradient.h
     ${PROJECT_SOURCE_DIR}/Source/Core/DecoratorNinePatch.h
     ${PROJECT_SOURCE_DIR}/Source/Core/DecoratorTiled.h
@@ -24,6 +26,7 @@ set(Core_HDR_FILES
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementDefinition.h
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementHandle.h
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementImage.h
+    ${PROJECT_SOURCE_DIR}/Source/Core/ElementLayer.h
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementStyle.h
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementTextDefault.h
     ${PROJECT_SOURCE_DIR}/Source/Core/EventDispatcher.h
@@ -35,6 +38,7 @@ set(Core_HDR_FILES
     ${PROJECT_SOURCE_DIR}/Source/Core/FontEffectGlow.h
     ${PROJECT_SOURCE_DIR}/Source/Core/FontEffectOutline.h
     ${PROJECT_SOURCE_DIR}/Source/Core/FontEffectShadow.h
+    ${PROJECT_SOURCE_DIR}/Source/Core/GeometryArena.h
     ${PROJECT_SOURCE_DIR}/Source/Core/GeometryDatabase.h
     ${PROJECT_SOURCE_DIR}/Source/Core/IdNameMap.h
     ${PROJECT_SOURCE_DIR}/Source/Core/LayoutBlockBox.h
@@ -48,6 +52,7 @@ set(Core_HDR_FILES
     ${PROJECT_SOURCE_DIR}/Source/Core/Pool.h
     ${PROJECT_SOURCE_DIR}/Source/Core/precompiled.h
     ${PROJECT_SOURCE_DIR}/Source/Core/PropertiesIterator.h
+    ${PROJECT_SOURCE_DIR}/Source/Core/PropertyParseCache.h
     ${PROJECT_SOURCE_DIR}/Source/Core/PropertyParserAnimation.h
     ${PROJECT_SOURCE_DIR}/Source/Core/PropertyParserColour.h
     ${PROJECT_SOURCE_DIR}/Source/Core/PropertyParserKeyword.h
@@ -138,6 +143,8 @@ set(Core_PUB_HDR_FILES
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/MathTypes.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/Matrix4.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/Matrix4.inl
+    ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/MemoryInterface.h
+    ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/MemoryStatistics.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/ObserverPtr.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/Platform.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/Plugin.h
@@ -189,9 +196,11 @@ set(Core_SRC_FILES
     ${PROJECT_SOURCE_DIR}/Source/Core/Context.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/ContextInstancer.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/ContextInstancerDefault.cpp
+    ${PROJECT_SOURCE_DIR}/Source/Core/ContextStatistics.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/ConvolutionFilter.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Core.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Decorator.cpp
+    ${PROJECT_SOURCE_DIR}/Source/Core/DecoratorGeometryCache.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/DecoratorGradient.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/DecoratorInstancer.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/DecoratorNinePatch.cpp
@@ -216,6 +225,7 @@ set(Core_SRC_FILES
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementHandle.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementImage.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementInstancer.cpp
+    ${PROJECT_SOURCE_DIR}/Source/Core/ElementLayer.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementScroll.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementStyle.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementText.cpp
@@ -238,6 +248,7 @@ set(Core_SRC_FILES
     ${PROJECT_SOURCE_DIR}/Source/Core/FontEffectShadow.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineInterface.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Geometry.cpp
+    ${PROJECT_SOURCE_DIR}/Source/Core/GeometryArena.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/GeometryDatabase.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/GeometryUtilities.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/LayoutBlockBox.cpp
@@ -249,14 +260,18 @@ set(Core_SRC_FILES
     ${PROJECT_SOURCE_DIR}/Source/Core/Log.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Math.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Memory.cpp
+    ${PROJECT_SOURCE_DIR}/Source/Core/MemoryInterface.cpp
+    ${PROJECT_SOURCE_DIR}/Source/Core/MemoryStatistics.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/ObserverPtr.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Plugin.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/PluginRegistry.cpp
+    ${PROJECT_SOURCE_DIR}/Source/Core/Pool.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Profiling.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/PropertiesIteratorView.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Property.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/PropertyDefinition.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/PropertyDictionary.cpp
+    ${PROJECT_SOURCE_DIR}/Source/Core/PropertyParseCache.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/PropertyParserAnimation.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/PropertyParserColour.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/PropertyParserKeyword.cpp
@@ -410,11 +425,13 @@ set(Debugger_HDR_FILES
     ${PROJECT_SOURCE_DIR}/Source/Debugger/ElementContextHook.h
     ${PROJECT_SOURCE_DIR}/Source/Debugger/ElementInfo.h
     ${PROJECT_SOURCE_DIR}/Source/Debugger/ElementLog.h
+    ${PROJECT_SOURCE_DIR}/Source/Debugger/ElementPerformance.h
     ${PROJECT_SOURCE_DIR}/Source/Debugger/FontSource.h
     ${PROJECT_SOURCE_DIR}/Source/Debugger/Geometry.h
     ${PROJECT_SOURCE_DIR}/Source/Debugger/InfoSource.h
     ${PROJECT_SOURCE_DIR}/Source/Debugger/LogSource.h
     ${PROJECT_SOURCE_DIR}/Source/Debugger/MenuSource.h
+    ${PROJECT_SOURCE_DIR}/Source/Debugger/PerformanceSource.h
     ${PROJECT_SOURCE_DIR}/Source/Debugger/Plugin.h
     ${PROJECT_SOURCE_DIR}/Source/Debugger/SystemInterface.h
 )
@@ -433,6 +450,7 @@ set(Debugger_SRC_FILES
     ${PROJECT_SOURCE_DIR}/Source/Debugger/ElementContextHook.cpp
     ${PROJECT_SOURCE_DIR}/Source/Debugger/ElementInfo.cpp
     ${PROJECT_SOURCE_DIR}/Source/Debugger/ElementLog.cpp
+    ${PROJECT_SOURCE_DIR}/Source/Debugger/ElementPerformance.cpp
     ${PROJECT_SOURCE_DIR}/Source/Debugger/Geometry.cpp
     ${PROJECT_SOURCE_DIR}/Source/Debugger/Plugin.cpp
     ${PROJECT_SOURCE_DIR}/Source/Debugger/SystemInterface.cpp
@@ -441,6 +459,7 @@ set(Debugger_SRC_FILES
 if(NOT NO_FONT_INTERFACE_DEFAULT)
     set(Core_HDR_FILES
         ${Core_HDR_FILES}
+        ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/BitmapFont.h
         ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FontEngineInterfaceDefault.h
         ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FontFace.h
         ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FontFaceHandleDefault.h
@@ -449,10 +468,15 @@ if(NOT NO_FONT_INTERFACE_DEFAULT)
         ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FontProvider.h
         ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FontTypes.h
         ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FreeTypeInterface.h
+        ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/GlyphCache.h
+        ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/GlyphRasterizer.h
+        ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/TextShaper.h
+        ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/TextShaperHarfBuzz.h
     )
 
     set(Core_SRC_FILES
         ${Core_SRC_FILES}
+        ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/BitmapFont.cpp
         ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FontEngineInterfaceDefault.cpp
         ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FontFace.cpp
         ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FontFaceHandleDefault.cpp
@@ -460,6 +484,10 @@ if(NOT NO_FONT_INTERFACE_DEFAULT)
         ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FontFamily.cpp
         ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FontProvider.cpp
         ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/FreeTypeInterface.cpp
+        ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/GlyphCache.cpp
+        ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/GlyphRasterizer.cpp
+        ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/TextShaper.cpp
+        ${PROJECT_SOURCE_DIR}/Source/Core/FontEngineDefault/TextShaperHarfBuzz.cpp
     )
 endif()
 
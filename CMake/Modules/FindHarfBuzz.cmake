@@ -0,0 +1,22 @@
+# - Try to find HarfBuzz
+# Once done, this will define
+#
+#  HARFBUZZ_FOUND - system has HarfBuzz
+#  HARFBUZZ_INCLUDE_DIR - the HarfBuzz include directory
+#  HARFBUZZ_LIBRARY - the HarfBuzz library
+
+set(HARFBUZZ_DIR "" CACHE PATH "Parent directory of HarfBuzz library")
+
+find_path(HARFBUZZ_INCLUDE_DIR hb.h PATHS ${HARFBUZZ_DIR} $ENV{HARFBUZZ_DIR} PATH_SUFFIXES include/harfbuzz harfbuzz)
+find_library(HARFBUZZ_LIBRARY NAMES harfbuzz libharfbuzz PATHS ${HARFBUZZ_DIR} $ENV{HARFBUZZ_DIR} PATH_SUFFIXES lib)
+
+set(HARFBUZZ_FOUND "NO")
+if(HARFBUZZ_INCLUDE_DIR AND HARFBUZZ_LIBRARY)
+	message(STATUS "Found HarfBuzz ${HARFBUZZ_LIBRARY}...")
+	mark_as_advanced(HARFBUZZ_DIR HARFBUZZ_INCLUDE_DIR HARFBUZZ_LIBRARY)
+	set(HARFBUZZ_FOUND "YES")
+elseif(HarfBuzz_FIND_REQUIRED)
+	 message(FATAL_ERROR "Required library HarfBuzz not found! Install the library and try again. If the library is already installed, set the missing variables manually in cmake.")
+else()
+	message(STATUS "Library HarfBuzz not found...")
+endif()
@@ -250,6 +250,13 @@ set(luainvaders_SRC_FILES
     ${PROJECT_SOURCE_DIR}/Samples/luainvaders/src/Sprite.cpp
 )
 
+set(luabenchmark_HDR_FILES
+)
+
+set(luabenchmark_SRC_FILES
+    ${PROJECT_SOURCE_DIR}/Samples/luabenchmark/src/main.cpp
+)
+
 # Deal with platform specific sources for sample shell
 if(WIN32)
        list(APPEND shell_SRC_FILES
@@ -61,6 +61,8 @@
 #include "Core/ID.h"
 #include "Core/Input.h"
 #include "Core/Log.h"
+#include "Core/MemoryInterface.h"
+#include "Core/MemoryStatistics.h"
 #include "Core/Plugin.h"
 #include "Core/PropertiesIteratorView.h"
 #include "Core/Property.h"
@@ -57,6 +57,15 @@ class RMLUICORE_API BaseXMLParser
 		/// interesting phenomena are encountered.
 		void Parse(Stream* stream);
 
+		/// Begins incremental parsing of the given stream. The body is then parsed in slices through calls to
+		/// ContinueParse(), the handlers being called as they would be by Parse().
+		/// @param[in] stream The stream to parse. It must stay valid until ContinueParse() reports completion.
+		void BeginParse(Stream* stream);
+		/// Continues an incremental parse started with BeginParse().
+		/// @param[in] time_limit The time in seconds after which parsing is suspended, checked between tags. At least one tag is always read. A negative limit parses the remaining stream in one go.
+		/// @return True if the parse has completed, false if there is more of the stream to parse.
+		bool ContinueParse(float time_limit);
+
 		/// Get the line number in the stream.
 		/// @return The line currently being processed in the XML stream.
 		int GetLineNumber() const;
@@ -76,7 +85,8 @@ class RMLUICORE_API BaseXMLParser
 
 	private:
 		void ReadHeader();
-		void ReadBody();
+		// Reads the body up to and including the next tag. Returns false once the end of the body is reached.
+		bool ReadBody();
 
 		bool ReadOpenTag();
 		bool ReadCloseTag();
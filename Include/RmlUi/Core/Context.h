@@ -39,12 +39,61 @@ namespace Rml {
 namespace Core {
 
 class Stream;
+class XMLParser;
 class ContextInstancer;
 class ElementDocument;
 class EventListener;
 class RenderInterface;
 enum class EventId : uint16_t;
 
+/**
+	Statistics on the work done by a context during a frame, for profiling and telemetry. A frame spans everything done
+	by the context since the end of the previous call to Render(), up to and including the next call to Render(). The
+	counters include work done on behalf of the context while updating, rendering, loading documents and processing input.
+ */
+struct ContextStatistics
+{
+	/// Number of elements updated.
+	int num_elements_updated = 0;
+	/// Number of element definitions resolved from style sheets.
+	int num_definitions_resolved = 0;
+	/// Number of properties computed.
+	int num_properties_computed = 0;
+	/// Number of layouts formatted, and the number of elements positioned by them.
+	int num_layouts_formatted = 0;
+	int num_elements_formatted = 0;
+	/// Number of backgrounds, borders, decorators, text and images that had their geometry regenerated.
+	int num_geometry_regenerated = 0;
+	/// Number of geometry draw calls submitted to the render interface.
+	int num_draw_calls = 0;
+	/// Number of elements skipped during rendering for being entirely outside their clipping region or the viewport.
+	int num_elements_culled = 0;
+	/// Number of textures uploaded to the render interface.
+	int num_texture_uploads = 0;
+	/// Number of glyphs rasterized by the font engine.
+	int num_glyphs_rasterized = 0;
+	/// Number of segments of text shaped by the font engine, cached segments are not counted.
+	int num_text_runs_shaped = 0;
+	/// Number of events dispatched.
+	int num_events_dispatched = 0;
+
+	/// Time spent in Update(), and in each of its phases, in seconds.
+	float update_time = 0;
+	float style_time = 0;
+	float layout_time = 0;
+	/// Time spent loading documents, both incrementally during Update() and in calls to LoadDocument(), in seconds.
+	float document_load_time = 0;
+	/// Time spent in Render(), in seconds.
+	float render_time = 0;
+	/// Time spent processing input events, in seconds.
+	float event_time = 0;
+
+	/// Elements positioned by layouts, and elements which regenerated any of their geometry. Only gathered when element
+	/// tracking is enabled, an element may appear multiple times.
+	std::vector< ObserverPtr<Element> > formatted_elements;
+	std::vector< ObserverPtr<Element> > regenerated_elements;
+};
+
 /**
 	A context for storing, rendering and processing RML documents. Multiple contexts can exist simultaneously.
 
@@ -85,6 +134,42 @@ public:
 	/// Renders all visible elements in the context's documents.
 	bool Render();
 
+	/// Enables or disables tracking of the regions of the context that changed since the last render. While enabled,
+	/// Render() only redraws the damaged regions, restricted by the scissor region, and submits nothing at all when no
+	/// region is damaged. The application must then preserve the contents of the render target between renders, such
+	/// as when rendering into a texture, and call MarkDamaged() whenever it is lost.
+	/// @param[in] enable True to enable damage tracking, false to redraw everything on every render.
+	void EnableDamageTracking(bool enable);
+	/// Returns true if damage tracking is enabled.
+	bool IsDamageTrackingEnabled() const;
+	/// Marks the whole context as damaged, so that everything is redrawn on the next render.
+	void MarkDamaged();
+	/// Marks a region of the context as damaged, so that it is redrawn on the next render.
+	/// @param[in] origin The top-left corner of the region.
+	/// @param[in] dimensions The size of the region.
+	void MarkDamaged(const Vector2i& origin, const Vector2i& dimensions);
+	/// Returns true if the next render will draw anything. This should be called after Update().
+	/// Always returns true when damage tracking is disabled.
+	bool HasDamage();
+	/// Returns the number of regions that will be redrawn on the next render. This should be called after Update().
+	int GetNumDamagedRegions();
+	/// Returns one of the regions that will be redrawn on the next render.
+	/// @param[in] index The index of the region.
+	/// @param[out] origin The top-left corner of the region.
+	/// @param[out] dimensions The size of the region.
+	/// @return True if the index was valid.
+	bool GetDamagedRegion(int index, Vector2i& origin, Vector2i& dimensions);
+
+	/// Enables or disables gathering of frame statistics. Statistics have close to no cost while disabled.
+	/// @param[in] enable True to gather statistics for every frame.
+	/// @param[in] track_elements True to also gather the elements formatted and regenerated during each frame.
+	void EnableStatistics(bool enable, bool track_elements = false);
+	/// Returns true if frame statistics are being gathered.
+	bool IsStatisticsEnabled() const;
+	/// Returns the statistics of the last frame, which ended with the most recent call to Render().
+	/// @return The frame statistics, or zeroed statistics if they were not enabled during the frame.
+	const ContextStatistics& GetStatistics() const;
+
 	/// Creates a new, empty document and places it into this context.
 	/// @param[in] tag The document type to create.
 	/// @return The new document, or nullptr if no document could be created.
@@ -101,6 +186,24 @@ public:
 	/// @param[in] string The string containing the document RML.
 	/// @return The loaded document, or nullptr if no document was loaded.
 	ElementDocument* LoadDocumentFromMemory(const String& string);
+	/// Load a document into the context incrementally. The document is placed hidden into the context, and then parsed
+	/// and styled in slices over the following calls to Update(), within the document load budget. A 'loadprogress' event
+	/// with the parameter 'progress' in [0, 1] is dispatched after each slice. Once parsed, the 'load' event is fired
+	/// and the document is laid out, after which it can be shown.
+	/// @param[in] document_path The path to the document to load.
+	/// @return The document being loaded, or nullptr if the document could not be opened.
+	ElementDocument* LoadDocumentIncremental(const String& document_path);
+	/// Load a document into the context incrementally, as above.
+	/// @param[in] string The string containing the document RML, it is copied before returning.
+	/// @return The document being loaded, or nullptr if no document could be instanced.
+	ElementDocument* LoadDocumentFromMemoryIncremental(const String& string);
+	/// Returns true if the given document is still being loaded incrementally.
+	bool IsDocumentLoading(ElementDocument* document) const;
+	/// Sets the time spent on incremental document loading during each update.
+	/// @param[in] seconds The time budget, in seconds. At least one tag is parsed each update regardless.
+	void SetDocumentLoadBudget(float seconds);
+	/// Returns the time spent on incremental document loading during each update, in seconds.
+	float GetDocumentLoadBudget() const;
 	/// Unload the given document.
 	/// @param[in] document The document to unload.
 	void UnloadDocument(ElementDocument* document);
@@ -213,6 +316,11 @@ public:
 	/// @param[out] origin The clipping origin
 	/// @param[out] dimensions The clipping dimensions
 	void SetActiveClipRegion(const Vector2i& origin, const Vector2i& dimensions);
+	/// Gets the damaged region currently being redrawn by the render traversal, all clipping regions are restricted to it.
+	/// @param[out] origin The region origin
+	/// @param[out] dimensions The region dimensions
+	/// @return False if the whole context is being rendered.
+	bool GetRedrawRegion(Vector2i& origin, Vector2i& dimensions) const;
 
 	/// Sets the instancer to use for releasing this object.
 	/// @param[in] instancer The context's instancer.
@@ -240,6 +348,22 @@ private:
 	// Documents that have been unloaded from the context but not yet released.
 	OwnedElementList unloaded_documents;
 
+	struct DocumentLoad {
+		ElementDocument* document;
+		UniquePtr<Stream> stream;
+		UniquePtr<XMLParser> parser;
+		bool cancelled = false;
+	};
+	using DocumentLoadList = std::vector< UniquePtr<DocumentLoad> >;
+
+	// Documents being loaded incrementally, in the order they were requested. The loads are kept in stable storage, as
+	// parsing may run scripts which begin or cancel other loads.
+	DocumentLoadList document_loads;
+	float document_load_budget;
+
+	// The load currently being parsed, it is only marked as cancelled if its document is unloaded in the meantime.
+	DocumentLoad* active_document_load;
+
 	// Root of the element tree.
 	ElementPtr root;
 	// The element that current has input focus.
@@ -286,6 +410,38 @@ private:
 	Vector2i clip_origin;
 	Vector2i clip_dimensions;
 
+	struct DamagedRegion {
+		Vector2i top_left;
+		Vector2i bottom_right;
+	};
+	using DamagedRegionList = std::vector< DamagedRegion >;
+
+	// Returns the number of contexts with damage tracking enabled, elements skip looking up their context when none are.
+	static int GetNumDamageTrackingContexts();
+
+	// Regions changed since the last render, only tracked when damage tracking is enabled.
+	bool damage_tracking_enabled;
+	bool damage_all;
+	DamagedRegionList damaged_regions;
+	// The region currently being redrawn, or empty when rendering everything.
+	DamagedRegion redraw_region;
+
+	// Statistics of the frame in progress, and of the last completed frame.
+	bool statistics_enabled;
+	bool statistics_track_elements;
+	ContextStatistics frame_statistics;
+	ContextStatistics last_frame_statistics;
+
+	// Renders the documents and the cursor proxy.
+	bool RenderDocuments();
+
+	// Begins loading a document incrementally from the given stream.
+	ElementDocument* BeginLoadDocument(UniquePtr<Stream> stream);
+	// Continues parsing the incrementally loaded documents within the load budget.
+	void UpdateDocumentLoads();
+	// Dispatches the load notifications for a fully instanced document placed in the context, and updates it.
+	void FinishLoadDocument(ElementDocument* document);
+
 	// Internal callback for when an element is detached or removed from the hierarchy.
 	void OnElementDetach(Element* element);
 	// Internal callback for when a new element gains focus.
@@ -316,10 +472,14 @@ private:
 	// Releases all unloaded documents pending destruction.
 	void ReleaseUnloadedDocuments();
 
+	// Adds the areas of all elements marked as damaged to the damaged regions.
+	void CollectDamage();
+
 	// Sends the specified event to all elements in new_items that don't appear in old_items.
 	static void SendEvents(const ElementSet& old_items, const ElementSet& new_items, EventId id, const Dictionary& parameters);
 
 	friend class Element;
+	friend class ContextStatisticsScope;
 	friend RMLUICORE_API Context* CreateContext(const String&, const Vector2i&, RenderInterface*);
 };
 
@@ -41,6 +41,7 @@ class Plugin;
 class Context;
 class FileInterface;
 class FontEngineInterface;
+class MemoryInterface;
 class RenderInterface;
 class SystemInterface;
 enum class DefaultActionPhase;
@@ -92,6 +93,31 @@ RMLUICORE_API FileInterface* GetFileInterface();
 RMLUICORE_API void SetFontEngineInterface(FontEngineInterface* font_interface);
 /// Returns RmlUi's font interface.
 RMLUICORE_API FontEngineInterface* GetFontEngineInterface();
+
+/// Sets the interface through which memory for pools, geometry pages, layout scratch memory and font data is
+/// allocated. This is not required to be called, but if it is it must be called before Initialise().
+/// @param[in] memory_interface A non-owning pointer to the application-specified memory interface, or nullptr to use the default.
+/// @lifetime The interface must be kept alive until after the call to Core::Shutdown.
+RMLUICORE_API void SetMemoryInterface(MemoryInterface* memory_interface);
+/// Returns RmlUi's memory interface.
+RMLUICORE_API MemoryInterface* GetMemoryInterface();
+
+/// Enables rasterization of new glyphs on a background thread in the default font engine. Text containing glyphs that
+/// are not yet available is laid out with placeholders, and formatted and generated again once they arrive. This is not
+/// required to be called, but if it is it must be called before Initialise(). It has no effect on custom font engines.
+/// @param[in] enable True to rasterize glyphs in the background, false to rasterize them when first used.
+RMLUICORE_API void EnableAsyncGlyphRasterization(bool enable);
+/// Returns true if glyphs are rasterized on a background thread.
+RMLUICORE_API bool IsAsyncGlyphRasterizationEnabled();
+/// Sets the directory in which the default font engine stores rasterized glyphs and font effect images between runs.
+/// Cache files are named after a hash of the font data, the size and the font effect, and are mapped into memory
+/// through the file interface when the same font face is used at the same size again. The directory must exist, the
+/// font engine does not create it. This is not required to be called, but if it is it must be called before
+/// Initialise(). It has no effect on custom font engines.
+/// @param[in] directory The directory of the glyph cache, or an empty string to disable the cache.
+RMLUICORE_API void SetGlyphCacheDirectory(const String& directory);
+/// Returns the directory of the glyph cache, or an empty string if it is disabled.
+RMLUICORE_API const String& GetGlyphCacheDirectory();
 	
 /// Creates a new element context.
 /// @param[in] name The new name of the context. This must be unique.
@@ -117,6 +143,8 @@ RMLUICORE_API Context* GetContext(int index);
 RMLUICORE_API int GetNumContexts();
 
 /// Adds a new font face to the font engine. The face's family, style and weight will be determined from the face itself.
+/// The default font engine loads files with the '.fnt' extension as pre-rendered bitmap fonts in the BMFont text or
+/// XML format, which are rendered from their atlas textures at their own size, and cannot be used as fallback faces.
 /// @param[in] file_name The file to load the face from.
 /// @param[in] fallback_face True to use this font face for unknown characters in other font faces.
 /// @return True if the face was loaded successfully, false otherwise.
@@ -130,6 +158,16 @@ RMLUICORE_API bool LoadFontFace(const String& file_name, bool fallback_face = fa
 /// @param[in] fallback_face True to use this font face for unknown characters in other font faces.
 /// @return True if the face was loaded successfully, false otherwise.
 RMLUICORE_API bool LoadFontFace(const byte* data, int data_size, const String& font_family, Style::FontStyle style, Style::FontWeight weight, bool fallback_face = false);
+/// Prepares a font face for use ahead of time, such as during a loading screen, so that the first document using it
+/// does not have to rasterize its glyphs and generate its font effect textures.
+/// @param[in] family The family of the font face.
+/// @param[in] style The style of the font face.
+/// @param[in] weight The weight of the font face.
+/// @param[in] size The size of the font face, in points.
+/// @param[in] font_effects The font effects to prepare, declared as the 'font-effect' property, e.g. "outline(1px black)".
+/// @param[in] characters The characters to rasterize in addition to the ones the font engine prepares by default, in UTF-8.
+/// @return True if the font face was found, false otherwise.
+RMLUICORE_API bool PrewarmFontFace(const String& family, Style::FontStyle style, Style::FontWeight weight, int size, const String& font_effects = String(), const String& characters = String());
 
 /// Registers a generic RmlUi plugin.
 RMLUICORE_API void RegisterPlugin(Plugin* plugin);
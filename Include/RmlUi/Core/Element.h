@@ -62,6 +62,7 @@ class RenderInterface;
 class TransformState;
 class StyleSheet;
 struct ElementMeta;
+struct ElementColdData;
 
 /**
 	A generic element in the DOM tree.
@@ -538,10 +539,10 @@ public:
 	/// Returns event types with number of listeners for debugging.
 	/// @return Summary of attached listeners.
 	String GetEventDispatcherSummary() const;
-	/// Access the element background.
+	/// Access the element background. The background is created on first access.
 	/// @return The element's background.
 	ElementBackground* GetElementBackground() const;
-	/// Access the element border.
+	/// Access the element border. The border is created on first access.
 	/// @return The element's boder.
 	ElementBorder* GetElementBorder() const;
 	/// Access the element decorators.
@@ -561,6 +562,19 @@ public:
 	/// @return The element's context's render interface.
 	RenderInterface* GetRenderInterface();
 
+	/// Marks the area covered by the element as changed, so that it is redrawn on the next render when damage tracking
+	/// is enabled on its context. This is done automatically for all changes known to RmlUi, custom elements whose
+	/// rendered output changes by other means should call this themselves.
+	void MarkDamaged();
+
+	/// Requests that the element is updated on the next context update, calling OnUpdate() among other things. Only
+	/// elements with changes known to RmlUi are updated, custom elements whose OnUpdate() depends on other state should
+	/// call this when that state changes.
+	void RequestUpdate();
+	/// Enables updating the element on every context update, for elements which need OnUpdate() to be called every frame.
+	/// @param[in] update_every_frame True to update the element every frame, false to only update it when requested.
+	void SetUpdateEveryFrame(bool update_every_frame);
+
 	/// Sets the instancer to use for releasing this element.
 	/// @param[in] instancer Instancer to set on this element.
 	void SetInstancer(ElementInstancer* instancer);
@@ -583,7 +597,8 @@ protected:
 	/// Forces the element to generate a local stacking context, regardless of the value of its z-index property.
 	void ForceLocalStackingContext();
 
-	/// Called during the update loop after children are updated.
+	/// Called during the update loop before children are updated. Only called when the element is updated, see
+	/// RequestUpdate() and SetUpdateEveryFrame().
 	virtual void OnUpdate();
 	/// Called during render after backgrounds, borders, decorators, but before children, are rendered.
 	virtual void OnRender();
@@ -623,19 +638,41 @@ protected:
 private:
 	void SetParent(Element* parent);
 
+	void RenderStackingContext();
+	/// Renders the element at the given index of the local stacking context, unless it is culled together with its
+	/// descendants for being entirely outside the culling region. Returns the index of the next element to render.
+	size_t RenderStackingContextElement(size_t index, bool culling, const Vector2f& cull_min, const Vector2f& cull_max);
+	/// Regenerates the culling bounds of the elements in the local stacking context if any of them may have changed.
+	void UpdateStackingContextCullData();
+
+	/// Returns the cold data of the element, allocating it if necessary.
+	ElementColdData& GetColdData();
+	/// Returns the elements in the local stacking context of this element, in rendering order.
+	const ElementList& GetLocalStackingContext() const;
+
 	void DirtyOffset();
 	void UpdateOffset();
 
+	/// Invalidates the cached clipping regions of all elements.
+	static void DirtyClippingRegions();
+
 	void BuildLocalStackingContext();
 	void BuildStackingContext(ElementList* stacking_context);
 	void DirtyStackingContext();
 
 	void DirtyStructure();
+
+	void DirtyBackgroundAndBorder();
 	void UpdateStructure();
 
-	void DirtyTransformState(bool perspective_dirty, bool transform_dirty);
+	void DirtyTransformState(bool perspective_dirty, bool transform_dirty, bool parent_transform_dirty = false);
 	void UpdateTransformState();
 
+	void MarkSubtreeDamaged();
+	void AddDamagedArea(Context* context);
+	void CollectDamage(Context* context);
+	void ClearLayerDamagePending();
+
 	/// Start an animation, replacing any existing animations of the same property name. If start_value is null, the element's current value is used.
 	ElementAnimationList::iterator StartAnimation(PropertyId property_id, const Property * start_value, int num_iterations, bool alternate_direction, float delay, bool initiated_by_animation_property);
 
@@ -656,41 +693,22 @@ private:
 	/// Advances the animations (including transitions) forward in time.
 	void AdvanceAnimations();
 
-	// Original tag this element came from.
-	String tag;
-
-	// The optional, unique ID of this object.
-	String id;
-
-	// Instancer that created us, used for destruction.
-	ElementInstancer* instancer;
+	// Members are ordered with the state visited during update and render traversal first, and flags packed together.
 
 	// Parent element.
 	Element* parent;
-	// Currently focused child object
-	Element* focus;
 	// The owning document
 	ElementDocument* owner_document;
 
-	// Attributes on this element.
-	ElementAttributes attributes;
-
-	// The offset of the element, and the element it is offset from.
-	Element* offset_parent;
-	Vector2f relative_offset_base;		// the base offset from the parent
-	Vector2f relative_offset_position;	// the offset of a relatively positioned element
-	bool offset_fixed;
+	ElementMeta* meta;
 
-	mutable Vector2f absolute_offset;
-	mutable bool offset_dirty;
+	OwnedElementList children;
+	int num_non_dom_children;
 
-	// The offset this element adds to its logical children due to scrolling content.
-	Vector2f scroll_offset;
+	float z_index;
 
 	// The size of the element.
-	using BoxList = std::vector< Box >;
 	Box main_box;
-	BoxList additional_boxes;
 
 	// And of the element's internal content.
 	Vector2f content_offset;
@@ -699,38 +717,82 @@ private:
 	// Defines what box area represents the element's client area; this is usually padding, but may be content.
 	Box::Area client_area;
 
+	// Cached rendering information
+	int clipping_ignore_depth;
+
+	// The cached clipping region of the element, valid while the generation matches the global clipping generation.
+	Vector2i clip_origin;
+	Vector2i clip_dimensions;
+	unsigned int clip_generation;
+	static unsigned int clipping_generation;
+
+	// The offset of the element, and the element it is offset from.
+	Element* offset_parent;
+	Vector2f relative_offset_base;		// the base offset from the parent
+	Vector2f relative_offset_position;	// the offset of a relatively positioned element
+	mutable Vector2f absolute_offset;
+
+	// The offset this element adds to its logical children due to scrolling content.
+	Vector2f scroll_offset;
+
 	// True if the element is visible and active.
 	bool visible;
 
-	OwnedElementList children;
-	int num_non_dom_children;
+	bool offset_fixed;
+	mutable bool offset_dirty;
 
-	float z_index;
 	bool local_stacking_context;
 	bool local_stacking_context_forced;
-
-	ElementList stacking_context;
 	bool stacking_context_dirty;
 
 	bool structure_dirty;
 
 	bool computed_values_are_default_initialized;
 
-	// Cached rendering information
-	int clipping_ignore_depth;
 	bool clipping_enabled;
 	bool clipping_state_dirty;
+	bool clip_region_valid;
+
+	// Damage tracking, set when the element or any of its descendants need to add their area to the context's damaged regions.
+	bool damage_pending;
+	bool child_damage_pending;
+
+	// Set when the layers containing the element have been dirtied since they were last captured. The flag is also set on
+	// all ancestors, so that dirtying layers can stop at the first flagged ancestor.
+	bool layer_damage_pending;
+
+	// Set when the element or any of its descendants need to be visited during the next update.
+	bool update_pending;
+	bool child_update_pending;
+	bool update_every_frame;
 
-	// Transform state
-	UniquePtr< TransformState > transform_state;
 	bool dirty_transform;
+	bool dirty_parent_transform;
 	bool dirty_perspective;
 
-	ElementAnimationList animations;
 	bool dirty_animation;
 	bool dirty_transition;
 
-	ElementMeta* meta;
+	// Transform state
+	UniquePtr< TransformState > transform_state;
+
+	// State only used by some elements, such as animations, additional boxes and the local stacking context. Allocated on first use.
+	ElementColdData* cold_data;
+
+	// Currently focused child object
+	Element* focus;
+
+	// Instancer that created us, used for destruction.
+	ElementInstancer* instancer;
+
+	// Original tag this element came from.
+	String tag;
+
+	// The optional, unique ID of this object.
+	String id;
+
+	// Attributes on this element.
+	ElementAttributes attributes;
 
 	friend class Context;
 	friend class ElementStyle;
@@ -738,6 +800,8 @@ private:
 	friend class LayoutInlineBox;
 	friend struct ElementDeleter;
 	friend class ElementScroll;
+	friend class ElementLayer;
+	friend class ElementUtilities;
 };
 
 }
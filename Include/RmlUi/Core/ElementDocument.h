@@ -55,6 +55,21 @@ class StyleSheet;
 enum class ModalFlag { None, Modal, Keep };
 enum class FocusFlag { None, Document, Keep, Auto };
 
+/**
+	Time spent on a single document during a frame of its context, in seconds. Events are attributed to the document of
+	their target element.
+ */
+struct DocumentStatistics
+{
+	float style_time = 0;
+	float layout_time = 0;
+	float render_time = 0;
+	float event_time = 0;
+
+	/// Number of elements in the document at the end of the frame, including the document itself.
+	int num_elements = 0;
+};
+
 
 /**
 	Represents a document in the dom tree.
@@ -124,6 +139,10 @@ public:
 	/// size or position of an element if any element in the document was recently changed, unless Context::Update has
 	/// already been called after the change. This has a perfomance penalty, only call when necessary.
 	void UpdateDocument();
+
+	/// Returns the time spent on this document during the last frame of its context. Only gathered while statistics are
+	/// enabled on the context, see Context::EnableStatistics().
+	const DocumentStatistics& GetStatistics() const;
 	
 protected:
 	/// Repositions the document if necessary.
@@ -176,8 +195,17 @@ private:
 
 	bool position_dirty;
 
+	// Statistics of the frame in progress, and of the last completed frame.
+	DocumentStatistics frame_statistics;
+	DocumentStatistics last_frame_statistics;
+
+	// Number of elements owned by the document, kept up to date as elements are attached and detached.
+	int num_elements;
+
+	friend class Element;
 	friend class Context;
 	friend class Factory;
+	friend class DocumentStatisticsScope;
 
 };
 
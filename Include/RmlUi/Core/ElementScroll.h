@@ -56,7 +56,8 @@ public:
 	~ElementScroll();
 
 	/// Updates the increment / decrement arrows.
-	void Update();
+	/// @return True if an arrow is held down, in which case the element needs to be updated again on the next update.
+	bool Update();
 
 	/// Enables and sizes one of the scrollbars.
 	/// @param[in] orientation Which scrollbar (vertical or horizontal) to enable.
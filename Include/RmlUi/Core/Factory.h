@@ -113,6 +113,10 @@ public:
 	/// @param[in] stream The stream to instance from.
 	/// @return The instanced document, or nullptr if an error occurred.
 	static ElementPtr InstanceDocumentStream(Rml::Core::Context* context, Stream* stream);
+	/// Instances an empty document, ready to be filled by parsing a stream.
+	/// @param[in] context The context that is creating the document.
+	/// @return The instanced document, or nullptr if an error occurred.
+	static ElementPtr InstanceDocument(Rml::Core::Context* context);
 
 	/// Registers a non-owning pointer to an instancer that will be used to instance decorators.
 	/// @param[in] name The name of the decorator the instancer will be called for.
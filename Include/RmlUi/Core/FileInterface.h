@@ -82,6 +82,18 @@ public:
 	/// @param file The handle of the file to be queried.
 	/// @return The length of the file in bytes.
 	virtual size_t Length(FileHandle file);
+
+	/// Maps a file into memory, so that its contents are only paged in as they are accessed. This is used for large
+	/// files such as fonts, and is optional: the default implementation returns nullptr, in which case the file is read
+	/// into memory through the functions above instead. The mapped memory may be read from any thread.
+	/// @param path The path of the file to map.
+	/// @param length The length of the mapped file in bytes.
+	/// @return A pointer to the read-only contents of the file, or nullptr if the file could not be mapped.
+	virtual const byte* Map(const String& path, size_t& length);
+	/// Unmaps a file previously mapped through Map().
+	/// @param data The pointer returned by Map().
+	/// @param length The length of the mapped file in bytes.
+	virtual void Unmap(const byte* data, size_t length);
 };
 
 }
@@ -36,6 +36,26 @@
 namespace Rml {
 namespace Core {
 
+class RenderInterface;
+
+/**
+	Information on a font face handle in use by the font engine, for debugging and profiling.
+ */
+struct FontFaceStatistics
+{
+	String family;
+	Style::FontStyle style = Style::FontStyle::Normal;
+	Style::FontWeight weight = Style::FontWeight::Normal;
+	int size = 0;
+	/// Number of glyphs, and number of layers generated for font effects including the base layer.
+	int num_glyphs = 0;
+	int num_layers = 0;
+	/// Number of glyph atlas textures, their total area in pixels, and the area occupied by glyphs.
+	int num_textures = 0;
+	int texture_area = 0;
+	int used_texture_area = 0;
+};
+
 
 /**
 	The abstract base class for an application-specific font engine implementation.
@@ -129,6 +149,26 @@ public:
 	/// @param[in] face_handle The font handle.
 	/// @return The version required for using any geometry generated with the face handle.
 	virtual int GetVersion(FontFaceHandle handle);
+
+	/// Called by RmlUi after formatting or generating text, to determine if any of its glyphs were measured or rendered
+	/// with placeholders, such as while they are being rasterized in the background. If so, the text is formatted and
+	/// generated again once the version of the face handle changes.
+	/// @param[in] face_handle The font handle.
+	/// @return True if any glyphs requested from the face handle are not yet available.
+	virtual bool HasPendingGlyphs(FontFaceHandle handle);
+
+	/// Called by RmlUi when the application prepares a font face ahead of use, see PrewarmFontFace(). The font engine
+	/// should do any work it would otherwise do when the given characters are first rendered with the given effects.
+	/// The base implementation does nothing.
+	/// @param[in] face_handle The font handle.
+	/// @param[in] font_effects_handle The handle to the prepared font effects, or zero for none.
+	/// @param[in] characters The characters to prepare, in UTF-8.
+	/// @param[in] render_interface The render interface to generate textures with, or nullptr to skip generating them.
+	virtual void PrewarmGlyphs(FontFaceHandle handle, FontEffectsHandle font_effects_handle, const String& characters, RenderInterface* render_interface);
+
+	/// Called by the debugger to retrieve information on all font face handles in use. The base implementation adds nothing.
+	/// @param[out] statistics The list to append the information of each handle to.
+	virtual void GetFontFaceStatistics(std::vector<FontFaceStatistics>& statistics);
 };
 
 }
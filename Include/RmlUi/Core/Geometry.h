@@ -41,6 +41,31 @@ class Element;
 class RenderInterface;
 struct Texture;
 using GeometryDatabaseHandle = uint32_t;
+using GeometryArenaHandle = uint32_t;
+
+/**
+	Statistics on the geometry in use, and on how it is submitted to the render interface. The counters of calls and
+	uploads accumulate over the lifetime of the library.
+ */
+struct GeometryStatistics
+{
+	/// Number of live geometry objects.
+	int num_geometry = 0;
+	/// Number of geometry objects stored in shared geometry pages.
+	int num_paged_geometry = 0;
+	/// Number of geometry pages, and the memory they reserve in bytes.
+	int num_pages = 0;
+	size_t page_memory = 0;
+	/// Number of geometry page uploads, and the number of bytes uploaded.
+	size_t num_page_uploads = 0;
+	size_t page_upload_bytes = 0;
+	/// Number of geometry compilations.
+	size_t num_compile_calls = 0;
+	/// Number of draw calls, by the kind of geometry rendered.
+	size_t num_immediate_render_calls = 0;
+	size_t num_compiled_render_calls = 0;
+	size_t num_paged_render_calls = 0;
+};
 
 /**
 	A helper object for holding an array of vertices and indices, and compiling it as necessary when rendered.
@@ -87,6 +112,9 @@ public:
 	/// @param[in] clear_buffers True to also clear the vertex and index buffers, false to leave intact.
 	void Release(bool clear_buffers = false);
 
+	/// Returns statistics on all geometry in use.
+	static GeometryStatistics GetStatistics();
+
 private:
 	// Move members from another geometry.
 	void MoveFrom(Geometry& other);
@@ -102,6 +130,7 @@ private:
 	const Texture* texture = nullptr;
 
 	CompiledGeometryHandle compiled_geometry = 0;
+	GeometryArenaHandle arena_handle = 0;
 	bool compile_attempted = false;
 
 	GeometryDatabaseHandle database_handle;
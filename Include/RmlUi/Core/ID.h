@@ -144,6 +144,7 @@ enum class PropertyId : uint8_t
 	Opacity,
 	PointerEvents,
 	Focus,
+	RenderCache,
 
 	Decorator,
 	FontEffect,
@@ -192,6 +193,7 @@ enum class EventId : uint16_t
 	Scroll,
 	Animationend,
 	Transitionend,
+	Loadprogress,
 
 	// Controls events
 	Change,
@@ -47,6 +47,14 @@ void LuaType<T>::Register(lua_State* L)
     luaL_newmetatable(L, "DO NOT TRASH"); //[3] = metatable named "DO NOT TRASH"
     lua_pop(L,1); //remove the above metatable -> [-1 = 2]
 
+    //cache of the userdata pushed for each object, weak-valued so it does not keep the userdata alive
+    lua_newtable(L); //[3] = cache table
+    lua_newtable(L); //[4] = metatable of the cache table
+    lua_pushstring(L, "v");
+    lua_setfield(L, -2, "__mode"); //[4].__mode = "v"
+    lua_setmetatable(L, -2); //pop [4], metatable of [3] is [4]
+    lua_setfield(L, metatable, "__cache"); //[metatable = 2].__cache = [3]; pop [3]
+
     //store method table in globals so that scripts can add functions written in Lua
     lua_pushvalue(L, methods); //[methods = 1] -> [3] = copy (reference) of methods table
     lua_setglobal(L, GetTClassName<T>()); // -> <ClassName> = [3 = 1], pop top [3]
@@ -86,40 +94,32 @@ int LuaType<T>::push(lua_State *L, T* obj, bool gc)
     luaL_getmetatable(L, GetTClassName<T>());  // lookup metatable in Lua registry ->[1] = metatable of <ClassName>
     if (lua_isnil(L, -1)) luaL_error(L, "%s missing metatable", GetTClassName<T>());
     int mt = lua_gettop(L); //mt = 1
-    T** ptrHold = (T**)lua_newuserdata(L,sizeof(T**)); //->[2] = empty userdata
-    int ud = lua_gettop(L); //ud = 2
-    if(ptrHold != nullptr)
+    lua_getfield(L, mt, "__cache"); //->[2] = cache of userdata keyed by object address
+    int cache = lua_gettop(L); //cache = 2
+    lua_pushlightuserdata(L, obj); // ->[3] = key
+    lua_rawget(L, cache); //pop [3] -> [3] = userdata previously pushed for obj, or nil
+    if(lua_isnil(L,-1))
     {
-        *ptrHold = obj; 
-        lua_pushvalue(L, mt); // ->[3] = copy of [1]
-        lua_setmetatable(L, -2); //[-2 = 2] -> [2]'s metatable = [3]; pop [3]
-        char name[max_pointer_string_size];
-        tostring(name, max_pointer_string_size, obj);
-        lua_getfield(L,LUA_REGISTRYINDEX,"DO NOT TRASH"); //->[3] = value returned from function
-        if(lua_isnil(L,-1) ) //if [3] hasn't been created yet, then create it
-        {
-            luaL_newmetatable(L,"DO NOT TRASH"); //[4] = the new metatable
-            lua_pop(L,1); //pop [4]
-        }
+        //not pushed before, or its userdata has been collected since, so make a new one
         lua_pop(L,1); //pop [3]
-        lua_getfield(L,LUA_REGISTRYINDEX,"DO NOT TRASH"); //->[3] = value returned from function
-        if(gc == false) //if we shouldn't garbage collect it, then put the name in to [3]
-        {
-            lua_pushboolean(L,1);// ->[4] = true
-            lua_setfield(L,-2,name); //represents t[k] = v, [-2 = 3] = t -> v = [4], k = <ClassName>; pop [4]
-        }
-        else
-        {
-            //In case this is an address that has been pushed
-            //to lua before, we need to set it to nil
-            lua_pushnil(L); // ->[4] = nil
-            lua_setfield(L,-2,name); //represents t[k] = v, [-2 = 3] = t -> v = [4], k = <ClassName>; pop [4]
-        }
-
-        lua_pop(L,1); // -> pop [3]
+        T** ptrHold = (T**)lua_newuserdata(L,sizeof(T**)); //->[3] = empty userdata
+        *ptrHold = obj;
+        lua_pushvalue(L, mt); // ->[4] = copy of [1]
+        lua_setmetatable(L, -2); //[-2 = 3] -> [3]'s metatable = [4]; pop [4]
+        lua_pushlightuserdata(L, obj); // ->[4] = key
+        lua_pushvalue(L, -2); // ->[5] = copy of [3]
+        lua_rawset(L, cache); //cache[obj] = userdata; pop [4] and [5]
     }
-    lua_settop(L,ud); //[ud = 2] -> remove everything that is above 2, top = [2]
-    lua_replace(L, mt); //[mt = 1] -> move [2] to pos [1], and pop previous [1]
+    int ud = lua_gettop(L); //ud = 3
+    lua_getfield(L,LUA_REGISTRYINDEX,"DO NOT TRASH"); //->[4] = table created in Register
+    lua_pushlightuserdata(L, obj); // ->[5] = key
+    if(gc == false) //if we shouldn't garbage collect it, then mark it in [4]
+        lua_pushboolean(L,1);// ->[6] = true
+    else
+        lua_pushnil(L); //In case this is an address that has been pushed to lua before, we need to set it to nil
+    lua_rawset(L,-3); //represents t[k] = v, [-3 = 4] = t; pop [5] and [6]
+    lua_settop(L,ud); //[ud = 3] -> remove everything that is above 3, top = [3]
+    lua_replace(L, mt); //[mt = 1] -> move [3] to pos [1], and pop previous [1]
     lua_settop(L, mt); //remove everything above [1]
     return mt;  // index of userdata containing pointer to T object
 }
@@ -175,9 +175,8 @@ int LuaType<T>::gc_T(lua_State* L)
     lua_getfield(L,LUA_REGISTRYINDEX,"DO NOT TRASH"); //->[2] = return value from this
     if(lua_istable(L,-1) ) //[-1 = 2], if it is a table
     {
-        char name[max_pointer_string_size];
-        tostring(name, max_pointer_string_size, obj);
-        lua_getfield(L,-1,name); //[-1 = 2] -> [3] = the value returned from if <ClassName> exists in the table to not gc
+        lua_pushlightuserdata(L, obj); //->[3] = key
+        lua_rawget(L,-2); //[-2 = 2] -> [3] = the value returned from if the object exists in the table to not gc
         if(lua_isnoneornil(L,-1) ) //[-1 = 3] if it doesn't exist, then we are free to garbage collect c++ side
 		{
 			delete obj;
@@ -195,7 +194,7 @@ int LuaType<T>::tostring_T(lua_State* L)
     char buff[max_pointer_string_size];
     T** ptrHold = (T**)lua_touserdata(L,1);
     void* obj = static_cast<void*>(*ptrHold);
-    snprintf(buff, max_pointer_string_size, "%p", obj);
+    tostring(buff, max_pointer_string_size, obj);
     lua_pushfstring(L, "%s (%s)", GetTClassName<T>(), buff);
     return 1;
 }
@@ -33,6 +33,16 @@
 #include "Math.h"
 #include "Vector4.h"
 
+#if !defined(RMLUI_NO_SIMD)
+	#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define RMLUI_MATRIX4_SSE
+		#include <emmintrin.h>
+	#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+		#define RMLUI_MATRIX4_NEON
+		#include <arm_neon.h>
+	#endif
+#endif
+
 namespace Rml {
 namespace Core {
 
@@ -225,6 +235,32 @@ struct ColumnMajorStorage
 		typedef typename MatrixStorageBase< Component >::ConstStrideAccess ConstRows;
 };
 
+/**
+	Operations on the raw components of 4x4 matrices. The generic implementations are used for any component type,
+	while the overloads for single-precision components are vectorized with SSE2 or NEON instructions where available,
+	unless RMLUI_NO_SIMD is defined. It is set by the NO_SIMD CMake option, and must be the same for the library and its
+	users.
+ */
+namespace Matrix4Operations
+{
+	/// Multiplies a column-major matrix by a number of column vectors, such as the columns of another column-major matrix.
+	/// @param[in] lhs The 16 components of the column-major matrix.
+	/// @param[in] rhs The components of the column vectors, four per vector.
+	/// @param[out] result The components of the resulting column vectors, which must not overlap the inputs.
+	/// @param[in] num_columns The number of column vectors.
+	template< typename Component >
+	void MultiplyColumns(const Component* lhs, const Component* rhs, Component* result, int num_columns) noexcept;
+	inline void MultiplyColumns(const float* lhs, const float* rhs, float* result, int num_columns) noexcept;
+
+	/// Inverts a matrix in place, if possible. The storage order of the matrix does not matter, as the inverse of the
+	/// transpose is the transpose of the inverse.
+	/// @param[in-out] components The 16 components of the matrix.
+	/// @return True if the inversion succeeded.
+	template< typename Component >
+	bool Invert(Component* components) noexcept;
+	inline bool Invert(float* components) noexcept;
+}
+
 /**
 	Templated class for a generic 4x4 matrix.
 	@author Markus Schöngart
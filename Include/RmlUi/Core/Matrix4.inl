@@ -29,6 +29,301 @@
 namespace Rml {
 namespace Core {
 
+// Multiplies a column-major matrix by a number of column vectors.
+template< typename Component >
+void Matrix4Operations::MultiplyColumns(const Component* lhs, const Component* rhs, Component* result, int num_columns) noexcept
+{
+	for (int j = 0; j < num_columns; ++j)
+	{
+		// Read the whole column before writing, so the compiler need not assume the output aliases the inputs.
+		const Component x = rhs[j * 4], y = rhs[j * 4 + 1], z = rhs[j * 4 + 2], w = rhs[j * 4 + 3];
+		Component sum[4];
+		for (int i = 0; i < 4; ++i)
+			sum[i] = x * lhs[i] + y * lhs[4 + i] + z * lhs[8 + i] + w * lhs[12 + i];
+		for (int i = 0; i < 4; ++i)
+			result[j * 4 + i] = sum[i];
+	}
+}
+
+// Inverts a matrix in place.
+// This is from the MESA implementation of the GLU library.
+template< typename Component >
+bool Matrix4Operations::Invert(Component* components) noexcept
+{
+	Component dst[16];
+	const Component *src = components;
+
+	dst[0] = src[5]  * src[10] * src[15] -
+		src[5]  * src[11] * src[14] -
+		src[9]  * src[6]  * src[15] +
+		src[9]  * src[7]  * src[14] +
+		src[13] * src[6]  * src[11] -
+		src[13] * src[7]  * src[10];
+
+	dst[4] = -src[4]  * src[10] * src[15] +
+		src[4]  * src[11] * src[14] +
+		src[8]  * src[6]  * src[15] -
+		src[8]  * src[7]  * src[14] -
+		src[12] * src[6]  * src[11] +
+		src[12] * src[7]  * src[10];
+
+	dst[8] = src[4]  * src[9] * src[15] -
+		src[4]  * src[11] * src[13] -
+		src[8]  * src[5] * src[15] +
+		src[8]  * src[7] * src[13] +
+		src[12] * src[5] * src[11] -
+		src[12] * src[7] * src[9];
+
+	dst[12] = -src[4]  * src[9] * src[14] +
+		src[4]  * src[10] * src[13] +
+		src[8]  * src[5] * src[14] -
+		src[8]  * src[6] * src[13] -
+		src[12] * src[5] * src[10] +
+		src[12] * src[6] * src[9];
+
+	dst[1] = -src[1]  * src[10] * src[15] +
+		src[1]  * src[11] * src[14] +
+		src[9]  * src[2] * src[15] -
+		src[9]  * src[3] * src[14] -
+		src[13] * src[2] * src[11] +
+		src[13] * src[3] * src[10];
+
+	dst[5] = src[0]  * src[10] * src[15] -
+		src[0]  * src[11] * src[14] -
+		src[8]  * src[2] * src[15] +
+		src[8]  * src[3] * src[14] +
+		src[12] * src[2] * src[11] -
+		src[12] * src[3] * src[10];
+
+	dst[9] = -src[0]  * src[9] * src[15] +
+		src[0]  * src[11] * src[13] +
+		src[8]  * src[1] * src[15] -
+		src[8]  * src[3] * src[13] -
+		src[12] * src[1] * src[11] +
+		src[12] * src[3] * src[9];
+
+	dst[13] = src[0]  * src[9] * src[14] -
+		src[0]  * src[10] * src[13] -
+		src[8]  * src[1] * src[14] +
+		src[8]  * src[2] * src[13] +
+		src[12] * src[1] * src[10] -
+		src[12] * src[2] * src[9];
+
+	dst[2] = src[1]  * src[6] * src[15] -
+		src[1]  * src[7] * src[14] -
+		src[5]  * src[2] * src[15] +
+		src[5]  * src[3] * src[14] +
+		src[13] * src[2] * src[7] -
+		src[13] * src[3] * src[6];
+
+	dst[6] = -src[0]  * src[6] * src[15] +
+		src[0]  * src[7] * src[14] +
+		src[4]  * src[2] * src[15] -
+		src[4]  * src[3] * src[14] -
+		src[12] * src[2] * src[7] +
+		src[12] * src[3] * src[6];
+
+	dst[10] = src[0]  * src[5] * src[15] -
+		src[0]  * src[7] * src[13] -
+		src[4]  * src[1] * src[15] +
+		src[4]  * src[3] * src[13] +
+		src[12] * src[1] * src[7] -
+		src[12] * src[3] * src[5];
+
+	dst[14] = -src[0]  * src[5] * src[14] +
+		src[0]  * src[6] * src[13] +
+		src[4]  * src[1] * src[14] -
+		src[4]  * src[2] * src[13] -
+		src[12] * src[1] * src[6] +
+		src[12] * src[2] * src[5];
+
+	dst[3] = -src[1] * src[6] * src[11] +
+		src[1] * src[7] * src[10] +
+		src[5] * src[2] * src[11] -
+		src[5] * src[3] * src[10] -
+		src[9] * src[2] * src[7] +
+		src[9] * src[3] * src[6];
+
+	dst[7] = src[0] * src[6] * src[11] -
+		src[0] * src[7] * src[10] -
+		src[4] * src[2] * src[11] +
+		src[4] * src[3] * src[10] +
+		src[8] * src[2] * src[7] -
+		src[8] * src[3] * src[6];
+
+	dst[11] = -src[0] * src[5] * src[11] +
+		src[0] * src[7] * src[9] +
+		src[4] * src[1] * src[11] -
+		src[4] * src[3] * src[9] -
+		src[8] * src[1] * src[7] +
+		src[8] * src[3] * src[5];
+
+	dst[15] = src[0] * src[5] * src[10] -
+		src[0] * src[6] * src[9] -
+		src[4] * src[1] * src[10] +
+		src[4] * src[2] * src[9] +
+		src[8] * src[1] * src[6] -
+		src[8] * src[2] * src[5];
+
+	Component det = src[0] * dst[0] + \
+		src[1] * dst[4] + \
+		src[2] * dst[8] + \
+		src[3] * dst[12];
+
+	if (det == 0)
+	{
+		return false;
+	}
+
+	const Component inverse_det = 1 / det;
+	for (int i = 0; i < 16; ++i)
+		components[i] = dst[i] * inverse_det;
+
+	return true;
+}
+
+#if defined(RMLUI_MATRIX4_SSE)
+namespace Matrix4Operations {
+namespace Sse {
+
+// Selects the components (a[x], a[y], b[z], b[w]).
+template< int x, int y, int z, int w >
+inline __m128 Shuffle(__m128 a, __m128 b) noexcept
+{
+	return _mm_shuffle_ps(a, b, x | (y << 2) | (z << 4) | (w << 6));
+}
+
+// Selects the components (a[x], a[y], a[z], a[w]).
+template< int x, int y, int z, int w >
+inline __m128 Swizzle(__m128 a) noexcept
+{
+	return Shuffle< x, y, z, w >(a, a);
+}
+
+// Multiplies two 2x2 matrices packed as (m00, m01, m10, m11): a * b.
+inline __m128 Mat2Mul(__m128 a, __m128 b) noexcept
+{
+	return _mm_add_ps(_mm_mul_ps(a, Swizzle< 0, 3, 0, 3 >(b)), _mm_mul_ps(Swizzle< 1, 0, 3, 2 >(a), Swizzle< 2, 1, 2, 1 >(b)));
+}
+
+// Multiplies the adjugate of a packed 2x2 matrix by another: adj(a) * b.
+inline __m128 Mat2AdjMul(__m128 a, __m128 b) noexcept
+{
+	return _mm_sub_ps(_mm_mul_ps(Swizzle< 3, 3, 0, 0 >(a), b), _mm_mul_ps(Swizzle< 1, 1, 2, 2 >(a), Swizzle< 2, 3, 0, 1 >(b)));
+}
+
+// Multiplies a packed 2x2 matrix by the adjugate of another: a * adj(b).
+inline __m128 Mat2MulAdj(__m128 a, __m128 b) noexcept
+{
+	return _mm_sub_ps(_mm_mul_ps(a, Swizzle< 3, 0, 3, 0 >(b)), _mm_mul_ps(Swizzle< 1, 0, 3, 2 >(a), Swizzle< 2, 1, 2, 1 >(b)));
+}
+
+}
+}
+#endif
+
+// Multiplies a column-major single-precision matrix by a number of column vectors, four components at a time. The
+// products are summed in the same order as the generic implementation, so the results are identical.
+inline void Matrix4Operations::MultiplyColumns(const float* lhs, const float* rhs, float* result, int num_columns) noexcept
+{
+#if defined(RMLUI_MATRIX4_SSE)
+	const __m128 c0 = _mm_loadu_ps(lhs);
+	const __m128 c1 = _mm_loadu_ps(lhs + 4);
+	const __m128 c2 = _mm_loadu_ps(lhs + 8);
+	const __m128 c3 = _mm_loadu_ps(lhs + 12);
+	for (int j = 0; j < num_columns; ++j)
+	{
+		const float* column = rhs + j * 4;
+		__m128 sum = _mm_mul_ps(_mm_set1_ps(column[0]), c0);
+		sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(column[1]), c1));
+		sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(column[2]), c2));
+		sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(column[3]), c3));
+		_mm_storeu_ps(result + j * 4, sum);
+	}
+#elif defined(RMLUI_MATRIX4_NEON)
+	const float32x4_t c0 = vld1q_f32(lhs);
+	const float32x4_t c1 = vld1q_f32(lhs + 4);
+	const float32x4_t c2 = vld1q_f32(lhs + 8);
+	const float32x4_t c3 = vld1q_f32(lhs + 12);
+	for (int j = 0; j < num_columns; ++j)
+	{
+		const float* column = rhs + j * 4;
+		float32x4_t sum = vmulq_n_f32(c0, column[0]);
+		sum = vaddq_f32(sum, vmulq_n_f32(c1, column[1]));
+		sum = vaddq_f32(sum, vmulq_n_f32(c2, column[2]));
+		sum = vaddq_f32(sum, vmulq_n_f32(c3, column[3]));
+		vst1q_f32(result + j * 4, sum);
+	}
+#else
+	MultiplyColumns< float >(lhs, rhs, result, num_columns);
+#endif
+}
+
+// Inverts a single-precision matrix in place.
+// With SSE2 this uses the 2x2 block-wise method described by Eric Zhang, otherwise the generic implementation.
+inline bool Matrix4Operations::Invert(float* components) noexcept
+{
+#if defined(RMLUI_MATRIX4_SSE)
+	using namespace Sse;
+
+	const __m128 v0 = _mm_loadu_ps(components);
+	const __m128 v1 = _mm_loadu_ps(components + 4);
+	const __m128 v2 = _mm_loadu_ps(components + 8);
+	const __m128 v3 = _mm_loadu_ps(components + 12);
+
+	// The 2x2 sub-matrices, M = | A B |
+	//                           | C D |
+	const __m128 a = _mm_movelh_ps(v0, v1);
+	const __m128 b = _mm_movehl_ps(v1, v0);
+	const __m128 c = _mm_movelh_ps(v2, v3);
+	const __m128 d = _mm_movehl_ps(v3, v2);
+
+	// The determinants of the sub-matrices as (|A|, |B|, |C|, |D|).
+	const __m128 det_sub = _mm_sub_ps(
+		_mm_mul_ps(Shuffle< 0, 2, 0, 2 >(v0, v2), Shuffle< 1, 3, 1, 3 >(v1, v3)),
+		_mm_mul_ps(Shuffle< 1, 3, 1, 3 >(v0, v2), Shuffle< 0, 2, 0, 2 >(v1, v3))
+	);
+	const __m128 det_a = Swizzle< 0, 0, 0, 0 >(det_sub);
+	const __m128 det_b = Swizzle< 1, 1, 1, 1 >(det_sub);
+	const __m128 det_c = Swizzle< 2, 2, 2, 2 >(det_sub);
+	const __m128 det_d = Swizzle< 3, 3, 3, 3 >(det_sub);
+
+	const __m128 d_c = Mat2AdjMul(d, c);
+	const __m128 a_b = Mat2AdjMul(a, b);
+
+	// The adjugates of the blocks of the inverse, before scaling by the determinant.
+	__m128 x = _mm_sub_ps(_mm_mul_ps(det_d, a), Mat2Mul(b, d_c));
+	__m128 w = _mm_sub_ps(_mm_mul_ps(det_a, d), Mat2Mul(c, a_b));
+	__m128 y = _mm_sub_ps(_mm_mul_ps(det_b, c), Mat2MulAdj(d, a_b));
+	__m128 z = _mm_sub_ps(_mm_mul_ps(det_c, b), Mat2MulAdj(a, d_c));
+
+	// |M| = |A| |D| + |B| |C| - tr(adj(A) B adj(D) C)
+	__m128 trace = _mm_mul_ps(a_b, Swizzle< 0, 2, 1, 3 >(d_c));
+	trace = _mm_add_ps(trace, Swizzle< 2, 3, 0, 1 >(trace));
+	trace = _mm_add_ps(trace, Swizzle< 1, 0, 3, 2 >(trace));
+	const __m128 det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(det_a, det_d), _mm_mul_ps(det_b, det_c)), trace);
+
+	if (_mm_cvtss_f32(det) == 0)
+		return false;
+
+	const __m128 inverse_det = _mm_div_ps(_mm_setr_ps(1.f, -1.f, -1.f, 1.f), det);
+	x = _mm_mul_ps(x, inverse_det);
+	y = _mm_mul_ps(y, inverse_det);
+	z = _mm_mul_ps(z, inverse_det);
+	w = _mm_mul_ps(w, inverse_det);
+
+	// Take the adjugates of the blocks and reassemble them into rows.
+	_mm_storeu_ps(components, Shuffle< 3, 1, 3, 1 >(x, y));
+	_mm_storeu_ps(components + 4, Shuffle< 2, 0, 2, 0 >(x, y));
+	_mm_storeu_ps(components + 8, Shuffle< 3, 1, 3, 1 >(z, w));
+	_mm_storeu_ps(components + 12, Shuffle< 2, 0, 2, 0 >(z, w));
+
+	return true;
+#else
+	return Invert< float >(components);
+#endif
+}
+
 // Initialising constructor.
 template< typename Component, class Storage >
 Matrix4< Component, Storage >::Matrix4(
@@ -176,138 +471,10 @@ void Matrix4< Component, Storage >::SetColumns(const VectorType& vec0, const Vec
 }
 
 // Inverts this matrix in place.
-// This is from the MESA implementation of the GLU library.
 template< typename Component, class Storage >
 bool Matrix4< Component, Storage >::Invert() noexcept
 {
-	Matrix4< Component, Storage >::ThisType result;
-	Component *dst = result.data();
-	const Component *src = data();
-
-	dst[0] = src[5]  * src[10] * src[15] -
-		src[5]  * src[11] * src[14] -
-		src[9]  * src[6]  * src[15] +
-		src[9]  * src[7]  * src[14] +
-		src[13] * src[6]  * src[11] -
-		src[13] * src[7]  * src[10];
-
-	dst[4] = -src[4]  * src[10] * src[15] +
-		src[4]  * src[11] * src[14] +
-		src[8]  * src[6]  * src[15] -
-		src[8]  * src[7]  * src[14] -
-		src[12] * src[6]  * src[11] +
-		src[12] * src[7]  * src[10];
-
-	dst[8] = src[4]  * src[9] * src[15] -
-		src[4]  * src[11] * src[13] -
-		src[8]  * src[5] * src[15] +
-		src[8]  * src[7] * src[13] +
-		src[12] * src[5] * src[11] -
-		src[12] * src[7] * src[9];
-
-	dst[12] = -src[4]  * src[9] * src[14] +
-		src[4]  * src[10] * src[13] +
-		src[8]  * src[5] * src[14] -
-		src[8]  * src[6] * src[13] -
-		src[12] * src[5] * src[10] +
-		src[12] * src[6] * src[9];
-
-	dst[1] = -src[1]  * src[10] * src[15] +
-		src[1]  * src[11] * src[14] +
-		src[9]  * src[2] * src[15] -
-		src[9]  * src[3] * src[14] -
-		src[13] * src[2] * src[11] +
-		src[13] * src[3] * src[10];
-
-	dst[5] = src[0]  * src[10] * src[15] -
-		src[0]  * src[11] * src[14] -
-		src[8]  * src[2] * src[15] +
-		src[8]  * src[3] * src[14] +
-		src[12] * src[2] * src[11] -
-		src[12] * src[3] * src[10];
-
-	dst[9] = -src[0]  * src[9] * src[15] +
-		src[0]  * src[11] * src[13] +
-		src[8]  * src[1] * src[15] -
-		src[8]  * src[3] * src[13] -
-		src[12] * src[1] * src[11] +
-		src[12] * src[3] * src[9];
-
-	dst[13] = src[0]  * src[9] * src[14] -
-		src[0]  * src[10] * src[13] -
-		src[8]  * src[1] * src[14] +
-		src[8]  * src[2] * src[13] +
-		src[12] * src[1] * src[10] -
-		src[12] * src[2] * src[9];
-
-	dst[2] = src[1]  * src[6] * src[15] -
-		src[1]  * src[7] * src[14] -
-		src[5]  * src[2] * src[15] +
-		src[5]  * src[3] * src[14] +
-		src[13] * src[2] * src[7] -
-		src[13] * src[3] * src[6];
-
-	dst[6] = -src[0]  * src[6] * src[15] +
-		src[0]  * src[7] * src[14] +
-		src[4]  * src[2] * src[15] -
-		src[4]  * src[3] * src[14] -
-		src[12] * src[2] * src[7] +
-		src[12] * src[3] * src[6];
-
-	dst[10] = src[0]  * src[5] * src[15] -
-		src[0]  * src[7] * src[13] -
-		src[4]  * src[1] * src[15] +
-		src[4]  * src[3] * src[13] +
-		src[12] * src[1] * src[7] -
-		src[12] * src[3] * src[5];
-
-	dst[14] = -src[0]  * src[5] * src[14] +
-		src[0]  * src[6] * src[13] +
-		src[4]  * src[1] * src[14] -
-		src[4]  * src[2] * src[13] -
-		src[12] * src[1] * src[6] +
-		src[12] * src[2] * src[5];
-
-	dst[3] = -src[1] * src[6] * src[11] +
-		src[1] * src[7] * src[10] +
-		src[5] * src[2] * src[11] -
-		src[5] * src[3] * src[10] -
-		src[9] * src[2] * src[7] +
-		src[9] * src[3] * src[6];
-
-	dst[7] = src[0] * src[6] * src[11] -
-		src[0] * src[7] * src[10] -
-		src[4] * src[2] * src[11] +
-		src[4] * src[3] * src[10] +
-		src[8] * src[2] * src[7] -
-		src[8] * src[3] * src[6];
-
-	dst[11] = -src[0] * src[5] * src[11] +
-		src[0] * src[7] * src[9] +
-		src[4] * src[1] * src[11] -
-		src[4] * src[3] * src[9] -
-		src[8] * src[1] * src[7] +
-		src[8] * src[3] * src[5];
-
-	dst[15] = src[0] * src[5] * src[10] -
-		src[0] * src[6] * src[9] -
-		src[4] * src[1] * src[10] +
-		src[4] * src[2] * src[9] +
-		src[8] * src[1] * src[6] -
-		src[8] * src[2] * src[5];
-
-	float det = src[0] * dst[0] + \
-		src[1] * dst[4] + \
-		src[2] * dst[8] + \
-		src[3] * dst[12];
-
-	if (det == 0)
-	{
-		return false;
-	}
-
-	*this = result * (1 / det);
-	return true;
+	return Matrix4Operations::Invert(data());
 }
 
 
@@ -773,13 +940,9 @@ struct Matrix4< Component, Storage >::VectorMultiplier< _Component, ColumnMajorS
 
 	static const VectorType Multiply(const MatrixAType& lhs, const VectorType& rhs) noexcept
 	{
-		typename MatrixAType::ConstRows rows(lhs.vectors);
-		return VectorType(
-			rhs.DotProduct(rows[0]),
-			rhs.DotProduct(rows[1]),
-			rhs.DotProduct(rows[2]),
-			rhs.DotProduct(rows[3])
-		);
+		VectorType result;
+		Matrix4Operations::MultiplyColumns(lhs.data(), &rhs.x, &result.x, 1);
+		return result;
 	}
 };
 
@@ -823,16 +986,7 @@ struct Matrix4< Component, Storage >::MatrixMultiplier< _Component, ColumnMajorS
 	static const MatrixAType Multiply(const MatrixAType& lhs, const MatrixBType& rhs) noexcept
 	{
 		typename MatrixAType::ThisType result;
-		typename MatrixAType::Rows result_rows(result.vectors);
-		typename MatrixAType::ConstRows lhs_rows(lhs.vectors);
-		typename MatrixBType::ConstColumns rhs_columns(rhs.vectors);
-		for (int i = 0; i < 4; ++i)
-		{
-			for (int j = 0; j < 4; ++j)
-			{
-				result_rows[i][j] = rhs_columns[j].DotProduct(lhs_rows[i]);
-			}
-		}
+		Matrix4Operations::MultiplyColumns(lhs.data(), rhs.data(), result.data(), 4);
 		return result;
 	}
 };
@@ -0,0 +1,69 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#ifndef RMLUICOREMEMORYINTERFACE_H
+#define RMLUICOREMEMORYINTERFACE_H
+
+#include "Header.h"
+#include "MemoryStatistics.h"
+#include <cstddef>
+
+namespace Rml {
+namespace Core {
+
+/**
+	RmlUi's memory interface provides the memory for object pools, geometry pages, layout scratch memory, and font
+	face data. Applications using custom frame or arena allocators can route these allocations through their own
+	allocators by implementing this interface.
+
+	The default implementation uses malloc and free.
+ */
+
+class RMLUICORE_API MemoryInterface
+{
+public:
+	MemoryInterface();
+	virtual ~MemoryInterface();
+
+	/// Allocates a block of memory.
+	/// @param[in] size The number of bytes to allocate.
+	/// @param[in] alignment The required alignment of the block, a power of two.
+	/// @param[in] category The subsystem the memory is allocated for.
+	/// @return A pointer to the allocated block, or nullptr if the allocation failed.
+	virtual void* Allocate(size_t size, size_t alignment, MemoryCategory category);
+	/// Deallocates a block of memory previously returned by Allocate().
+	/// @param[in] ptr The block to deallocate.
+	/// @param[in] size The number of bytes the block was allocated with.
+	/// @param[in] alignment The alignment the block was allocated with.
+	/// @param[in] category The subsystem the memory was allocated for.
+	virtual void Deallocate(void* ptr, size_t size, size_t alignment, MemoryCategory category);
+};
+
+}
+}
+
+#endif
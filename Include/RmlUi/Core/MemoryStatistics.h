@@ -0,0 +1,122 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUICOREMEMORYSTATISTICS_H
+#define RMLUICOREMEMORYSTATISTICS_H
+
+#include "Header.h"
+#include <cstddef>
+
+namespace Rml {
+namespace Core {
+
+/**
+	The subsystems memory is accounted to.
+ */
+
+enum class MemoryCategory
+{
+	Elements,       // Elements and their meta data, including observer blocks.
+	Layout,         // Layout boxes and chunks used during formatting.
+	Geometry,       // Vertex and index data of geometry, and shared geometry pages.
+	StyleSheets,    // Element definitions generated from style sheets.
+	Fonts,          // Font face data and rasterized glyphs.
+	FontTextures,   // Font atlas textures, estimated from their dimensions.
+	Textures,       // Image and other textures, estimated from their dimensions.
+	Lua,            // The Lua interpreter heap, when the state is created by RmlUi.
+	Other,
+	Count
+};
+
+/**
+	The memory accounted to a single category.
+ */
+
+struct MemoryCategoryStatistics
+{
+	/// Bytes currently in use, and the highest number of bytes used.
+	size_t bytes = 0;
+	size_t peak_bytes = 0;
+	/// Number of live objects.
+	int num_objects = 0;
+	/// The budget of the category in bytes, or zero if it has no budget.
+	size_t budget = 0;
+};
+
+/**
+	The memory in use by RmlUi, by category.
+ */
+
+struct MemoryStatistics
+{
+	MemoryCategoryStatistics categories[(size_t)MemoryCategory::Count];
+
+	/// Returns the statistics of a single category.
+	const MemoryCategoryStatistics& operator[](MemoryCategory category) const { return categories[(size_t)category]; }
+
+	/// Returns the bytes in use summed over all categories.
+	size_t GetTotalBytes() const
+	{
+		size_t total = 0;
+		for (const MemoryCategoryStatistics& category : categories)
+			total += category.bytes;
+		return total;
+	}
+};
+
+namespace Memory {
+
+/// Accounts an allocation to a category. Plugins and applications may use this to account their own memory.
+/// @param[in] category The category to account the memory to.
+/// @param[in] bytes The number of bytes allocated.
+/// @param[in] num_objects The number of objects allocated.
+RMLUICORE_API void TrackAllocation(MemoryCategory category, size_t bytes, int num_objects = 1);
+/// Removes a previously tracked allocation from a category.
+/// @param[in] category The category the memory was accounted to.
+/// @param[in] bytes The number of bytes released.
+/// @param[in] num_objects The number of objects released.
+RMLUICORE_API void TrackDeallocation(MemoryCategory category, size_t bytes, int num_objects = 1);
+
+/// Sets the memory budget of a category. A warning is logged whenever the category grows beyond its budget.
+/// @param[in] category The category to set the budget of.
+/// @param[in] bytes The budget in bytes, or zero to remove the budget.
+RMLUICORE_API void SetBudget(MemoryCategory category, size_t bytes);
+/// Returns true if any category is currently above its budget.
+RMLUICORE_API bool IsOverBudget();
+
+/// Returns the memory in use by each category.
+RMLUICORE_API MemoryStatistics GetStatistics();
+/// Returns the name of a category.
+RMLUICORE_API const char* GetCategoryName(MemoryCategory category);
+
+}
+
+}
+}
+
+#endif
@@ -41,6 +41,7 @@ class StyleSheetSpecification;
 class PropertyDefinition;
 class PropertyDictionary;
 class PropertyIdNameMap;
+class PropertyParseCache;
 class ShorthandIdNameMap;
 struct ShorthandDefinition;
 
@@ -59,6 +60,18 @@ enum class ShorthandType
 	RecursiveCommaSeparated
 };
 
+/// Statistics of the cache of parsed property declarations.
+struct PropertyParseCacheStatistics
+{
+	/// Number of declarations found in and missing from the cache.
+	size_t num_hits = 0;
+	size_t num_misses = 0;
+	/// Number of declarations currently held by the cache.
+	int num_entries = 0;
+	/// Number of times the cache was emptied upon reaching its capacity.
+	size_t num_evictions = 0;
+};
+
 
 /**
 	A property specification stores a group of property definitions.
@@ -106,7 +119,8 @@ public:
 	const ShorthandDefinition* GetShorthand(ShorthandId id) const;
 	const ShorthandDefinition* GetShorthand(const String& shorthand_name) const;
 
-	/// Parse declaration by name, whether it's a property or shorthand.
+	/// Parse declaration by name, whether it's a property or shorthand. Successfully parsed declarations are cached,
+	/// repeated declarations of the same value are then copied from the cache.
 	bool ParsePropertyDeclaration(PropertyDictionary& dictionary, const String& property_name, const String& property_value) const;
 	/// Parse property declaration by ID.
 	bool ParsePropertyDeclaration(PropertyDictionary& dictionary, PropertyId property_id, const String& property_value) const;
@@ -121,6 +135,9 @@ public:
 	/// Returns the properties of dictionary converted to a string.
 	String PropertiesToString(const PropertyDictionary& dictionary) const;
 
+	/// Returns the statistics of the cache of parsed declarations.
+	PropertyParseCacheStatistics GetParseCacheStatistics() const;
+
 private:
 	using Properties = std::vector< UniquePtr<PropertyDefinition> >;
 	using Shorthands = std::vector< UniquePtr<ShorthandDefinition> >;
@@ -131,6 +148,8 @@ private:
 	UniquePtr<PropertyIdNameMap> property_map;
 	UniquePtr<ShorthandIdNameMap> shorthand_map;
 
+	UniquePtr<PropertyParseCache> parse_cache;
+
 	PropertyIdSet property_ids;
 	PropertyIdSet property_ids_inherited;
 	PropertyIdSet property_ids_forcing_layout;
@@ -81,6 +81,37 @@ public:
 	/// @param[in] geometry The application-specific compiled geometry to release.
 	virtual void ReleaseCompiledGeometry(CompiledGeometryHandle geometry);
 
+	/// Called by RmlUi when it wants to create a geometry page, a large vertex and index buffer shared by many geometries.
+	/// If supported, this should return a handle to an application-specific buffer of the given capacity. If not, do not
+	/// override the function or return zero; geometry will then be compiled or rendered individually.
+	/// @param[in] max_vertices The number of vertices the page must be able to hold.
+	/// @param[in] max_indices The number of indices the page must be able to hold.
+	/// @return The application-specific geometry page. The page contents are submitted with UpdateGeometryPage(), its geometry is rendered using RenderGeometryPage(), and the page is released with ReleaseGeometryPage() when it is no longer needed.
+	virtual GeometryPageHandle CreateGeometryPage(int max_vertices, int max_indices);
+	/// Called by RmlUi when ranges of a geometry page have changed, before any geometry is rendered from the modified ranges.
+	/// Modified ranges are merged and submitted at the start of each frame, thereafter only newly generated geometry is
+	/// submitted as it is first rendered. Either range may be empty.
+	/// @param[in] page The application-specific geometry page to update.
+	/// @param[in] vertices The modified vertex data, starting at the given vertex offset.
+	/// @param[in] vertex_offset The offset into the page of the first modified vertex.
+	/// @param[in] num_vertices The number of modified vertices.
+	/// @param[in] indices The modified index data, starting at the given index offset.
+	/// @param[in] index_offset The offset into the page of the first modified index.
+	/// @param[in] num_indices The number of modified indices.
+	virtual void UpdateGeometryPage(GeometryPageHandle page, Vertex* vertices, int vertex_offset, int num_vertices, int* indices, int index_offset, int num_indices);
+	/// Called by RmlUi when it wants to render geometry stored in a geometry page.
+	/// @param[in] page The application-specific geometry page containing the geometry.
+	/// @param[in] vertex_offset The offset into the page of the geometry's first vertex. Indices are relative to this vertex.
+	/// @param[in] num_vertices The number of vertices used by the geometry.
+	/// @param[in] index_offset The offset into the page of the geometry's first index.
+	/// @param[in] num_indices The number of indices to render. This will always be a multiple of three.
+	/// @param[in] texture The texture to be applied to the geometry. This may be nullptr, in which case the geometry is untextured.
+	/// @param[in] translation The translation to apply to the geometry.
+	virtual void RenderGeometryPage(GeometryPageHandle page, int vertex_offset, int num_vertices, int index_offset, int num_indices, TextureHandle texture, const Vector2f& translation);
+	/// Called by RmlUi when it wants to release a geometry page.
+	/// @param[in] page The application-specific geometry page to release.
+	virtual void ReleaseGeometryPage(GeometryPageHandle page);
+
 	/// Called by RmlUi when it wants to enable or disable scissoring to clip content.
 	/// @param[in] enable True if scissoring is to enabled, false if it is to be disabled.
 	virtual void EnableScissorRegion(bool enable) = 0;
@@ -107,6 +138,23 @@ public:
 	/// @param texture The texture handle to release.
 	virtual void ReleaseTexture(TextureHandle texture);
 
+	/// Called by RmlUi when it wants to cache the rendering of an element in a texture, see the 'render-cache' property.
+	/// If this is not supported, such elements are rendered as usual.
+	/// @param[out] texture_handle The handle to write the texture handle for the generated texture to.
+	/// @param[in] dimensions The dimensions of the texture, in pixels.
+	/// @return True if the texture was generated and can be rendered to, false if render-to-texture is unsupported.
+	virtual bool GenerateRenderTexture(TextureHandle& texture_handle, const Vector2i& dimensions);
+	/// Called by RmlUi when it wants to redirect rendering into a texture generated by GenerateRenderTexture(). The texture
+	/// should be cleared to transparent. All geometry and scissor regions until the matching call to PopRenderTexture() are
+	/// given in context coordinates, and should be offset so that the origin lands on the top-left pixel of the texture.
+	/// The texture is later rendered as regular textured geometry, its colours have then already been blended once and
+	/// should be treated as premultiplied by alpha.
+	/// @param[in] texture_handle The texture to render into.
+	/// @param[in] origin The position in the context corresponding to the top-left corner of the texture.
+	virtual void PushRenderTexture(TextureHandle texture_handle, const Vector2i& origin);
+	/// Called by RmlUi when it is done rendering into a texture, rendering should be returned to the previous target.
+	virtual void PopRenderTexture();
+
 	/// Called by RmlUi when it wants the renderer to use a new transform matrix.
 	/// This will only be called if 'transform' properties are encountered. If no transform applies to the current element, nullptr
 	/// is submitted. Then it expects the renderer to use an identity matrix or otherwise omit the multiplication with the transform.
@@ -114,6 +114,9 @@ public:
 
 	static const PropertySpecification& GetPropertySpecification();
 
+	/// Returns the statistics of the cache of parsed declarations, shared by style sheets, inline styles and SetProperty().
+	static PropertyParseCacheStatistics GetPropertyParseCacheStatistics();
+
 private:
 	StyleSheetSpecification();
 	~StyleSheetSpecification();
@@ -30,6 +30,7 @@
 #define RMLUICORETEXTURE_H
 
 #include "Header.h"
+#include "MemoryStatistics.h"
 #include "Types.h"
 #include <functional>
 
@@ -66,7 +67,8 @@ public:
 	/// Set a callback function for generating the texture on first use. The texture is never added to the global cache.
 	/// @param[in] name The name of the texture.
 	/// @param[in] callback The callback function which generates the data of the texture, see TextureCallback.
-	void Set(const String& name, const TextureCallback& callback);
+	/// @param[in] category The memory category the loaded texture is accounted to.
+	void Set(const String& name, const TextureCallback& callback, MemoryCategory category = MemoryCategory::Textures);
 
 	/// Returns the texture's source name. This is usually the name of the file the texture was loaded from.
 	/// @return The name of the this texture's source. This will be the empty string if this texture is not loaded.
@@ -86,6 +88,9 @@ public:
 	/// Returns true if the underlying resource is set.
 	explicit operator bool() const;
 
+	/// Returns the number of textures currently loaded through any render interface.
+	static int GetNumLoadedTextures();
+
 private:
 	SharedPtr<TextureResource> resource;
 };
@@ -46,8 +46,12 @@ public:
 	// Returns true if local perspecitve was changed.
 	bool SetLocalPerspective(const Matrix4f* in_perspective);
 
+	// Sets the transform of the owning element alone, as resolved from its transform properties.
+	void SetLocalTransform(const Matrix4f* in_local_transform);
+
 	const Matrix4f* GetTransform() const;
 	const Matrix4f* GetLocalPerspective() const;
+	const Matrix4f* GetLocalTransform() const;
 
 	// Returns a nullptr if there is no transform set, or the transform is singular.
 	const Matrix4f* GetInverseTransform() const;
@@ -56,6 +60,7 @@ public:
 private:
 	bool have_transform = false;
 	bool have_perspective = false;
+	bool have_local_transform = false;
 	mutable bool have_inverse_transform = false;
 	mutable bool dirty_inverse_transform = false;
 
@@ -65,6 +70,9 @@ private:
 	// Local perspective which applies to children of the owning element.
 	Matrix4f local_perspective;
 
+	// The transform of the owning element alone, kept so that it need not be resolved again when only an ancestor's transform changes.
+	Matrix4f local_transform;
+
 	// The inverse of the transform matrix for projecting points from screen space to the current element's space, such as used for picking elements.
 	mutable Matrix4f inverse_transform;
 };
@@ -171,6 +171,28 @@ void GameLoop()
 			fps_mean += fps_buffer[(buffer_index + i) % buffer_size];
 		fps_mean = fps_mean / (float)buffer_size;
 
+		// Geometry statistics, with draw calls and uploads averaged over the frames since the previous measurement.
+		static Rml::Core::GeometryStatistics stats_prev;
+		const Rml::Core::GeometryStatistics stats = Rml::Core::Geometry::GetStatistics();
+		const float frames = (float)count_frames;
+
+		if (auto el_stats = window->GetDocument()->GetElementById("geometry_stats"))
+		{
+			el_stats->SetInnerRML(Rml::Core::CreateString(512,
+				"Geometry: %d objects, %d paged in %d pages (%.0f KiB)<br/>"
+				"Draw calls per frame: %.1f immediate, %.1f compiled, %.1f paged<br/>"
+				"Per frame: %.1f compiles, %.1f page uploads (%.1f KiB)",
+				stats.num_geometry, stats.num_paged_geometry, stats.num_pages, float(stats.page_memory) / 1024.f,
+				float(stats.num_immediate_render_calls - stats_prev.num_immediate_render_calls) / frames,
+				float(stats.num_compiled_render_calls - stats_prev.num_compiled_render_calls) / frames,
+				float(stats.num_paged_render_calls - stats_prev.num_paged_render_calls) / frames,
+				float(stats.num_compile_calls - stats_prev.num_compile_calls) / frames,
+				float(stats.num_page_uploads - stats_prev.num_page_uploads) / frames,
+				float(stats.page_upload_bytes - stats_prev.page_upload_bytes) / (1024.f * frames)
+			));
+		}
+		stats_prev = stats;
+
 		auto el = window->GetDocument()->GetElementById("fps");
 		count_frames = 0;
 		el->SetInnerRML(Rml::Core::CreateString(20, "FPS: %f", fps_mean));
@@ -0,0 +1,71 @@
+Benchmark = Benchmark or {}
+
+local num_elements = 1000
+local num_iterations = 100
+
+function Benchmark.Populate(document)
+	local rml = {}
+	for i = 1, num_elements do
+		rml[i] = "<div>" .. i .. "</div>"
+	end
+	document:GetElementById("list").inner_rml = table.concat(rml)
+end
+
+--calls test(list) for the given number of iterations, returns the number of element accesses per millisecond
+local function Measure(list, accesses_per_iteration, test)
+	local start = os.clock()
+	for _ = 1, num_iterations do
+		test(list)
+	end
+	local elapsed_ms = (os.clock() - start) * 1000
+	return (accesses_per_iteration * num_iterations) / math.max(elapsed_ms, 0.001)
+end
+
+local tests = {
+	{ "child_nodes[i]", 1, function(list)
+		local child_nodes = list.child_nodes
+		for i = 0, num_elements - 1 do
+			local child = child_nodes[i]
+		end
+	end },
+	{ "child.parent_node", 2, function(list)
+		local child_nodes = list.child_nodes
+		for i = 0, num_elements - 1 do
+			local parent = child_nodes[i].parent_node
+		end
+	end },
+	{ "first_child, next_sibling", 1, function(list)
+		local child = list.first_child
+		while child do
+			child = child.next_sibling
+		end
+	end },
+	{ "ipairs(child_nodes)", 1, function(list)
+		for _, child in ipairs(list.child_nodes) do
+		end
+	end },
+}
+
+function Benchmark.Run(document)
+	local list = document:GetElementById("list")
+	local results = {}
+
+	for _, test in ipairs(tests) do
+		local rate = Measure(list, test[2] * num_elements, test[3])
+		table.insert(results, string.format("%s: %.0f accesses/ms", test[1], rate))
+	end
+
+	--the same element must be represented by the same userdata, so that it can be compared and used as a table key
+	local first = list.first_child
+	table.insert(results, "Identity preserved: " .. tostring(first.parent_node == list and first.next_sibling.previous_sibling == first))
+
+	document:GetElementById("results").inner_rml = table.concat(results, "<br/>")
+end
+
+function Startup()
+	local document = rmlui.contexts["main"]:LoadDocument("luabenchmark/data/benchmark.rml")
+	document:Show()
+	Benchmark.Run(document)
+end
+
+Startup()
@@ -36,6 +36,9 @@
 ElementGame::ElementGame(const Rml::Core::String& tag) : Rml::Core::Element(tag)
 {
 	game = new Game();
+
+	// The game is simulated from OnUpdate(), so it must be updated every frame.
+	SetUpdateEveryFrame(true);
 }
 
 ElementGame::~ElementGame()
@@ -53,6 +53,15 @@ public:
 	/// Called by RmlUi when it wants to release application-compiled geometry.
 	void ReleaseCompiledGeometry(Rml::Core::CompiledGeometryHandle geometry) override;
 
+	/// Called by RmlUi when it wants to create a geometry page shared by many geometries.
+	Rml::Core::GeometryPageHandle CreateGeometryPage(int max_vertices, int max_indices) override;
+	/// Called by RmlUi when ranges of a geometry page have changed.
+	void UpdateGeometryPage(Rml::Core::GeometryPageHandle page, Rml::Core::Vertex* vertices, int vertex_offset, int num_vertices, int* indices, int index_offset, int num_indices) override;
+	/// Called by RmlUi when it wants to render geometry stored in a geometry page.
+	void RenderGeometryPage(Rml::Core::GeometryPageHandle page, int vertex_offset, int num_vertices, int index_offset, int num_indices, Rml::Core::TextureHandle texture, const Rml::Core::Vector2f& translation) override;
+	/// Called by RmlUi when it wants to release a geometry page.
+	void ReleaseGeometryPage(Rml::Core::GeometryPageHandle page) override;
+
 	/// Called by RmlUi when it wants to enable or disable scissoring to clip content.
 	void EnableScissorRegion(bool enable) override;
 	/// Called by RmlUi when it wants to change the scissor region.
@@ -30,7 +30,9 @@
 #include <ShellRenderInterfaceOpenGL.h>
 #include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/FileInterface.h>
+#include <algorithm>
 #include <type_traits>
+#include <vector>
 #include <string.h>
 
 #define GL_CLAMP_TO_EDGE 0x812F
@@ -95,6 +97,43 @@ void ShellRenderInterfaceOpenGL::ReleaseCompiledGeometry(Rml::Core::CompiledGeom
 	RMLUI_UNUSED(geometry);
 }
 
+// The shell renders from client-side arrays, so a geometry page is simply a copy of the page data.
+struct ShellGeometryPage
+{
+	std::vector<Rml::Core::Vertex> vertices;
+	std::vector<int> indices;
+};
+
+// Called by RmlUi when it wants to create a geometry page shared by many geometries.
+Rml::Core::GeometryPageHandle ShellRenderInterfaceOpenGL::CreateGeometryPage(int max_vertices, int max_indices)
+{
+	ShellGeometryPage* page = new ShellGeometryPage;
+	page->vertices.resize(max_vertices);
+	page->indices.resize(max_indices);
+	return (Rml::Core::GeometryPageHandle)page;
+}
+
+// Called by RmlUi when ranges of a geometry page have changed.
+void ShellRenderInterfaceOpenGL::UpdateGeometryPage(Rml::Core::GeometryPageHandle page_handle, Rml::Core::Vertex* vertices, int vertex_offset, int num_vertices, int* indices, int index_offset, int num_indices)
+{
+	ShellGeometryPage* page = (ShellGeometryPage*)page_handle;
+	std::copy(vertices, vertices + num_vertices, page->vertices.begin() + vertex_offset);
+	std::copy(indices, indices + num_indices, page->indices.begin() + index_offset);
+}
+
+// Called by RmlUi when it wants to render geometry stored in a geometry page.
+void ShellRenderInterfaceOpenGL::RenderGeometryPage(Rml::Core::GeometryPageHandle page_handle, int vertex_offset, int num_vertices, int index_offset, int num_indices, Rml::Core::TextureHandle texture, const Rml::Core::Vector2f& translation)
+{
+	ShellGeometryPage* page = (ShellGeometryPage*)page_handle;
+	RenderGeometry(&page->vertices[vertex_offset], num_vertices, &page->indices[index_offset], num_indices, texture, translation);
+}
+
+// Called by RmlUi when it wants to release a geometry page.
+void ShellRenderInterfaceOpenGL::ReleaseGeometryPage(Rml::Core::GeometryPageHandle page_handle)
+{
+	delete (ShellGeometryPage*)page_handle;
+}
+
 // Called by RmlUi when it wants to enable or disable scissoring to clip content.		
 void ShellRenderInterfaceOpenGL::EnableScissorRegion(bool enable)
 {
@@ -42,6 +42,9 @@ namespace Controls {
 
 ElementDataGrid::ElementDataGrid(const Rml::Core::String& tag) : Core::Element(tag)
 {
+	// The grid polls its rows for new data every frame.
+	SetUpdateEveryFrame(true);
+
 	Rml::Core::XMLAttributes attributes;
 
 	// Create the row for the column headers:
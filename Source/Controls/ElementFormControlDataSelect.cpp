@@ -84,7 +84,9 @@ void ElementFormControlDataSelect::OnAttributeChange(const Core::ElementAttribut
 			data_source = nullptr;
 		}
 
+		// The new data source is attached on the next update.
 		initialised = false;
+		RequestUpdate();
 	}
 	else if (changed_attributes.find("fields") != changed_attributes.end() ||
 			 changed_attributes.find("valuefield") != changed_attributes.end() ||
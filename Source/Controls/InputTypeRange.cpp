@@ -53,7 +53,8 @@ Rml::Core::String InputTypeRange::GetValue() const
 // Called every update from the host element.
 void InputTypeRange::OnUpdate()
 {
-	widget->Update();
+	if (widget->Update())
+		element->RequestUpdate();
 }
 
 void InputTypeRange::OnResize()
@@ -133,7 +133,7 @@ bool WidgetSlider::Initialise()
 }
 
 // Updates the key repeats for the increment / decrement arrows.
-void WidgetSlider::Update()
+bool WidgetSlider::Update()
 {
 	for (int i = 0; i < 2; i++)
 	{
@@ -157,6 +157,8 @@ void WidgetSlider::Update()
 			}
 		}
 	}
+
+	return (arrow_timers[0] > 0 || arrow_timers[1] > 0);
 }
 
 // Sets the position of the bar.
@@ -393,12 +395,14 @@ void WidgetSlider::ProcessEvent(Core::Event& event)
 			arrow_timers[0] = DEFAULT_REPEAT_DELAY;
 			last_update_time = Core::Clock::GetElapsedTime();
 			SetBarPosition(OnLineDecrement());
+			parent->RequestUpdate();
 		}
 		else if (event.GetTargetElement() == arrows[1])
 		{
 			arrow_timers[1] = DEFAULT_REPEAT_DELAY;
 			last_update_time = Core::Clock::GetElapsedTime();
 			SetBarPosition(OnLineIncrement());
+			parent->RequestUpdate();
 		}
 	}
 	break;
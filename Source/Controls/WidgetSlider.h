@@ -58,7 +58,8 @@ public:
 	bool Initialise();
 
 	/// Updates the key repeats for the increment / decrement arrows.
-	void Update();
+	/// @return True if an arrow is held down, in which case the slider needs to be updated again on the next update.
+	bool Update();
 
 	/// Sets the position of the bar.
 	/// @param[in] bar_position The new position of the bar (0 representing the start of the track, 1 representing the end).
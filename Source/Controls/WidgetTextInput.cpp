@@ -225,7 +225,11 @@ void WidgetTextInput::OnUpdate()
 		{
 			cursor_timer += CURSOR_BLINK_TIME;
 			cursor_visible = !cursor_visible;
+			parent->MarkDamaged();
 		}
+
+		// Keep updating while the cursor is blinking.
+		parent->RequestUpdate();
 	}
 }
 
@@ -879,6 +883,8 @@ int WidgetTextInput::CalculateCharacterIndex(int line_index, float position)
 // Shows or hides the cursor.
 void WidgetTextInput::ShowCursor(bool show, bool move_to_cursor)
 {
+	parent->MarkDamaged();
+
 	if (show)
 	{
 		cursor_visible = true;
@@ -887,6 +893,7 @@ void WidgetTextInput::ShowCursor(bool show, bool move_to_cursor)
 		
 		cursor_timer = CURSOR_BLINK_TIME;
 		last_update_time = Core::GetSystemInterface()->GetElapsedTime();
+		parent->RequestUpdate();
 
 		// Shift the cursor into view.
 		if (move_to_cursor)
@@ -977,6 +984,8 @@ Rml::Core::Vector2f WidgetTextInput::FormatText()
 
 	Rml::Core::Vector2f content_area(0, 0);
 
+	parent->MarkDamaged();
+
 	// Clear the old lines, and all the lines in the text elements.
 	lines.clear();
 	text_element->ClearLines();
@@ -1135,6 +1144,8 @@ void WidgetTextInput::UpdateCursorPosition()
 
 	cursor_position.x = (float) Core::ElementUtilities::GetStringWidth(text_element, lines[cursor_line_index].content.substr(0, cursor_character_index));
 	cursor_position.y = -1.f + (float)cursor_line_index * text_element->GetLineHeight();
+
+	parent->MarkDamaged();
 }
 
 // Expand the text selection to the position of the cursor.
@@ -29,6 +29,7 @@
 #include "../../Include/RmlUi/Core/BaseXMLParser.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/Stream.h"
+#include "Clock.h"
 #include <string.h>
 
 namespace Rml {
@@ -48,6 +49,8 @@ BaseXMLParser::BaseXMLParser()
 
 BaseXMLParser::~BaseXMLParser()
 {
+	// An incremental parse may have been abandoned before completion.
+	free(buffer);
 }
 
 // Registers a tag as containing general character data.
@@ -61,6 +64,15 @@ void BaseXMLParser::RegisterCDATATag(const String& tag)
 // interesting phenomenon are encountered.
 void BaseXMLParser::Parse(Stream* stream)
 {
+	BeginParse(stream);
+	ContinueParse(-1.0f);
+}
+
+// Begins incremental parsing of the given stream.
+void BaseXMLParser::BeginParse(Stream* stream)
+{
+	free(buffer);
+
 	xml_source = stream;
 	buffer_size = DEFAULT_BUFFER_SIZE;
 
@@ -71,10 +83,40 @@ void BaseXMLParser::Parse(Stream* stream)
 
 	// Read (er ... skip) the header, if one exists.
 	ReadHeader();
+
+	open_tag_depth = 0;
+	line_number_open_tag = 0;
+}
+
+// Continues an incremental parse, until the stream is exhausted or the time limit is reached.
+bool BaseXMLParser::ContinueParse(float time_limit)
+{
+	RMLUI_ZoneScoped;
+
+	if (!buffer)
+		return true;
+
+	const double start_time = (time_limit >= 0.0f ? Clock::GetElapsedTime() : 0.0);
+
 	// Read the XML body.
-	ReadBody();
+	while (ReadBody())
+	{
+		if (time_limit >= 0.0f && float(Clock::GetElapsedTime() - start_time) >= time_limit)
+			return false;
+	}
+
+	// Check for error conditions
+	if (open_tag_depth > 0)
+	{
+		Log::Message(Log::LT_WARNING, "XML parse error on line %d of %s.", GetLineNumber(), xml_source->GetSourceURL().GetURL().c_str());
+	}
 
 	free(buffer);
+	buffer = nullptr;
+	read = nullptr;
+	buffer_used = 0;
+
+	return true;
 }
 
 // Get the current file line number
@@ -116,60 +158,48 @@ void BaseXMLParser::ReadHeader()
 	}
 }
 
-void BaseXMLParser::ReadBody()
+bool BaseXMLParser::ReadBody()
 {
-	RMLUI_ZoneScoped;
-
-	open_tag_depth = 0;
-	line_number_open_tag = 0;
+	// Find the next open tag.
+	if (!FindString((unsigned char*) "<", data))
+		return false;
 
-	for(;;)
+	// Check what kind of tag this is.
+	if (PeekString((const unsigned char*) "!--"))
 	{
-		// Find the next open tag.
-		if (!FindString((unsigned char*) "<", data))
-			break;
-
-		// Check what kind of tag this is.
-		if (PeekString((const unsigned char*) "!--"))
-		{
-			// Comment.
-			String temp;
-			if (!FindString((const unsigned char*) "-->", temp))
-				break;
-		}
-		else if (PeekString((const unsigned char*) "![CDATA["))
-		{
-			// CDATA tag; read everything (including markup) until the ending
-			// CDATA tag.
-			if (!ReadCDATA())
-				break;
-		}
-		else if (PeekString((const unsigned char*) "/"))
-		{
-			if (!ReadCloseTag())
-				break;
+		// Comment.
+		String temp;
+		if (!FindString((const unsigned char*) "-->", temp))
+			return false;
+	}
+	else if (PeekString((const unsigned char*) "![CDATA["))
+	{
+		// CDATA tag; read everything (including markup) until the ending
+		// CDATA tag.
+		if (!ReadCDATA())
+			return false;
+	}
+	else if (PeekString((const unsigned char*) "/"))
+	{
+		if (!ReadCloseTag())
+			return false;
 
-			// Bail if we've hit the end of the XML data.
-			if (open_tag_depth == 0)
-			{
-				xml_source->Seek((long)((read - buffer) - buffer_used), SEEK_CUR);
-				break;
-			}
-		}
-		else
+		// Bail if we've hit the end of the XML data.
+		if (open_tag_depth == 0)
 		{
-			if (ReadOpenTag())
-				line_number_open_tag = line_number;
-			else
-				break;
+			xml_source->Seek((long)((read - buffer) - buffer_used), SEEK_CUR);
+			return false;
 		}
 	}
-
-	// Check for error conditions
-	if (open_tag_depth > 0)
+	else
 	{
-		Log::Message(Log::LT_WARNING, "XML parse error on line %d of %s.", GetLineNumber(), xml_source->GetSourceURL().GetURL().c_str());
+		if (ReadOpenTag())
+			line_number_open_tag = line_number;
+		else
+			return false;
 	}
+
+	return true;
 }
 
 bool BaseXMLParser::ReadOpenTag()
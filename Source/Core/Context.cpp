@@ -36,8 +36,12 @@
 #include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "../../Include/RmlUi/Core/StreamMemory.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "../../Include/RmlUi/Core/XMLParser.h"
+#include "Clock.h"
+#include "ContextStatistics.h"
 #include "EventDispatcher.h"
 #include "EventIterators.h"
+#include "GeometryArena.h"
 #include "PluginRegistry.h"
 #include "StreamFile.h"
 #include <algorithm>
@@ -49,6 +53,10 @@ namespace Core {
 
 static constexpr float DOUBLE_CLICK_TIME = 0.5f;     // [s]
 static constexpr float DOUBLE_CLICK_MAX_DIST = 3.f;  // [dp]
+static constexpr int MAX_DAMAGED_REGIONS = 8;        // Limits the number of render passes when damage tracking is enabled.
+static constexpr float DEFAULT_DOCUMENT_LOAD_BUDGET = 0.004f; // [s]
+
+static int num_damage_tracking_contexts = 0;
 
 Context::Context(const String& name) : name(name), dimensions(0, 0), density_independent_pixel_ratio(1.0f), mouse_position(0, 0), clip_origin(-1, -1), clip_dimensions(-1, -1)
 {
@@ -85,12 +93,25 @@ Context::Context(const String& name) : name(name), dimensions(0, 0), density_ind
 	last_click_element = nullptr;
 	last_click_time = 0;
 	last_click_mouse_position = Vector2i(0, 0);
+
+	document_load_budget = DEFAULT_DOCUMENT_LOAD_BUDGET;
+	active_document_load = nullptr;
+
+	damage_tracking_enabled = false;
+	damage_all = true;
+	redraw_region.top_left = Vector2i(0, 0);
+	redraw_region.bottom_right = Vector2i(0, 0);
+
+	statistics_enabled = false;
+	statistics_track_elements = false;
 }
 
 Context::~Context()
 {
 	PluginRegistry::NotifyContextDestroy(this);
 
+	EnableDamageTracking(false);
+
 	UnloadAllDocuments();
 
 	ReleaseUnloadedDocuments();
@@ -131,6 +152,8 @@ void Context::SetDimensions(const Vector2i& _dimensions)
 		}
 		
 		clip_dimensions = dimensions;
+
+		MarkDamaged();
 	}
 }
 
@@ -167,14 +190,33 @@ bool Context::Update()
 {
 	RMLUI_ZoneScoped;
 
-	root->Update(density_independent_pixel_ratio);
+	ContextStatisticsScope update_scope(this, &ContextStatistics::update_time);
 
-	for (int i = 0; i < root->GetNumChildren(); ++i)
-		if (auto doc = root->GetChild(i)->GetOwnerDocument())
-		{
-			doc->UpdateLayout();
-			doc->UpdatePosition();
-		}
+	// Parse the next slice of any documents being loaded, their new elements are styled during the update below.
+	if (!document_loads.empty())
+	{
+		ContextStatisticsScope load_scope(this, &ContextStatistics::document_load_time);
+		UpdateDocumentLoads();
+	}
+
+	{
+		ContextStatisticsScope style_scope(this, &ContextStatistics::style_time);
+		root->Update(density_independent_pixel_ratio);
+	}
+
+	{
+		ContextStatisticsScope layout_scope(this, &ContextStatistics::layout_time);
+		for (int i = 0; i < root->GetNumChildren(); ++i)
+			if (auto doc = root->GetChild(i)->GetOwnerDocument())
+			{
+				// Layout is deferred until documents have finished loading.
+				if (!document_loads.empty() && IsDocumentLoading(doc))
+					continue;
+
+				doc->UpdateLayout();
+				doc->UpdatePosition();
+			}
+	}
 
 	// Release any documents that were unloaded during the update.
 	ReleaseUnloadedDocuments();
@@ -187,14 +229,109 @@ bool Context::Render()
 {
 	RMLUI_ZoneScoped;
 
+	bool result;
+	{
+		ContextStatisticsScope render_scope(this, &ContextStatistics::render_time);
+		result = RenderDocuments();
+	}
+
+	// The render ends the frame.
+	if (statistics_enabled)
+	{
+		last_frame_statistics = std::move(frame_statistics);
+		frame_statistics = ContextStatistics();
+
+		for (int i = 0; i < root->GetNumChildren(); ++i)
+		{
+			if (ElementDocument* document = root->GetChild(i)->GetOwnerDocument())
+			{
+				document->last_frame_statistics = document->frame_statistics;
+				document->last_frame_statistics.num_elements = document->num_elements;
+				document->frame_statistics = DocumentStatistics();
+			}
+		}
+	}
+
+	return result;
+}
+
+// Enables or disables gathering of frame statistics.
+void Context::EnableStatistics(bool enable, bool track_elements)
+{
+	statistics_enabled = enable;
+	statistics_track_elements = (enable && track_elements);
+	frame_statistics = ContextStatistics();
+	last_frame_statistics = ContextStatistics();
+
+	for (int i = 0; i < root->GetNumChildren(); ++i)
+	{
+		if (ElementDocument* document = root->GetChild(i)->GetOwnerDocument())
+		{
+			document->frame_statistics = DocumentStatistics();
+			document->last_frame_statistics = DocumentStatistics();
+		}
+	}
+}
+
+bool Context::IsStatisticsEnabled() const
+{
+	return statistics_enabled;
+}
+
+// Returns the statistics of the last frame.
+const ContextStatistics& Context::GetStatistics() const
+{
+	return last_frame_statistics;
+}
+
+// Renders the documents and the cursor proxy.
+bool Context::RenderDocuments()
+{
 	RenderInterface* render_interface = GetRenderInterface();
 	if (render_interface == nullptr)
 		return false;
 
+	// Determine the regions to redraw, any damage added during the render traversal is kept for the next render.
+	DamagedRegionList redraw_regions;
+	if (damage_tracking_enabled)
+	{
+		CollectDamage();
+
+		if (!damage_all && damaged_regions.empty())
+			return true;
+
+		if (!damage_all)
+			redraw_regions.swap(damaged_regions);
+
+		damage_all = false;
+	}
+
 	render_interface->context = this;
-	ElementUtilities::ApplyActiveClipRegion(this, render_interface);
 
-	root->Render();
+	// Submit any modified geometry pages in bulk before rendering.
+	GeometryArena::UploadDirtyPages(render_interface);
+
+	if (redraw_regions.empty())
+	{
+		ElementUtilities::ApplyActiveClipRegion(this, render_interface);
+
+		root->Render();
+	}
+	else
+	{
+		// Render the tree once for each region, with all clipping restricted to the region.
+		for (const DamagedRegion& region : redraw_regions)
+		{
+			redraw_region = region;
+			SetActiveClipRegion(region.top_left, region.bottom_right - region.top_left);
+			ElementUtilities::ApplyActiveClipRegion(this, render_interface);
+
+			root->Render();
+		}
+
+		redraw_region.top_left = Vector2i(0, 0);
+		redraw_region.bottom_right = Vector2i(0, 0);
+	}
 
 	ElementUtilities::SetClippingRegion(nullptr, this);
 
@@ -213,6 +350,131 @@ bool Context::Render()
 	return true;
 }
 
+// Enables or disables tracking of the regions changed since the last render.
+void Context::EnableDamageTracking(bool enable)
+{
+	if (damage_tracking_enabled != enable)
+	{
+		damage_tracking_enabled = enable;
+		damage_all = true;
+		damaged_regions.clear();
+
+		num_damage_tracking_contexts += (enable ? 1 : -1);
+	}
+}
+
+bool Context::IsDamageTrackingEnabled() const
+{
+	return damage_tracking_enabled;
+}
+
+int Context::GetNumDamageTrackingContexts()
+{
+	return num_damage_tracking_contexts;
+}
+
+// Marks the whole context as damaged.
+void Context::MarkDamaged()
+{
+	if (damage_tracking_enabled)
+	{
+		damage_all = true;
+		damaged_regions.clear();
+	}
+}
+
+// Marks a region of the context as damaged.
+void Context::MarkDamaged(const Vector2i& origin, const Vector2i& region_dimensions)
+{
+	if (!damage_tracking_enabled || damage_all)
+		return;
+
+	DamagedRegion region;
+	region.top_left = Vector2i(Math::Max(origin.x, 0), Math::Max(origin.y, 0));
+	region.bottom_right = Vector2i(Math::Min(origin.x + region_dimensions.x, dimensions.x), Math::Min(origin.y + region_dimensions.y, dimensions.y));
+
+	if (region.bottom_right.x <= region.top_left.x || region.bottom_right.y <= region.top_left.y)
+		return;
+
+	auto merge = [](DamagedRegion& target, const DamagedRegion& other) {
+		target.top_left = Vector2i(Math::Min(target.top_left.x, other.top_left.x), Math::Min(target.top_left.y, other.top_left.y));
+		target.bottom_right = Vector2i(Math::Max(target.bottom_right.x, other.bottom_right.x), Math::Max(target.bottom_right.y, other.bottom_right.y));
+	};
+
+	// Merge the region with all regions it overlaps or touches, starting over whenever it grows.
+	for (size_t i = 0; i < damaged_regions.size();)
+	{
+		const DamagedRegion& other = damaged_regions[i];
+		if (region.top_left.x <= other.bottom_right.x && other.top_left.x <= region.bottom_right.x &&
+			region.top_left.y <= other.bottom_right.y && other.top_left.y <= region.bottom_right.y)
+		{
+			merge(region, other);
+			damaged_regions[i] = damaged_regions.back();
+			damaged_regions.pop_back();
+			i = 0;
+		}
+		else
+			i++;
+	}
+
+	if (region.top_left == Vector2i(0, 0) && region.bottom_right == dimensions)
+	{
+		MarkDamaged();
+		return;
+	}
+
+	damaged_regions.push_back(region);
+
+	// Too many regions make every render pass expensive, combine them into their bounding region instead.
+	if ((int)damaged_regions.size() > MAX_DAMAGED_REGIONS)
+	{
+		for (size_t i = 1; i < damaged_regions.size(); i++)
+			merge(damaged_regions[0], damaged_regions[i]);
+		damaged_regions.resize(1);
+	}
+}
+
+bool Context::HasDamage()
+{
+	if (!damage_tracking_enabled)
+		return true;
+
+	CollectDamage();
+
+	return damage_all || !damaged_regions.empty();
+}
+
+int Context::GetNumDamagedRegions()
+{
+	if (!damage_tracking_enabled)
+		return 1;
+
+	CollectDamage();
+
+	if (damage_all)
+		return 1;
+
+	return (int)damaged_regions.size();
+}
+
+bool Context::GetDamagedRegion(int index, Vector2i& origin, Vector2i& region_dimensions)
+{
+	if (index < 0 || index >= GetNumDamagedRegions())
+		return false;
+
+	if (!damage_tracking_enabled || damage_all)
+	{
+		origin = Vector2i(0, 0);
+		region_dimensions = dimensions;
+		return true;
+	}
+
+	const DamagedRegion& region = damaged_regions[index];
+	origin = region.top_left;
+	region_dimensions = region.bottom_right - region.top_left;
+	return true;
+}
+
 // Creates a new, empty document and places it into this context.
 ElementDocument* Context::CreateDocument(const String& tag)
 {
@@ -254,6 +516,8 @@ ElementDocument* Context::LoadDocument(const String& document_path)
 // Load a document into the context.
 ElementDocument* Context::LoadDocument(Stream* stream)
 {
+	ContextStatisticsScope statistics_scope(this, &ContextStatistics::document_load_time);
+
 	PluginRegistry::NotifyDocumentOpen(this, stream->GetSourceURL().GetURL());
 
 	ElementPtr element = Factory::InstanceDocumentStream(this, stream);
@@ -264,6 +528,14 @@ ElementDocument* Context::LoadDocument(Stream* stream)
 	
 	root->AppendChild(std::move(element));
 
+	FinishLoadDocument(document);
+
+	return document;
+}
+
+// Dispatches the load notifications for a fully instanced document, and updates it.
+void Context::FinishLoadDocument(ElementDocument* document)
+{
 	ElementUtilities::BindEventAttributes(document);
 
 	// The 'load' event is fired before updating the document, because the user might
@@ -274,8 +546,6 @@ ElementDocument* Context::LoadDocument(Stream* stream)
 	document->DispatchEvent(EventId::Load, Dictionary());
 
 	document->UpdateDocument();
-
-	return document;
 }
 
 // Load a document into the context.
@@ -291,6 +561,128 @@ ElementDocument* Context::LoadDocumentFromMemory(const String& string)
 	return document;
 }
 
+// Load a document into the context incrementally.
+ElementDocument* Context::LoadDocumentIncremental(const String& document_path)
+{
+	auto stream = std::make_unique<StreamFile>();
+
+	if (!stream->Open(document_path))
+		return nullptr;
+
+	return BeginLoadDocument(std::move(stream));
+}
+
+// Load a document into the context incrementally.
+ElementDocument* Context::LoadDocumentFromMemoryIncremental(const String& string)
+{
+	// The document is parsed after this call returns, so the stream needs its own copy of the string.
+	auto stream = std::make_unique<StreamMemory>(string.size());
+	stream->Write(string.c_str(), string.size());
+	stream->Seek(0, SEEK_SET);
+	stream->SetSourceURL("[document from memory]");
+
+	return BeginLoadDocument(std::move(stream));
+}
+
+// Returns true if the given document is still being loaded incrementally.
+bool Context::IsDocumentLoading(ElementDocument* document) const
+{
+	for (const auto& load : document_loads)
+	{
+		if (load->document == document && !load->cancelled)
+			return true;
+	}
+
+	return false;
+}
+
+void Context::SetDocumentLoadBudget(float seconds)
+{
+	document_load_budget = Math::Max(seconds, 0.0f);
+}
+
+float Context::GetDocumentLoadBudget() const
+{
+	return document_load_budget;
+}
+
+// Begins loading a document incrementally from the given stream.
+ElementDocument* Context::BeginLoadDocument(UniquePtr<Stream> stream)
+{
+	PluginRegistry::NotifyDocumentOpen(this, stream->GetSourceURL().GetURL());
+
+	ElementPtr element = Factory::InstanceDocument(this);
+	if (!element)
+		return nullptr;
+
+	ElementDocument* document = static_cast<ElementDocument*>(element.get());
+
+	// The document is placed into the context right away so that its elements are styled in place as they are
+	// parsed, it stays hidden at least until it has finished loading.
+	document->SetProperty(PropertyId::Visibility, Property(Style::Visibility::Hidden));
+	root->AppendChild(std::move(element));
+
+	auto load = std::make_unique<DocumentLoad>();
+	load->document = document;
+	load->parser = std::make_unique<XMLParser>(document);
+	load->parser->BeginParse(stream.get());
+	load->stream = std::move(stream);
+
+	document_loads.push_back(std::move(load));
+
+	return document;
+}
+
+// Continues parsing the incrementally loaded documents within the load budget.
+void Context::UpdateDocumentLoads()
+{
+	RMLUI_ZoneScoped;
+
+	const double start_time = Clock::GetElapsedTime();
+	float time_remaining = document_load_budget;
+
+	// Documents are loaded one at a time in the order they were requested, at least one tag is parsed each update.
+	while (!document_loads.empty())
+	{
+		// Scripts run while parsing, and the progress event handlers, may begin other loads or unload this document. The
+		// load is kept alive until they return, and only marked as cancelled if its document is unloaded.
+		DocumentLoad* load = document_loads.front().get();
+		ElementDocument* document = load->document;
+		active_document_load = load;
+
+		const bool complete = load->parser->ContinueParse(time_remaining);
+
+		if (!load->cancelled)
+		{
+			const size_t length = load->stream->Length();
+			Dictionary parameters;
+			parameters["progress"] = (complete || length == 0 ? 1.0f : Math::Min(float(load->stream->Tell()) / float(length), 1.0f));
+			document->DispatchEvent(EventId::Loadprogress, parameters);
+		}
+
+		active_document_load = nullptr;
+
+		if (load->cancelled)
+		{
+			auto it = std::find_if(document_loads.begin(), document_loads.end(), [load](const UniquePtr<DocumentLoad>& entry) { return entry.get() == load; });
+			RMLUI_ASSERT(it != document_loads.end());
+			document_loads.erase(it);
+			return;
+		}
+
+		if (!complete)
+			return;
+
+		document_loads.erase(document_loads.begin());
+
+		FinishLoadDocument(document);
+
+		time_remaining = document_load_budget - float(Clock::GetElapsedTime() - start_time);
+		if (time_remaining <= 0.0f)
+			return;
+	}
+}
+
 // Unload the given document
 void Context::UnloadDocument(ElementDocument* _document)
 {
@@ -303,11 +695,32 @@ void Context::UnloadDocument(ElementDocument* _document)
 
 	ElementDocument* document = _document;
 
+	// Cancel the load if the document is still being loaded, it was never announced as loaded.
+	bool loading = false;
+	for (auto it = document_loads.begin(); it != document_loads.end(); ++it)
+	{
+		DocumentLoad* load = it->get();
+		if (load->document == document && !load->cancelled)
+		{
+			// The load being parsed is removed once the parser returns.
+			if (load == active_document_load)
+				load->cancelled = true;
+			else
+				document_loads.erase(it);
+
+			loading = true;
+			break;
+		}
+	}
+
 	if (document->GetParentNode() == root.get())
 	{
 		// Dispatch the unload notifications.
-		document->DispatchEvent(EventId::Unload, Dictionary());
-		PluginRegistry::NotifyDocumentUnload(document);
+		if (!loading)
+		{
+			document->DispatchEvent(EventId::Unload, Dictionary());
+			PluginRegistry::NotifyDocumentUnload(document);
+		}
 
 		// Move document to a temporary location to be released later.
 		unloaded_documents.push_back( root->RemoveChild(document) );
@@ -483,6 +896,8 @@ void Context::RemoveEventListener(const String& event, EventListener* listener,
 // Sends a key down event into RmlUi.
 bool Context::ProcessKeyDown(Input::KeyIdentifier key_identifier, int key_modifier_state)
 {
+	ContextStatisticsScope statistics_scope(this, &ContextStatistics::event_time);
+
 	// Generate the parameters for the key event.
 	Dictionary parameters;
 	GenerateKeyEventParameters(parameters, key_identifier);
@@ -497,6 +912,8 @@ bool Context::ProcessKeyDown(Input::KeyIdentifier key_identifier, int key_modifi
 // Sends a key up event into RmlUi.
 bool Context::ProcessKeyUp(Input::KeyIdentifier key_identifier, int key_modifier_state)
 {
+	ContextStatisticsScope statistics_scope(this, &ContextStatistics::event_time);
+
 	// Generate the parameters for the key event.
 	Dictionary parameters;
 	GenerateKeyEventParameters(parameters, key_identifier);
@@ -527,6 +944,8 @@ bool Context::ProcessTextInput(Character character)
 // Sends a string of text as text input into RmlUi.
 bool Context::ProcessTextInput(const String& string)
 {
+	ContextStatisticsScope statistics_scope(this, &ContextStatistics::event_time);
+
 	Element* target = (focus ? focus : root.get());
 
 	Dictionary parameters;
@@ -540,6 +959,8 @@ bool Context::ProcessTextInput(const String& string)
 // Sends a mouse movement event into RmlUi.
 void Context::ProcessMouseMove(int x, int y, int key_modifier_state)
 {
+	ContextStatisticsScope statistics_scope(this, &ContextStatistics::event_time);
+
 	// Check whether the mouse moved since the last event came through.
 	Vector2i old_mouse_position = mouse_position;
 	bool mouse_moved = (x != mouse_position.x) || (y != mouse_position.y);
@@ -594,6 +1015,8 @@ static Element* FindFocusElement(Element* element)
 // Sends a mouse-button down event into RmlUi.
 void Context::ProcessMouseButtonDown(int button_index, int key_modifier_state)
 {
+	ContextStatisticsScope statistics_scope(this, &ContextStatistics::event_time);
+
 	Dictionary parameters;
 	GenerateMouseEventParameters(parameters, button_index);
 	GenerateKeyModifierEventParameters(parameters, key_modifier_state);
@@ -683,6 +1106,8 @@ void Context::ProcessMouseButtonDown(int button_index, int key_modifier_state)
 // Sends a mouse-button up event into RmlUi.
 void Context::ProcessMouseButtonUp(int button_index, int key_modifier_state)
 {
+	ContextStatisticsScope statistics_scope(this, &ContextStatistics::event_time);
+
 	Dictionary parameters;
 	GenerateMouseEventParameters(parameters, button_index);
 	GenerateKeyModifierEventParameters(parameters, key_modifier_state);
@@ -752,6 +1177,8 @@ void Context::ProcessMouseButtonUp(int button_index, int key_modifier_state)
 // Sends a mouse-wheel movement event into RmlUi.
 bool Context::ProcessMouseWheel(float wheel_delta, int key_modifier_state)
 {
+	ContextStatisticsScope statistics_scope(this, &ContextStatistics::event_time);
+
 	if (hover)
 	{
 		Dictionary scroll_parameters;
@@ -789,6 +1216,17 @@ void Context::SetActiveClipRegion(const Vector2i& origin, const Vector2i& dimens
 	clip_dimensions = dimensions;
 }
 
+// Gets the damaged region currently being redrawn.
+bool Context::GetRedrawRegion(Vector2i& origin, Vector2i& region_dimensions) const
+{
+	if (redraw_region.top_left == redraw_region.bottom_right)
+		return false;
+
+	origin = redraw_region.top_left;
+	region_dimensions = redraw_region.bottom_right - redraw_region.top_left;
+	return true;
+}
+
 // Sets the instancer to use for releasing this object.
 void Context::SetInstancer(ContextInstancer* _instancer)
 {
@@ -1053,11 +1491,13 @@ Element* Context::GetElementAtPoint(Vector2f point, const Element* ignore_elemen
 		if (element->stacking_context_dirty)
 			element->BuildLocalStackingContext();
 
-		for (int i = (int) element->stacking_context.size() - 1; i >= 0; --i)
+		const ElementList& stacking_context = element->GetLocalStackingContext();
+
+		for (int i = (int) stacking_context.size() - 1; i >= 0; --i)
 		{
 			if (ignore_element != nullptr)
 			{
-				Element* element_hierarchy = element->stacking_context[i];
+				Element* element_hierarchy = stacking_context[i];
 				while (element_hierarchy != nullptr)
 				{
 					if (element_hierarchy == ignore_element)
@@ -1070,7 +1510,7 @@ Element* Context::GetElementAtPoint(Vector2f point, const Element* ignore_elemen
 					continue;
 			}
 
-			Element* child_element = GetElementAtPoint(point, ignore_element, element->stacking_context[i]);
+			Element* child_element = GetElementAtPoint(point, ignore_element, stacking_context[i]);
 			if (child_element != nullptr)
 				return child_element;
 		}
@@ -1201,6 +1641,17 @@ void Context::ReleaseUnloadedDocuments()
 	}
 }
 
+void Context::CollectDamage()
+{
+	// Elements attached to the cursor follow the mouse, redraw everything while there are any.
+	if (cursor_proxy && cursor_proxy->HasChildNodes())
+		MarkDamaged();
+
+	root->CollectDamage(this);
+	if (cursor_proxy)
+		cursor_proxy->CollectDamage(this);
+}
+
 using ElementObserverList = std::vector< ObserverPtr<Element> >;
 
 class ElementObserverListBackInserter {
@@ -0,0 +1,74 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "ContextStatistics.h"
+#include "Clock.h"
+
+namespace Rml {
+namespace Core {
+
+ContextStatistics* ContextStatisticsScope::active = nullptr;
+bool ContextStatisticsScope::track_elements = false;
+bool DocumentStatisticsScope::timing = false;
+
+ContextStatisticsScope::ContextStatisticsScope(Context* context, float ContextStatistics::* time) : previous_statistics(active), previous_track_elements(track_elements), time(time), start_time(0)
+{
+	statistics = (context->statistics_enabled ? &context->frame_statistics : nullptr);
+
+	active = statistics;
+	track_elements = (statistics && context->statistics_track_elements);
+
+	if (statistics && time)
+		start_time = Clock::GetElapsedTime();
+}
+
+ContextStatisticsScope::~ContextStatisticsScope()
+{
+	if (statistics && time)
+		statistics->*time += float(Clock::GetElapsedTime() - start_time);
+
+	active = previous_statistics;
+	track_elements = previous_track_elements;
+}
+
+void DocumentStatisticsScope::Start(ElementDocument* document, float DocumentStatistics::* _time)
+{
+	timing = true;
+	statistics = &document->frame_statistics;
+	time = _time;
+	start_time = Clock::GetElapsedTime();
+}
+
+void DocumentStatisticsScope::Stop()
+{
+	statistics->*time += float(Clock::GetElapsedTime() - start_time);
+	timing = false;
+}
+
+}
+}
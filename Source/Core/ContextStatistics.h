@@ -0,0 +1,118 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUICORECONTEXTSTATISTICS_H
+#define RMLUICORECONTEXTSTATISTICS_H
+
+#include "../../Include/RmlUi/Core/Context.h"
+#include "../../Include/RmlUi/Core/ElementDocument.h"
+
+namespace Rml {
+namespace Core {
+
+/**
+	Makes the frame statistics of the given context the target of all statistics counted during its lifetime, restoring
+	the previous target when destroyed. The time spent in the scope is added to the given time member of the statistics.
+
+	Nothing is counted or timed within the scope if statistics are disabled on the context.
+ */
+class ContextStatisticsScope
+{
+public:
+	ContextStatisticsScope(Context* context, float ContextStatistics::* time = nullptr);
+	~ContextStatisticsScope();
+
+	ContextStatisticsScope(const ContextStatisticsScope&) = delete;
+	ContextStatisticsScope& operator=(const ContextStatisticsScope&) = delete;
+
+	/// Returns the statistics currently counted to, or nullptr if statistics are not gathered.
+	static ContextStatistics* GetActive() { return active; }
+	/// Returns true if the formatted and regenerated elements are gathered in the active statistics.
+	static bool IsTrackingElements() { return track_elements; }
+
+private:
+	ContextStatistics* statistics;
+	ContextStatistics* previous_statistics;
+	bool previous_track_elements;
+	float ContextStatistics::* time;
+	double start_time;
+
+	static ContextStatistics* active;
+	static bool track_elements;
+};
+
+/**
+	Adds the time spent in its lifetime to the given time member of the document's frame statistics, while context
+	statistics are active. Nested document scopes are not timed, their time is already part of the outer scope.
+ */
+class DocumentStatisticsScope
+{
+public:
+	DocumentStatisticsScope(ElementDocument* document, float DocumentStatistics::* time) : statistics(nullptr)
+	{
+		if (document && !timing && ContextStatisticsScope::GetActive())
+			Start(document, time);
+	}
+	~DocumentStatisticsScope()
+	{
+		if (statistics)
+			Stop();
+	}
+
+	DocumentStatisticsScope(const DocumentStatisticsScope&) = delete;
+	DocumentStatisticsScope& operator=(const DocumentStatisticsScope&) = delete;
+
+private:
+	void Start(ElementDocument* document, float DocumentStatistics::* time);
+	void Stop();
+
+	DocumentStatistics* statistics;
+	float DocumentStatistics::* time;
+	double start_time;
+
+	static bool timing;
+};
+
+}
+}
+
+/// Adds to one of the counters of the active context statistics, if any. The count is only evaluated when active.
+#define RMLUI_STATISTICS_COUNT(counter, count) \
+	do { \
+		if (::Rml::Core::ContextStatistics* rmlui_statistics = ::Rml::Core::ContextStatisticsScope::GetActive()) \
+			rmlui_statistics->counter += int(count); \
+	} while (false)
+
+/// Adds the element to one of the element lists of the active context statistics, if elements are being tracked.
+#define RMLUI_STATISTICS_TRACK_ELEMENT(list, element) \
+	do { \
+		if (::Rml::Core::ContextStatisticsScope::IsTrackingElements()) \
+			::Rml::Core::ContextStatisticsScope::GetActive()->list.push_back((element)->GetObserverPtr()); \
+	} while (false)
+
+#endif
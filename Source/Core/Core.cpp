@@ -31,15 +31,21 @@
 #include "../../Include/RmlUi/Core/Factory.h"
 #include "../../Include/RmlUi/Core/FileInterface.h"
 #include "../../Include/RmlUi/Core/FontEngineInterface.h"
+#include "../../Include/RmlUi/Core/MemoryInterface.h"
 #include "../../Include/RmlUi/Core/Plugin.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "../../Include/RmlUi/Core/StringUtilities.h"
+#include "../../Include/RmlUi/Core/StyleSheet.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "../../Include/RmlUi/Core/Types.h"
 
 #include "EventSpecification.h"
 #include "FileInterfaceDefault.h"
+#include "GeometryArena.h"
 #include "GeometryDatabase.h"
+#include "LayoutEngine.h"
+#include "Pool.h"
 #include "PluginRegistry.h"
 #include "StyleSheetFactory.h"
 #include "TemplateCache.h"
@@ -62,6 +68,8 @@ static SystemInterface* system_interface = nullptr;
 static FileInterface* file_interface = nullptr;
 // RmlUi's font engine interface.
 static FontEngineInterface* font_interface = nullptr;
+// RmlUi's memory interface.
+static MemoryInterface* memory_interface = nullptr;
 
 // Default interfaces should be created and destroyed on Initialise and Shutdown, respectively.
 static UniquePtr<FileInterface> default_file_interface;
@@ -69,6 +77,11 @@ static UniquePtr<FontEngineInterface> default_font_interface;
 
 static bool initialised = false;
 
+// Rasterize glyphs on a background thread in the default font engine.
+static bool async_glyph_rasterization = false;
+// Directory of the glyph cache of the default font engine, disabled when empty.
+static String glyph_cache_directory;
+
 using ContextMap = UnorderedMap< String, ContextPtr >;
 static ContextMap contexts;
 
@@ -137,6 +150,8 @@ void Shutdown()
 	// Notify all plugins we're being shutdown.
 	PluginRegistry::NotifyShutdown();
 
+	GeometryArena::ReleaseAll();
+
 	TemplateCache::Shutdown();
 	StyleSheetFactory::Shutdown();
 	StyleSheetSpecification::Shutdown();
@@ -147,13 +162,20 @@ void Shutdown()
 
 	initialised = false;
 
+	// Fonts may be mapped through the file interface, and the glyph cache may log messages while storing their glyphs,
+	// so release them while the interfaces are still set.
+	default_font_interface.reset();
+
 	render_interface = nullptr;
 	file_interface = nullptr;
 	system_interface = nullptr;
 	font_interface = nullptr;
 
 	default_file_interface.reset();
-	default_font_interface.reset();
+
+	// Return any cached memory to the memory interface, as it may be destroyed after shutdown.
+	LayoutEngine::ReleaseScratchMemory();
+	PoolBase::ReleaseUnusedChunks();
 }
 
 // Returns the version of this RmlUi library.
@@ -210,6 +232,50 @@ FontEngineInterface* GetFontEngineInterface()
 	return font_interface;
 }
 
+// Sets the interface through which memory is allocated.
+void SetMemoryInterface(MemoryInterface* _memory_interface)
+{
+	RMLUI_ASSERTMSG(!initialised, "The memory interface must be set before initialisation.");
+	memory_interface = _memory_interface;
+}
+
+// Returns RmlUi's memory interface.
+MemoryInterface* GetMemoryInterface()
+{
+	if (memory_interface)
+		return memory_interface;
+
+	// Constructed on first use, as memory may be allocated during static initialisation.
+	static MemoryInterface default_memory_interface;
+	return &default_memory_interface;
+}
+
+// Enables rasterization of glyphs on a background thread.
+void EnableAsyncGlyphRasterization(bool enable)
+{
+	RMLUI_ASSERTMSG(!initialised, "Asynchronous glyph rasterization must be enabled before initialisation.");
+	async_glyph_rasterization = enable;
+}
+
+// Returns true if glyphs are rasterized on a background thread.
+bool IsAsyncGlyphRasterizationEnabled()
+{
+	return async_glyph_rasterization;
+}
+
+// Sets the directory in which the default font engine caches rasterized glyphs between runs.
+void SetGlyphCacheDirectory(const String& directory)
+{
+	RMLUI_ASSERTMSG(!initialised, "The glyph cache directory must be set before initialisation.");
+	glyph_cache_directory = directory;
+}
+
+// Returns the directory of the glyph cache.
+const String& GetGlyphCacheDirectory()
+{
+	return glyph_cache_directory;
+}
+
 // Creates a new element context.
 Context* CreateContext(const String& name, const Vector2i& dimensions, RenderInterface* custom_render_interface)
 {
@@ -309,6 +375,30 @@ bool LoadFontFace(const byte* data, int data_size, const String& font_family, St
 	return font_interface->LoadFontFace(data, data_size, font_family, style, weight, fallback_face);
 }
 
+// Prepares a font face for use ahead of time.
+bool PrewarmFontFace(const String& family, Style::FontStyle style, Style::FontWeight weight, int size, const String& font_effects, const String& characters)
+{
+	FontFaceHandle handle = font_interface->GetFontFaceHandle(StringUtilities::ToLower(family), style, weight, size);
+	if (!handle)
+		return false;
+
+	// The effects are instanced as if declared in a style sheet. Elements instance their own effects, but layers are
+	// shared between effects of the same type and values, so they reuse the textures generated here.
+	FontEffectsHandle font_effects_handle = 0;
+	FontEffectsPtr font_effects_ptr;
+	if (!font_effects.empty())
+	{
+		StyleSheet style_sheet;
+		font_effects_ptr = style_sheet.InstanceFontEffectsFromString(font_effects, nullptr);
+		if (font_effects_ptr)
+			font_effects_handle = font_interface->PrepareFontEffects(handle, font_effects_ptr->list);
+	}
+
+	font_interface->PrewarmGlyphs(handle, font_effects_handle, characters, render_interface);
+
+	return true;
+}
+
 // Registers a generic rmlui plugin
 void RegisterPlugin(Plugin* plugin)
 {
@@ -330,7 +420,8 @@ void ReleaseTextures()
 
 void ReleaseCompiledGeometry()
 {
-	return GeometryDatabase::ReleaseAll();
+	GeometryDatabase::ReleaseAll();
+	GeometryArena::ReleaseAll();
 }
 
 }
@@ -0,0 +1,129 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "DecoratorGeometryCache.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "Utilities.h"
+
+namespace std {
+template <> struct hash<::Rml::Core::DecoratorGeometryKey> {
+	size_t operator()(const ::Rml::Core::DecoratorGeometryKey& key) const
+	{
+		using namespace ::Rml::Core;
+		size_t seed = std::hash<const Decorator*>()(key.decorator);
+		Utilities::HashCombine(seed, key.context);
+		Utilities::HashCombine(seed, key.size.x);
+		Utilities::HashCombine(seed, key.size.y);
+		Utilities::HashCombine(seed, (uint32_t(key.image_color.red) << 24) | (uint32_t(key.image_color.green) << 16) | (uint32_t(key.image_color.blue) << 8) | uint32_t(key.image_color.alpha));
+		Utilities::HashCombine(seed, key.opacity);
+		return seed;
+	}
+};
+}
+
+namespace Rml {
+namespace Core {
+
+DecoratorGeometry::DecoratorGeometry(Context* context, int num_geometry)
+{
+	geometry.reserve(num_geometry);
+	for (int i = 0; i < num_geometry; i++)
+		geometry.emplace_back(context);
+}
+
+void DecoratorGeometry::Render(const Vector2f& translation)
+{
+	for (Geometry& item : geometry)
+		item.Render(translation);
+}
+
+namespace DecoratorGeometryCache {
+
+using GeometryMap = UnorderedMap<DecoratorGeometryKey, UniquePtr<DecoratorGeometry>>;
+static GeometryMap geometry_map;
+
+DecoratorGeometry* Acquire(const Decorator* decorator, Element* element, int num_geometry, bool& out_generate)
+{
+	const ComputedValues& computed = element->GetComputedValues();
+
+	DecoratorGeometryKey key;
+	key.decorator = decorator;
+	key.context = element->GetContext();
+	key.size = element->GetBox().GetSize(Box::PADDING);
+	key.image_color = computed.image_color;
+	key.opacity = computed.opacity;
+
+	auto it = geometry_map.find(key);
+	out_generate = (it == geometry_map.end());
+
+	if (out_generate)
+	{
+		auto decorator_geometry = std::make_unique<DecoratorGeometry>(key.context, num_geometry);
+		decorator_geometry->key = key;
+		decorator_geometry->shared = true;
+		it = geometry_map.emplace(key, std::move(decorator_geometry)).first;
+	}
+
+	DecoratorGeometry* result = it->second.get();
+	RMLUI_ASSERT((int)result->geometry.size() == num_geometry);
+
+	result->num_references += 1;
+
+	return result;
+}
+
+DecoratorGeometry* Create(Element* element, int num_geometry)
+{
+	DecoratorGeometry* result = new DecoratorGeometry(element->GetContext(), num_geometry);
+	result->num_references = 1;
+
+	return result;
+}
+
+void Release(DecoratorGeometry* decorator_geometry)
+{
+	RMLUI_ASSERT(decorator_geometry && decorator_geometry->num_references > 0);
+
+	decorator_geometry->num_references -= 1;
+
+	if (decorator_geometry->num_references > 0)
+		return;
+
+	if (decorator_geometry->shared)
+	{
+		geometry_map.erase(decorator_geometry->key);
+	}
+	else
+	{
+		delete decorator_geometry;
+	}
+}
+
+}
+}
+}
@@ -0,0 +1,99 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUICOREDECORATORGEOMETRYCACHE_H
+#define RMLUICOREDECORATORGEOMETRYCACHE_H
+
+#include "../../Include/RmlUi/Core/Geometry.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+namespace Core {
+
+class Context;
+class Decorator;
+class Element;
+
+struct DecoratorGeometryKey {
+	const Decorator* decorator = nullptr;
+	Context* context = nullptr;
+	Vector2f size;
+	Colourb image_color;
+	float opacity = 1.f;
+
+	bool operator==(const DecoratorGeometryKey& other) const {
+		return decorator == other.decorator && context == other.context && size == other.size && image_color == other.image_color && opacity == other.opacity;
+	}
+};
+
+/**
+	Geometry generated by a decorator, possibly shared between several elements. The geometry is generated relative to
+	the element's padding box and rendered with the translation of each element.
+ */
+struct DecoratorGeometry {
+	DecoratorGeometry(Context* context, int num_geometry);
+
+	void Render(const Vector2f& translation);
+
+	GeometryList geometry;
+
+	DecoratorGeometryKey key;
+	bool shared = false;
+	int num_references = 0;
+};
+
+/**
+	The decorator geometry cache lets elements with identical boxes share the geometry generated by a decorator.
+
+	Geometry is keyed on the decorator, the element's context, the size of its padding box, and its image color and
+	opacity. Entries are reference counted, and destroyed when the last element using them releases its decorator data.
+ */
+
+namespace DecoratorGeometryCache {
+
+	/// Returns the geometry shared by elements with the same box and colours as the given element.
+	/// @param[in] decorator The decorator generating the geometry.
+	/// @param[in] element The element to decorate.
+	/// @param[in] num_geometry The number of geometry objects needed by the decorator.
+	/// @param[out] out_generate Set to true if the geometry was just created, in which case the caller must generate its contents.
+	/// @return The shared geometry, to be released with Release().
+	DecoratorGeometry* Acquire(const Decorator* decorator, Element* element, int num_geometry, bool& out_generate);
+
+	/// Creates geometry private to the given element, for decorators which can not be keyed on the element's box.
+	/// @return The empty geometry, to be released with Release().
+	DecoratorGeometry* Create(Element* element, int num_geometry);
+
+	/// Releases geometry previously returned by Acquire() or Create().
+	void Release(DecoratorGeometry* decorator_geometry);
+
+}
+
+}
+}
+
+#endif
@@ -27,6 +27,7 @@
  */
 
 #include "DecoratorGradient.h"
+#include "DecoratorGeometryCache.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Geometry.h"
 #include "../../Include/RmlUi/Core/GeometryUtilities.h"
@@ -66,7 +67,12 @@ bool DecoratorGradient::Initialise(const Direction &dir_, const Colourb &start_,
 
 DecoratorDataHandle DecoratorGradient::GenerateElementData(Element* element) const
 {
-	auto *data = new Geometry(element);
+	bool generate = false;
+	DecoratorGeometry* data = DecoratorGeometryCache::Acquire(this, element, 1, generate);
+	if (!generate)
+		return reinterpret_cast<DecoratorDataHandle>(data);
+
+	Geometry& geometry = data->geometry[0];
 	Vector2f padded_size = element->GetBox().GetSize(Box::PADDING);
 
 	const float opacity = element->GetComputedValues().opacity;
@@ -77,10 +83,10 @@ DecoratorDataHandle DecoratorGradient::GenerateElementData(Element* element) con
 	Colourb colour_stop = stop;
 	colour_stop.alpha = (byte)(opacity * (float)colour_stop.alpha);
 
-	auto &vertices = data->GetVertices();
+	auto &vertices = geometry.GetVertices();
 	vertices.resize(4);
 
-	auto &indices = data->GetIndices();
+	auto &indices = geometry.GetIndices();
 	indices.resize(6);
 
 	GeometryUtilities::GenerateQuad(&vertices[0], &indices[0], Vector2f(0, 0), padded_size, colour_start, 0);
@@ -91,18 +97,17 @@ DecoratorDataHandle DecoratorGradient::GenerateElementData(Element* element) con
 		vertices[2].colour = vertices[3].colour = colour_stop;
 	}
 
-	data->SetHostElement(element);
 	return reinterpret_cast<DecoratorDataHandle>(data);
 }
 
 void DecoratorGradient::ReleaseElementData(DecoratorDataHandle element_data) const
 {
-	delete reinterpret_cast<Geometry*>(element_data);
+	DecoratorGeometryCache::Release(reinterpret_cast<DecoratorGeometry*>(element_data));
 }
 
 void DecoratorGradient::RenderElement(Element* element, DecoratorDataHandle element_data) const
 {
-	auto* data = reinterpret_cast<Geometry*>(element_data);
+	auto* data = reinterpret_cast<DecoratorGeometry*>(element_data);
 	data->Render(element->GetAbsoluteOffset(Box::PADDING).Round());
 }
 
@@ -27,6 +27,7 @@
  */
 
 #include "DecoratorNinePatch.h"
+#include "DecoratorGeometryCache.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Geometry.h"
 #include "../../Include/RmlUi/Core/ElementUtilities.h"
@@ -57,13 +58,27 @@ bool DecoratorNinePatch::Initialise(const Rectangle& _rect_outer, const Rectangl
 
 DecoratorDataHandle DecoratorNinePatch::GenerateElementData(Element* element) const
 {
+	// Edges may be specified in units relative to the element, in which case the geometry is not shared with other elements.
+	DecoratorGeometry* data = nullptr;
+	if (edges)
+	{
+		data = DecoratorGeometryCache::Create(element, 1);
+	}
+	else
+	{
+		bool generate = false;
+		data = DecoratorGeometryCache::Acquire(this, element, 1, generate);
+		if (!generate)
+			return reinterpret_cast<DecoratorDataHandle>(data);
+	}
+
 	RenderInterface* render_interface = element->GetRenderInterface();
 	const auto& computed = element->GetComputedValues();
 
-	Geometry* data = new Geometry(element);
+	Geometry& geometry = data->geometry[0];
 
 	const Texture* texture = GetTexture();
-	data->SetTexture(texture);
+	geometry.SetTexture(texture);
 	const Vector2i texture_dimensions_i = texture->GetDimensions(render_interface);
 	const Vector2f texture_dimensions = { (float)texture_dimensions_i.x, (float)texture_dimensions_i.y };
 
@@ -128,8 +143,8 @@ DecoratorDataHandle DecoratorNinePatch::GenerateElementData(Element* element) co
 
 	/* Now we have all the coordinates we need. Expand the diagonal vertices to the 16 individual vertices. */
 
-	std::vector<Vertex>& vertices = data->GetVertices();
-	std::vector<int>& indices = data->GetIndices();
+	std::vector<Vertex>& vertices = geometry.GetVertices();
+	std::vector<int>& indices = geometry.GetIndices();
 
 	vertices.resize(4 * 4);
 
@@ -166,12 +181,12 @@ DecoratorDataHandle DecoratorNinePatch::GenerateElementData(Element* element) co
 
 void DecoratorNinePatch::ReleaseElementData(DecoratorDataHandle element_data) const
 {
-	delete reinterpret_cast< Geometry* >(element_data);
+	DecoratorGeometryCache::Release(reinterpret_cast<DecoratorGeometry*>(element_data));
 }
 
 void DecoratorNinePatch::RenderElement(Element* element, DecoratorDataHandle element_data) const
 {
-	Geometry* data = reinterpret_cast< Geometry* >(element_data);
+	DecoratorGeometry* data = reinterpret_cast<DecoratorGeometry*>(element_data);
 	data->Render(element->GetAbsoluteOffset(Box::PADDING).Round());
 }
 
@@ -27,30 +27,13 @@
  */
 
 #include "DecoratorTiledBox.h"
+#include "DecoratorGeometryCache.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Geometry.h"
 
 namespace Rml {
 namespace Core {
 
-struct DecoratorTiledBoxData
-{
-	DecoratorTiledBoxData(Element* host_element, int num_textures) : num_textures(num_textures)
-	{
-		geometry = new Geometry[num_textures];
-		for (int i = 0; i < num_textures; i++)
-			geometry[i].SetHostElement(host_element);
-	}
-
-	~DecoratorTiledBoxData()
-	{
-		delete[] geometry;
-	}
-
-	const int num_textures;
-	Geometry* geometry;
-};
-
 DecoratorTiledBox::DecoratorTiledBox()
 {
 }
@@ -113,6 +96,13 @@ bool DecoratorTiledBox::Initialise(const Tile* _tiles, const Texture* _textures)
 // Called on a decorator to generate any required per-element data for a newly decorated element.
 DecoratorDataHandle DecoratorTiledBox::GenerateElementData(Element* element) const
 {
+	const int num_textures = GetNumTextures();
+
+	bool generate = false;
+	DecoratorGeometry* data = DecoratorGeometryCache::Acquire(this, element, num_textures, generate);
+	if (!generate)
+		return reinterpret_cast<DecoratorDataHandle>(data);
+
 	// Initialise the tiles for this element.
 	for (int i = 0; i < 9; i++)
 	{
@@ -196,9 +186,6 @@ DecoratorDataHandle DecoratorTiledBox::GenerateElementData(Element* element) con
 			bottom_dimensions.y = bottom_right_dimensions.y;
 	}
 
-	const int num_textures = GetNumTextures();
-	DecoratorTiledBoxData* data = new DecoratorTiledBoxData(element, num_textures);
-
 	// Generate the geometry for the top-left tile.
 	tiles[TOP_LEFT_CORNER].GenerateGeometry(data->geometry[tiles[TOP_LEFT_CORNER].texture_index].GetVertices(),
 											data->geometry[tiles[TOP_LEFT_CORNER].texture_index].GetIndices(),
@@ -283,17 +270,16 @@ DecoratorDataHandle DecoratorTiledBox::GenerateElementData(Element* element) con
 // Called to release element data generated by this decorator.
 void DecoratorTiledBox::ReleaseElementData(DecoratorDataHandle element_data) const
 {
-	delete reinterpret_cast< DecoratorTiledBoxData* >(element_data);
+	DecoratorGeometryCache::Release(reinterpret_cast<DecoratorGeometry*>(element_data));
 }
 
 // Called to render the decorator on an element.
 void DecoratorTiledBox::RenderElement(Element* element, DecoratorDataHandle element_data) const
 {
 	Vector2f translation = element->GetAbsoluteOffset(Box::PADDING).Round();
-	DecoratorTiledBoxData* data = reinterpret_cast< DecoratorTiledBoxData* >(element_data);
+	DecoratorGeometry* data = reinterpret_cast<DecoratorGeometry*>(element_data);
 
-	for (int i = 0; i < data->num_textures; i++)
-		data->geometry[i].Render(translation);
+	data->Render(translation);
 }
 
 }
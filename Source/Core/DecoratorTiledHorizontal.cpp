@@ -27,6 +27,7 @@
  */
 
 #include "DecoratorTiledHorizontal.h"
+#include "DecoratorGeometryCache.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Geometry.h"
 #include "../../Include/RmlUi/Core/Texture.h"
@@ -34,24 +35,6 @@
 namespace Rml {
 namespace Core {
 
-struct DecoratorTiledHorizontalData
-{
-	DecoratorTiledHorizontalData(Element* host_element, int num_textures) : num_textures(num_textures)
-	{
-		geometry = new Geometry[num_textures];
-		for (int i = 0; i < num_textures; i++)
-			geometry[i].SetHostElement(host_element);
-	}
-
-	~DecoratorTiledHorizontalData()
-	{
-		delete[] geometry;
-	}
-
-	const int num_textures;
-	Geometry* geometry;
-};
-
 DecoratorTiledHorizontal::DecoratorTiledHorizontal()
 {
 }
@@ -93,13 +76,17 @@ bool DecoratorTiledHorizontal::Initialise(const Tile* _tiles, const Texture* _te
 // Called on a decorator to generate any required per-element data for a newly decorated element.
 DecoratorDataHandle DecoratorTiledHorizontal::GenerateElementData(Element* element) const
 {
+	const int num_textures = GetNumTextures();
+
+	bool generate = false;
+	DecoratorGeometry* data = DecoratorGeometryCache::Acquire(this, element, num_textures, generate);
+	if (!generate)
+		return reinterpret_cast<DecoratorDataHandle>(data);
+
 	// Initialise the tiles for this element.
 	for (int i = 0; i < 3; i++)
 		tiles[i].CalculateDimensions(element, *(GetTexture(tiles[i].texture_index)));
 
-	const int num_textures = GetNumTextures();
-	DecoratorTiledHorizontalData* data = new DecoratorTiledHorizontalData(element, num_textures);
-
 	Vector2f padded_size = element->GetBox().GetSize(Box::PADDING);
 
 	Vector2f left_dimensions = tiles[LEFT].GetDimensions(element);
@@ -142,17 +129,16 @@ DecoratorDataHandle DecoratorTiledHorizontal::GenerateElementData(Element* eleme
 // Called to release element data generated by this decorator.
 void DecoratorTiledHorizontal::ReleaseElementData(DecoratorDataHandle element_data) const
 {
-	delete reinterpret_cast< DecoratorTiledHorizontalData* >(element_data);
+	DecoratorGeometryCache::Release(reinterpret_cast<DecoratorGeometry*>(element_data));
 }
 
 // Called to render the decorator on an element.
 void DecoratorTiledHorizontal::RenderElement(Element* element, DecoratorDataHandle element_data) const
 {
 	Vector2f translation = element->GetAbsoluteOffset(Box::PADDING).Round();
-	DecoratorTiledHorizontalData* data = reinterpret_cast< DecoratorTiledHorizontalData* >(element_data);
+	DecoratorGeometry* data = reinterpret_cast<DecoratorGeometry*>(element_data);
 
-	for (int i = 0; i < data->num_textures; i++)
-		data->geometry[i].Render(translation);
+	data->Render(translation);
 }
 
 }
@@ -27,6 +27,7 @@
  */
 
 #include "DecoratorTiledImage.h"
+#include "DecoratorGeometryCache.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Geometry.h"
 #include "../../Include/RmlUi/Core/GeometryUtilities.h"
@@ -52,14 +53,19 @@ bool DecoratorTiledImage::Initialise(const Tile& _tile, const Texture& _texture)
 // Called on a decorator to generate any required per-element data for a newly decorated element.
 DecoratorDataHandle DecoratorTiledImage::GenerateElementData(Element* element) const
 {
+	bool generate = false;
+	DecoratorGeometry* data = DecoratorGeometryCache::Acquire(this, element, 1, generate);
+	if (!generate)
+		return reinterpret_cast<DecoratorDataHandle>(data);
+
 	// Calculate the tile's dimensions for this element.
 	tile.CalculateDimensions(element, *GetTexture(tile.texture_index));
 
-	Geometry* data = new Geometry(element);
-	data->SetTexture(GetTexture());
+	Geometry& geometry = data->geometry[0];
+	geometry.SetTexture(GetTexture());
 
 	// Generate the geometry for the tile.
-	tile.GenerateGeometry(data->GetVertices(), data->GetIndices(), element, Vector2f(0, 0), element->GetBox().GetSize(Box::PADDING), tile.GetDimensions(element));
+	tile.GenerateGeometry(geometry.GetVertices(), geometry.GetIndices(), element, Vector2f(0, 0), element->GetBox().GetSize(Box::PADDING), tile.GetDimensions(element));
 
 	return reinterpret_cast<DecoratorDataHandle>(data);
 }
@@ -67,13 +73,13 @@ DecoratorDataHandle DecoratorTiledImage::GenerateElementData(Element* element) c
 // Called to release element data generated by this decorator.
 void DecoratorTiledImage::ReleaseElementData(DecoratorDataHandle element_data) const
 {
-	delete reinterpret_cast< Geometry* >(element_data);
+	DecoratorGeometryCache::Release(reinterpret_cast<DecoratorGeometry*>(element_data));
 }
 
 // Called to render the decorator on an element.
 void DecoratorTiledImage::RenderElement(Element* element, DecoratorDataHandle element_data) const
 {
-	Geometry* data = reinterpret_cast< Geometry* >(element_data);
+	DecoratorGeometry* data = reinterpret_cast<DecoratorGeometry*>(element_data);
 	data->Render(element->GetAbsoluteOffset(Box::PADDING).Round());
 }
 
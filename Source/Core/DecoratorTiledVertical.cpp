@@ -27,6 +27,7 @@
  */
 
 #include "DecoratorTiledVertical.h"
+#include "DecoratorGeometryCache.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Geometry.h"
 #include "../../Include/RmlUi/Core/GeometryUtilities.h"
@@ -35,24 +36,6 @@
 namespace Rml {
 namespace Core {
 
-struct DecoratorTiledVerticalData
-{
-	DecoratorTiledVerticalData(Element* host_element, int num_textures) : num_textures(num_textures)
-	{
-		geometry = new Geometry[num_textures];
-		for (int i = 0; i < num_textures; i++)
-			geometry[i].SetHostElement(host_element);
-	}
-
-	~DecoratorTiledVerticalData()
-	{
-		delete[] geometry;
-	}
-
-	const int num_textures;
-	Geometry* geometry;
-};
-
 DecoratorTiledVertical::DecoratorTiledVertical()
 {
 }
@@ -94,13 +77,17 @@ bool DecoratorTiledVertical::Initialise(const Tile* _tiles, const Texture* _text
 // Called on a decorator to generate any required per-element data for a newly decorated element.
 DecoratorDataHandle DecoratorTiledVertical::GenerateElementData(Element* element) const
 {
+	const int num_textures = GetNumTextures();
+
+	bool generate = false;
+	DecoratorGeometry* data = DecoratorGeometryCache::Acquire(this, element, num_textures, generate);
+	if (!generate)
+		return reinterpret_cast<DecoratorDataHandle>(data);
+
 	// Initialise the tile for this element.
 	for (int i = 0; i < 3; i++)
 		tiles[i].CalculateDimensions(element, *GetTexture(tiles[i].texture_index));
 
-	const int num_textures = GetNumTextures();
-	DecoratorTiledVerticalData* data = new DecoratorTiledVerticalData(element, num_textures);
-
 	Vector2f padded_size = element->GetBox().GetSize(Box::PADDING);
 
 	Vector2f top_dimensions = tiles[TOP].GetDimensions(element);
@@ -143,17 +130,16 @@ DecoratorDataHandle DecoratorTiledVertical::GenerateElementData(Element* element
 // Called to release element data generated by this decorator.
 void DecoratorTiledVertical::ReleaseElementData(DecoratorDataHandle element_data) const
 {
-	delete reinterpret_cast< DecoratorTiledVerticalData* >(element_data);
+	DecoratorGeometryCache::Release(reinterpret_cast<DecoratorGeometry*>(element_data));
 }
 
 // Called to render the decorator on an element.
 void DecoratorTiledVertical::RenderElement(Element* element, DecoratorDataHandle element_data) const
 {
 	Vector2f translation = element->GetAbsoluteOffset(Box::PADDING).Round();
-	DecoratorTiledVerticalData* data = reinterpret_cast< DecoratorTiledVerticalData* >(element_data);
+	DecoratorGeometry* data = reinterpret_cast<DecoratorGeometry*>(element_data);
 
-	for (int i = 0; i < data->num_textures; i++)
-		data->geometry[i].Render(translation);
+	data->Render(translation);
 }
 
 }
@@ -45,6 +45,7 @@
 #include "../../Include/RmlUi/Core/TransformState.h"
 #include "Clock.h"
 #include "ComputeProperty.h"
+#include "ContextStatistics.h"
 #include "ElementAnimation.h"
 #include "ElementBackground.h"
 #include "ElementBorder.h"
@@ -53,6 +54,7 @@
 #include "EventDispatcher.h"
 #include "EventSpecification.h"
 #include "ElementDecoration.h"
+#include "ElementLayer.h"
 #include "LayoutEngine.h"
 #include "PluginRegistry.h"
 #include "PropertiesIterator.h"
@@ -98,23 +100,54 @@ static constexpr int ChildNotifyLevels = 2;
 // Meta objects for element collected in a single struct to reduce memory allocations
 struct ElementMeta
 {
-	ElementMeta(Element* el) : event_dispatcher(el), style(el), background(el), border(el), decoration(el), scroll(el) {}
+	ElementMeta(Element* el) : event_dispatcher(el), style(el), decoration(el), scroll(el) {}
 	EventDispatcher event_dispatcher;
 	ElementStyle style;
-	ElementBackground background;
-	ElementBorder border;
 	ElementDecoration decoration;
 	ElementScroll scroll;
 	Style::ComputedValues computed_values;
+	// The background and border are only created once the element has a visible background or border.
+	UniquePtr<ElementBackground> background;
+	UniquePtr<ElementBorder> border;
+	UniquePtr<ElementLayer> layer;
+};
+
+// Culling bounds of an element in a local stacking context
+struct StackingContextCullData
+{
+	// The bounds of the element's own boxes, and of the element together with its descendants in the stacking context.
+	Vector2f own_min, own_max;
+	Vector2f subtree_min, subtree_max;
+	// The index one past the last descendant of the element in the stacking context.
+	int subtree_end;
+	// Unbounded elements may render outside their bounds, such as when transformed, and are never culled.
+	bool own_bounded;
+	bool subtree_bounded;
+};
+
+// State used by few elements, kept out of the element to make it smaller for the common case
+struct ElementColdData
+{
+	ElementAnimationList animations;
+	ElementList stacking_context;
+	std::vector< Box > additional_boxes;
+
+	// Culling bounds of the stacking context, valid while the generation matches the clipping generation.
+	std::vector< StackingContextCullData > stacking_context_cull_data;
+	unsigned int stacking_context_cull_generation = 0;
 };
 
 
-static Pool< ElementMeta > element_meta_chunk_pool(200, true);
+static Pool< ElementMeta > element_meta_chunk_pool(200, true, MemoryCategory::Elements);
+static Pool< ElementColdData > element_cold_data_pool(200, true, MemoryCategory::Elements);
+
+// Incremented whenever a change could affect the clipping region of any element, starts above the initial element generation.
+unsigned int Element::clipping_generation = 1;
 
 
 /// Constructs a new RmlUi element.
-Element::Element(const String& tag) : tag(tag), relative_offset_base(0, 0), relative_offset_position(0, 0), absolute_offset(0, 0), scroll_offset(0, 0), content_offset(0, 0), content_box(0, 0), 
-transform_state(), dirty_transform(false), dirty_perspective(false), dirty_animation(false), dirty_transition(false)
+Element::Element(const String& tag) : content_offset(0, 0), content_box(0, 0), relative_offset_base(0, 0), relative_offset_position(0, 0), absolute_offset(0, 0), scroll_offset(0, 0),
+dirty_transform(false), dirty_parent_transform(false), dirty_perspective(false), dirty_animation(false), dirty_transition(false), transform_state(), cold_data(nullptr), tag(tag)
 {
 	RMLUI_ASSERT(tag == StringUtilities::ToLower(tag));
 	parent = nullptr;
@@ -145,6 +178,17 @@ transform_state(), dirty_transform(false), dirty_perspective(false), dirty_anima
 	clipping_ignore_depth = 0;
 	clipping_enabled = false;
 	clipping_state_dirty = true;
+	clip_region_valid = false;
+	clip_generation = 0;
+
+	damage_pending = false;
+	child_damage_pending = false;
+	layer_damage_pending = false;
+
+	// New elements need to be styled on the first update.
+	update_pending = true;
+	child_update_pending = false;
+	update_every_frame = false;
 
 	meta = element_meta_chunk_pool.AllocateAndConstruct(this);
 }
@@ -172,6 +216,9 @@ Element::~Element()
 	num_non_dom_children = 0;
 
 	element_meta_chunk_pool.DestroyAndDeallocate(meta);
+
+	if (cold_data)
+		element_cold_data_pool.DestroyAndDeallocate(cold_data);
 }
 
 void Element::Update(float dp_ratio)
@@ -182,28 +229,55 @@ void Element::Update(float dp_ratio)
 	RMLUI_ZoneText(name.c_str(), name.size());
 #endif
 
-	OnUpdate();
+	// Skip subtrees where nothing needs to be updated.
+	if (!update_pending && !child_update_pending)
+		return;
+
+	DocumentStatisticsScope statistics_scope(owner_document == this ? owner_document : nullptr, &DocumentStatistics::style_time);
 
-	UpdateStructure();
+	if (update_pending)
+	{
+		// Cleared first, so that any changes made during the update are picked up on the next update.
+		update_pending = false;
 
-	HandleTransitionProperty();
-	HandleAnimationProperty();
-	AdvanceAnimations();
+		RMLUI_STATISTICS_COUNT(num_elements_updated, 1);
 
-	meta->scroll.Update();
+		OnUpdate();
 
-	UpdateProperties();
+		UpdateStructure();
 
-	// Do en extra pass over the animations and properties if the 'animation' property was just changed.
-	if (dirty_animation)
-	{
+		HandleTransitionProperty();
 		HandleAnimationProperty();
 		AdvanceAnimations();
+
+		const bool scrollbars_active = meta->scroll.Update();
+
 		UpdateProperties();
+
+		// Do en extra pass over the animations and properties if the 'animation' property was just changed.
+		if (dirty_animation)
+		{
+			HandleAnimationProperty();
+			AdvanceAnimations();
+			UpdateProperties();
+		}
+
+		// Running animations and held scrollbar arrows need to advance on the next update as well.
+		if (update_every_frame || scrollbars_active || (cold_data && !cold_data->animations.empty()))
+			RequestUpdate();
 	}
 
-	for (size_t i = 0; i < children.size(); i++)
-		children[i]->Update(dp_ratio);
+	if (child_update_pending)
+	{
+		child_update_pending = false;
+
+		for (size_t i = 0; i < children.size(); i++)
+		{
+			Element* child = children[i].get();
+			if (child->update_pending || child->child_update_pending)
+				child->Update(dp_ratio);
+		}
+	}
 }
 
 
@@ -246,16 +320,48 @@ void Element::Render()
 	RMLUI_ZoneText(name.c_str(), name.size());
 #endif
 
+	DocumentStatisticsScope statistics_scope(owner_document == this ? owner_document : nullptr, &DocumentStatistics::render_time);
+
 	// Rebuild our stacking context if necessary.
 	if (stacking_context_dirty)
 		BuildLocalStackingContext();
 
 	UpdateTransformState();
 
+	// Cached elements render their whole stacking context from the layer.
+	if (meta->layer && meta->layer->RenderLayer())
+		return;
+
+	RenderStackingContext();
+}
+
+void Element::RenderStackingContext()
+{
+	const ElementList& stacking_context = GetLocalStackingContext();
+
+	// Elements in our stacking context are culled against the viewport, or the damaged region being redrawn. Layers
+	// are captured in full, so nothing is culled while capturing.
+	bool culling = false;
+	Vector2f cull_min, cull_max;
+
+	Context* context = (stacking_context.empty() || ElementLayer::GetCaptureElement() ? nullptr : GetContext());
+	if (context)
+	{
+		Vector2i region_origin(0, 0);
+		Vector2i region_dimensions = context->GetDimensions();
+		context->GetRedrawRegion(region_origin, region_dimensions);
+
+		cull_min = Vector2f((float)region_origin.x, (float)region_origin.y);
+		cull_max = Vector2f((float)(region_origin.x + region_dimensions.x), (float)(region_origin.y + region_dimensions.y));
+		culling = true;
+
+		UpdateStackingContextCullData();
+	}
+
 	// Render all elements in our local stacking context that have a z-index beneath our local index of 0.
 	size_t i = 0;
-	for (; i < stacking_context.size() && stacking_context[i]->z_index < 0; ++i)
-		stacking_context[i]->Render();
+	while (i < stacking_context.size() && stacking_context[i]->z_index < 0)
+		i = RenderStackingContextElement(i, culling, cull_min, cull_max);
 
 	// Apply our transform
 	ElementUtilities::ApplyTransform(*this);
@@ -263,8 +369,13 @@ void Element::Render()
 	// Set up the clipping region for this element.
 	if (ElementUtilities::SetClippingRegion(this))
 	{
-		meta->background.RenderBackground();
-		meta->border.RenderBorder();
+		const ComputedValues& computed = meta->computed_values;
+
+		if (computed.background_color.alpha > 0)
+			GetElementBackground()->RenderBackground();
+		if (computed.border_top_width > 0 || computed.border_right_width > 0 || computed.border_bottom_width > 0 || computed.border_left_width > 0)
+			GetElementBorder()->RenderBorder();
+
 		meta->decoration.RenderDecorators();
 
 		{
@@ -275,8 +386,155 @@ void Element::Render()
 	}
 
 	// Render the rest of the elements in the stacking context.
-	for (; i < stacking_context.size(); ++i)
-		stacking_context[i]->Render();
+	while (i < stacking_context.size())
+		i = RenderStackingContextElement(i, culling, cull_min, cull_max);
+}
+
+// Returns true if the bounds are entirely outside the region, with a pixel of margin for rounding during rendering.
+static inline bool IsOutsideRegion(const Vector2f& bounds_min, const Vector2f& bounds_max, const Vector2f& region_min, const Vector2f& region_max)
+{
+	return bounds_max.x < region_min.x - 1.f || bounds_max.y < region_min.y - 1.f ||
+		bounds_min.x > region_max.x + 1.f || bounds_min.y > region_max.y + 1.f;
+}
+
+size_t Element::RenderStackingContextElement(size_t index, bool culling, const Vector2f& cull_min, const Vector2f& cull_max)
+{
+	Element* element = cold_data->stacking_context[index];
+
+	if (culling)
+	{
+		const StackingContextCullData& cull_data = cold_data->stacking_context_cull_data[index];
+
+		// Restrict the culling region to the element's clipping region, which also contains its bounded descendants.
+		Vector2f region_min = cull_min;
+		Vector2f region_max = cull_max;
+
+		Vector2i clip_origin, clip_dimensions;
+		if (ElementUtilities::GetClippingRegion(clip_origin, clip_dimensions, element))
+		{
+			region_min.x = Math::Max(region_min.x, (float)clip_origin.x);
+			region_min.y = Math::Max(region_min.y, (float)clip_origin.y);
+			region_max.x = Math::Min(region_max.x, (float)(clip_origin.x + clip_dimensions.x));
+			region_max.y = Math::Min(region_max.y, (float)(clip_origin.y + clip_dimensions.y));
+		}
+
+		if (cull_data.subtree_bounded && IsOutsideRegion(cull_data.subtree_min, cull_data.subtree_max, region_min, region_max))
+		{
+			RMLUI_STATISTICS_COUNT(num_elements_culled, cull_data.subtree_end - (int)index);
+			return (size_t)cull_data.subtree_end;
+		}
+
+		// Elements with a local stacking context render their descendants as well, so they can only be culled with them.
+		if (cull_data.own_bounded && !element->local_stacking_context && IsOutsideRegion(cull_data.own_min, cull_data.own_max, region_min, region_max))
+		{
+			RMLUI_STATISTICS_COUNT(num_elements_culled, 1);
+			return index + 1;
+		}
+	}
+
+	element->Render();
+
+	return index + 1;
+}
+
+void Element::UpdateStackingContextCullData()
+{
+	ElementColdData& data = *cold_data;
+	if (data.stacking_context_cull_generation == clipping_generation)
+		return;
+
+	data.stacking_context_cull_generation = clipping_generation;
+
+	const ElementList& stacking_context = data.stacking_context;
+	std::vector< StackingContextCullData >& cull_data = data.stacking_context_cull_data;
+
+	const int num_elements = (int)stacking_context.size();
+	cull_data.resize(num_elements);
+
+	// The stacking context lists descendants right after their ancestors, except for those with a non-zero z-index
+	// which are sorted to either end. Find the range of descendants of each element, and its closest ancestor.
+	std::vector< int > parent_indices(num_elements, -1);
+	std::vector< int > open_ancestors;
+
+	for (int i = 0; i < num_elements; i++)
+	{
+		Element* element = stacking_context[i];
+		StackingContextCullData& element_data = cull_data[i];
+
+		// Transformed elements may render anywhere. Elements which are about to be transformed are also treated as
+		// unbounded, while they are being transformed the clipping generation is changed.
+		element_data.own_bounded = !element->transform_state && !element->dirty_transform && !element->dirty_parent_transform && !element->dirty_perspective;
+
+		// The descendants must be clipped by the same ancestors as the element, and be rendered as part of this
+		// stacking context.
+		element_data.subtree_bounded = element_data.own_bounded && element->GetClippingIgnoreDepth() == 0 &&
+			!(element->local_stacking_context && !element->children.empty());
+
+		const Vector2f border_offset = element->GetAbsoluteOffset(Box::BORDER);
+		element_data.own_min = border_offset;
+		element_data.own_max = border_offset + element->main_box.GetSize(Box::BORDER);
+
+		if (element->cold_data)
+		{
+			for (const Box& box : element->cold_data->additional_boxes)
+			{
+				const Vector2f box_min = border_offset + box.GetOffset();
+				const Vector2f box_max = box_min + box.GetSize(Box::BORDER);
+				element_data.own_min = Vector2f(Math::Min(element_data.own_min.x, box_min.x), Math::Min(element_data.own_min.y, box_min.y));
+				element_data.own_max = Vector2f(Math::Max(element_data.own_max.x, box_max.x), Math::Max(element_data.own_max.y, box_max.y));
+			}
+		}
+
+		// Glyphs and font effects may extend outside the boxes of text, allow them up to the font size.
+		const float overflow_margin = element->meta->computed_values.font_size;
+		element_data.own_min -= Vector2f(overflow_margin, overflow_margin);
+		element_data.own_max += Vector2f(overflow_margin, overflow_margin);
+
+		element_data.subtree_min = element_data.own_min;
+		element_data.subtree_max = element_data.own_max;
+		element_data.subtree_end = i + 1;
+
+		// Elements with a non-zero z-index are not rendered with the range of their ancestors.
+		if (element->z_index != 0)
+		{
+			if (element->z_index > 0)
+			{
+				for (int ancestor_index : open_ancestors)
+					cull_data[ancestor_index].subtree_end = i;
+				open_ancestors.clear();
+			}
+			continue;
+		}
+
+		while (!open_ancestors.empty() && stacking_context[open_ancestors.back()] != element->parent)
+		{
+			cull_data[open_ancestors.back()].subtree_end = i;
+			open_ancestors.pop_back();
+		}
+
+		if (!open_ancestors.empty())
+			parent_indices[i] = open_ancestors.back();
+
+		open_ancestors.push_back(i);
+	}
+
+	for (int ancestor_index : open_ancestors)
+		cull_data[ancestor_index].subtree_end = num_elements;
+
+	// Descendants come after their ancestors, so merging in reverse order accumulates the bounds of whole subtrees.
+	for (int i = num_elements - 1; i >= 0; i--)
+	{
+		const int parent_index = parent_indices[i];
+		if (parent_index < 0)
+			continue;
+
+		const StackingContextCullData& element_data = cull_data[i];
+		StackingContextCullData& parent_data = cull_data[parent_index];
+
+		parent_data.subtree_bounded = parent_data.subtree_bounded && element_data.subtree_bounded;
+		parent_data.subtree_min = Vector2f(Math::Min(parent_data.subtree_min.x, element_data.subtree_min.x), Math::Min(parent_data.subtree_min.y, element_data.subtree_min.y));
+		parent_data.subtree_max = Vector2f(Math::Max(parent_data.subtree_max.x, element_data.subtree_max.x), Math::Max(parent_data.subtree_max.y, element_data.subtree_max.y));
+	}
 }
 
 // Clones this element, returning a new, unparented element.
@@ -455,7 +713,11 @@ Vector2f Element::GetAbsoluteOffset(Box::Area area)
 // Sets an alternate area to use as the client area.
 void Element::SetClientArea(Box::Area _client_area)
 {
-	client_area = _client_area;
+	if (client_area != _client_area)
+	{
+		client_area = _client_area;
+		DirtyClippingRegions();
+	}
 }
 
 // Returns the area the element uses as its client area.
@@ -480,34 +742,44 @@ void Element::SetContentBox(const Vector2f& _content_offset, const Vector2f& _co
 		scroll_offset.x = Math::Min(scroll_offset.x, GetScrollWidth() - GetClientWidth());
 		scroll_offset.y = Math::Min(scroll_offset.y, GetScrollHeight() - GetClientHeight());
 		DirtyOffset();
+		DirtyClippingRegions();
 	}
 }
 
 // Sets the box describing the size of the element.
 void Element::SetBox(const Box& box)
 {
-	if (box != main_box || additional_boxes.size() > 0)
+	if (box != main_box || (cold_data && !cold_data->additional_boxes.empty()))
 	{
+		MarkDamaged();
+
 		main_box = box;
-		additional_boxes.clear();
+		if (cold_data)
+			cold_data->additional_boxes.clear();
 
 		OnResize();
 
-		meta->background.DirtyBackground();
-		meta->border.DirtyBorder();
+		DirtyBackgroundAndBorder();
 		meta->decoration.DirtyDecorators();
+		DirtyClippingRegions();
+
+		// The transform and perspective origins are relative to the box.
+		if (transform_state)
+			DirtyTransformState(true, true);
 	}
 }
 
 // Adds a box to the end of the list describing this element's geometry.
 void Element::AddBox(const Box& box)
 {
-	additional_boxes.push_back(box);
+	MarkDamaged();
+
+	GetColdData().additional_boxes.push_back(box);
 
 	OnResize();
+	DirtyClippingRegions();
 
-	meta->background.DirtyBackground();
-	meta->border.DirtyBorder();
+	DirtyBackgroundAndBorder();
 	meta->decoration.DirtyDecorators();
 }
 
@@ -524,16 +796,16 @@ const Box& Element::GetBox(int index)
 		return main_box;
 	
 	int additional_box_index = index - 1;
-	if (additional_box_index >= (int)additional_boxes.size())
+	if (!cold_data || additional_box_index >= (int)cold_data->additional_boxes.size())
 		return main_box;
 
-	return additional_boxes[additional_box_index];
+	return cold_data->additional_boxes[additional_box_index];
 }
 
 // Returns the number of boxes making up this element's geometry.
 int Element::GetNumBoxes()
 {
-	return 1 + (int)additional_boxes.size();
+	return 1 + (cold_data ? (int)cold_data->additional_boxes.size() : 0);
 }
 
 // Returns the baseline of the element, in pixels offset from the bottom of the element's content area.
@@ -1395,6 +1667,8 @@ ElementPtr Element::RemoveChild(Element* child)
 		// Add the element to the delete list
 		if (itr->get() == child)
 		{
+			child->MarkSubtreeDamaged();
+
 			Element* ancestor = child;
 			for (int i = 0; i <= ChildNotifyLevels && ancestor; i++, ancestor = ancestor->GetParentNode())
 				ancestor->OnChildRemove(child);
@@ -1490,16 +1764,20 @@ String Element::GetEventDispatcherSummary() const
 	return meta->event_dispatcher.ToString();
 }
 
-// Access the element background.
+// Access the element background, creating it if necessary.
 ElementBackground* Element::GetElementBackground() const
 {
-	return &meta->background;
+	if (!meta->background)
+		meta->background = std::make_unique<ElementBackground>(const_cast<Element*>(this));
+	return meta->background.get();
 }
 
-// Access the element border.
+// Access the element border, creating it if necessary.
 ElementBorder* Element::GetElementBorder() const
 {
-	return &meta->border;
+	if (!meta->border)
+		meta->border = std::make_unique<ElementBorder>(const_cast<Element*>(this));
+	return meta->border.get();
 }
 
 // Access the element decorators
@@ -1552,6 +1830,55 @@ RenderInterface* Element::GetRenderInterface()
 	return Rml::Core::GetRenderInterface();
 }
 
+// Marks the area covered by the element as changed.
+void Element::MarkDamaged()
+{
+	// Any cached layers containing the element must be rendered again. Layers above a flagged element are already dirty.
+	for (Element* element = this; element && !element->layer_damage_pending; element = element->parent)
+	{
+		element->layer_damage_pending = true;
+		if (element->meta->layer)
+			element->meta->layer->DirtyLayer();
+	}
+
+	if (damage_pending || Context::GetNumDamageTrackingContexts() == 0)
+		return;
+
+	Context* context = GetContext();
+	if (!context || !context->damage_tracking_enabled || context->damage_all)
+		return;
+
+	// Damage the area the element currently covers. The area it covers after the next layout is added when the damage
+	// is collected during render. The old area is unknown when the offset is dirty, but then it has not been rendered.
+	if (!offset_dirty)
+		AddDamagedArea(context);
+
+	damage_pending = true;
+
+	for (Element* ancestor = parent; ancestor && !ancestor->child_damage_pending; ancestor = ancestor->parent)
+		ancestor->child_damage_pending = true;
+}
+
+// Requests that the element is updated on the next context update.
+void Element::RequestUpdate()
+{
+	if (update_pending)
+		return;
+
+	update_pending = true;
+
+	for (Element* ancestor = parent; ancestor && !ancestor->child_update_pending; ancestor = ancestor->parent)
+		ancestor->child_update_pending = true;
+}
+
+// Enables updating the element on every context update.
+void Element::SetUpdateEveryFrame(bool _update_every_frame)
+{
+	update_every_frame = _update_every_frame;
+	if (update_every_frame)
+		RequestUpdate();
+}
+
 void Element::SetInstancer(ElementInstancer* _instancer)
 {
 	// Only record the first instancer being set as some instancers call other instancers to do their dirty work, in
@@ -1571,7 +1898,7 @@ void Element::ForceLocalStackingContext()
 	DirtyStackingContext();
 }
 
-// Called during the update loop after children are rendered.
+// Called during the update loop before children are updated.
 void Element::OnUpdate()
 {
 }
@@ -1593,6 +1920,8 @@ void Element::OnLayout()
 // Called when attributes on the element are changed.
 void Element::OnAttributeChange(const ElementAttributes& changed_attributes)
 {
+	MarkDamaged();
+
 	auto it = changed_attributes.find("id");
 	if (it != changed_attributes.end())
 	{
@@ -1633,6 +1962,8 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 {
 	RMLUI_ZoneScoped;
 
+	MarkDamaged();
+
 	if (!IsLayoutDirty())
 	{
 		// Force a relayout if any of the changed properties require it.
@@ -1689,13 +2020,15 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 		if (z_index_property.type == Style::ZIndex::Auto)
 		{
 			if (local_stacking_context &&
-				!local_stacking_context_forced)
+				!local_stacking_context_forced &&
+				!meta->layer)
 			{
 				// We're no longer acting as a stacking context.
 				local_stacking_context = false;
 
 				stacking_context_dirty = false;
-				stacking_context.clear();
+				if (cold_data)
+					cold_data->stacking_context.clear();
 			}
 
 			// If our old z-index was not zero, then we must dirty our stacking context so we'll be re-indexed.
@@ -1725,11 +2058,50 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 		}
 	}
 
+	// Check for `render-cache' changes. Cached elements form a local stacking context so that all their descendants are
+	// rendered through the layer.
+	if (changed_properties.Contains(PropertyId::RenderCache))
+	{
+		const bool use_layer = (meta->computed_values.render_cache == Style::RenderCache::Layer);
+		if (use_layer && !meta->layer)
+		{
+			meta->layer = std::make_unique<ElementLayer>(this);
+
+			if (!local_stacking_context)
+			{
+				local_stacking_context = true;
+				stacking_context_dirty = true;
+
+				if (parent != nullptr)
+					parent->DirtyStackingContext();
+			}
+		}
+		else if (!use_layer && meta->layer)
+		{
+			meta->layer.reset();
+
+			if (local_stacking_context &&
+				!local_stacking_context_forced &&
+				meta->computed_values.z_index.type == Style::ZIndex::Auto)
+			{
+				local_stacking_context = false;
+
+				stacking_context_dirty = false;
+				if (cold_data)
+					cold_data->stacking_context.clear();
+
+				if (parent != nullptr)
+					parent->DirtyStackingContext();
+			}
+		}
+	}
+
 	// Dirty the background if it's changed.
     if (changed_properties.Contains(PropertyId::BackgroundColor) ||
 		changed_properties.Contains(PropertyId::Opacity) ||
 		changed_properties.Contains(PropertyId::ImageColor)) {
-		meta->background.DirtyBackground();
+		if (meta->background)
+			meta->background->DirtyBackground();
     }
 	
 	// Dirty the decoration if it's changed.
@@ -1749,7 +2121,10 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 		changed_properties.Contains(PropertyId::BorderBottomColor) ||
 		changed_properties.Contains(PropertyId::BorderLeftColor) ||
 		changed_properties.Contains(PropertyId::Opacity))
-		meta->border.DirtyBorder();
+	{
+		if (meta->border)
+			meta->border->DirtyBorder();
+	}
 
 	
 	// Check for clipping state changes
@@ -1758,6 +2133,7 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 		changed_properties.Contains(PropertyId::OverflowY))
 	{
 		clipping_state_dirty = true;
+		DirtyClippingRegions();
 	}
 
 	// Check for `perspective' and `perspective-origin' changes
@@ -1768,11 +2144,12 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 		DirtyTransformState(true, false);
 	}
 
-	// Check for `transform' and `transform-origin' changes
+	// Check for `transform' and `transform-origin' changes, transforms may also be relative to the font size
 	if (changed_properties.Contains(PropertyId::Transform) ||
 		changed_properties.Contains(PropertyId::TransformOriginX) ||
 		changed_properties.Contains(PropertyId::TransformOriginY) ||
-		changed_properties.Contains(PropertyId::TransformOriginZ))
+		changed_properties.Contains(PropertyId::TransformOriginZ) ||
+		(transform_state && changed_properties.Contains(PropertyId::FontSize)))
 	{
 		DirtyTransformState(false, true);
 	}
@@ -1781,11 +2158,13 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 	if (changed_properties.Contains(PropertyId::Animation))
 	{
 		dirty_animation = true;
+		RequestUpdate();
 	}
 	// Check for `transition' changes
 	if (changed_properties.Contains(PropertyId::Transition))
 	{
 		dirty_transition = true;
+		RequestUpdate();
 	}
 }
 
@@ -1926,6 +2305,11 @@ void Element::SetOwnerDocument(ElementDocument* document)
 
 		if (owner_document != document)
 		{
+			if (owner_document)
+				owner_document->num_elements--;
+			if (document)
+				document->num_elements++;
+
 			owner_document = document;
 			for (ElementPtr& child : children)
 				child->SetOwnerDocument(document);
@@ -1948,6 +2332,8 @@ void Element::SetParent(Element* _parent)
 
 	parent = _parent;
 
+	DirtyClippingRegions();
+
 	if (parent)
 	{
 		// We need to update our definition and make sure we inherit the properties of our new parent.
@@ -1960,13 +2346,33 @@ void Element::SetParent(Element* _parent)
 		DirtyTransformState(true, true);
 
 	SetOwnerDocument(parent ? parent->GetOwnerDocument() : nullptr);
+
+	// The layers above our new position have not been dirtied by us.
+	ClearLayerDamagePending();
+
+	// Damage recorded while detached must be collected through the new parent.
+	if (damage_pending || child_damage_pending)
+	{
+		for (Element* ancestor = parent; ancestor && !ancestor->child_damage_pending; ancestor = ancestor->parent)
+			ancestor->child_damage_pending = true;
+	}
+
+	// Likewise for pending updates.
+	if (update_pending || child_update_pending)
+	{
+		for (Element* ancestor = parent; ancestor && !ancestor->child_update_pending; ancestor = ancestor->parent)
+			ancestor->child_update_pending = true;
+	}
 }
 
 void Element::DirtyOffset()
 {
 	if(!offset_dirty)
 	{
+		MarkDamaged();
+
 		offset_dirty = true;
+		DirtyClippingRegions();
 
 		if(transform_state)
 			DirtyTransformState(true, true);
@@ -1977,6 +2383,99 @@ void Element::DirtyOffset()
 	}
 }
 
+void Element::DirtyClippingRegions()
+{
+	clipping_generation++;
+
+	// Skip the generation of newly constructed elements on wrap-around.
+	if (clipping_generation == 0)
+		clipping_generation = 1;
+}
+
+void Element::MarkSubtreeDamaged()
+{
+	MarkDamaged();
+
+	for (size_t i = 0; i < children.size(); i++)
+		children[i]->MarkSubtreeDamaged();
+}
+
+void Element::AddDamagedArea(Context* context)
+{
+	// The area of transformed elements is not tracked, damage the whole context instead.
+	for (Element* element = this; element; element = element->parent)
+	{
+		const auto& computed = element->meta->computed_values;
+		if (element->transform_state || computed.transform || computed.perspective > 0)
+		{
+			context->MarkDamaged();
+			return;
+		}
+	}
+
+	const Vector2f offset = GetAbsoluteOffset(Box::BORDER);
+	Vector2f top_left = offset;
+	Vector2f bottom_right = offset + main_box.GetSize(Box::BORDER);
+
+	for (int i = 1; i < GetNumBoxes(); i++)
+	{
+		const Box& box = GetBox(i);
+		const Vector2f box_offset = offset + box.GetOffset();
+		const Vector2f box_size = box.GetSize(Box::BORDER);
+		top_left = Vector2f(Math::Min(top_left.x, box_offset.x), Math::Min(top_left.y, box_offset.y));
+		bottom_right = Vector2f(Math::Max(bottom_right.x, box_offset.x + box_size.x), Math::Max(bottom_right.y, box_offset.y + box_size.y));
+	}
+
+	// Elements without an area of their own, such as text, are covered by their parent.
+	if (bottom_right.x <= top_left.x || bottom_right.y <= top_left.y)
+	{
+		if (parent)
+			parent->AddDamagedArea(context);
+		return;
+	}
+
+	// Font effects may be drawn outside the element's boxes, their extent is approximated by the font size.
+	float margin = 1.f;
+	if (meta->computed_values.font_effect)
+		margin += meta->computed_values.font_size;
+
+	const Vector2i origin(Math::RoundDownToInteger(top_left.x - margin), Math::RoundDownToInteger(top_left.y - margin));
+	const Vector2i extent(Math::RoundUpToInteger(bottom_right.x + margin), Math::RoundUpToInteger(bottom_right.y + margin));
+
+	context->MarkDamaged(origin, extent - origin);
+}
+
+void Element::CollectDamage(Context* context)
+{
+	if (damage_pending)
+	{
+		damage_pending = false;
+		AddDamagedArea(context);
+	}
+
+	if (child_damage_pending)
+	{
+		child_damage_pending = false;
+		for (size_t i = 0; i < children.size(); i++)
+		{
+			if (children[i]->damage_pending || children[i]->child_damage_pending)
+				children[i]->CollectDamage(context);
+		}
+	}
+}
+
+// Clears the layer damage flag of the element and its descendants. Descendants of unflagged elements are never flagged.
+void Element::ClearLayerDamagePending()
+{
+	if (!layer_damage_pending)
+		return;
+
+	layer_damage_pending = false;
+
+	for (size_t i = 0; i < children.size(); i++)
+		children[i]->ClearLayerDamagePending();
+}
+
 void Element::UpdateOffset()
 {
 	using namespace Style;
@@ -2044,12 +2543,38 @@ void Element::UpdateOffset()
 void Element::BuildLocalStackingContext()
 {
 	stacking_context_dirty = false;
+
+	ElementColdData& data = GetColdData();
+	data.stacking_context_cull_generation = 0;
+
+	ElementList& stacking_context = data.stacking_context;
 	stacking_context.clear();
 
 	BuildStackingContext(&stacking_context);
 	std::stable_sort(stacking_context.begin(), stacking_context.end(), ElementSortZIndex());
 }
 
+ElementColdData& Element::GetColdData()
+{
+	if (!cold_data)
+		cold_data = element_cold_data_pool.AllocateAndConstruct();
+	return *cold_data;
+}
+
+const ElementList& Element::GetLocalStackingContext() const
+{
+	static const ElementList empty_stacking_context;
+	return cold_data ? cold_data->stacking_context : empty_stacking_context;
+}
+
+void Element::DirtyBackgroundAndBorder()
+{
+	if (meta->background)
+		meta->background->DirtyBackground();
+	if (meta->border)
+		meta->border->DirtyBorder();
+}
+
 void Element::BuildStackingContext(ElementList* new_stacking_context)
 {
 	RMLUI_ZoneScoped;
@@ -2109,6 +2634,7 @@ void Element::DirtyStackingContext()
 void Element::DirtyStructure()
 {
 	structure_dirty = true;
+	RequestUpdate();
 }
 
 void Element::UpdateStructure()
@@ -2127,6 +2653,7 @@ bool Element::Animate(const String & property_name, const Property & target_valu
 {
 	bool result = false;
 	PropertyId property_id = StyleSheetSpecification::GetPropertyId(property_name);
+	ElementAnimationList& animations = GetColdData().animations;
 
 	auto it_animation = StartAnimation(property_id, start_value, num_iterations, alternate_direction, delay, false);
 	if (it_animation != animations.end())
@@ -2142,11 +2669,14 @@ bool Element::Animate(const String & property_name, const Property & target_valu
 
 bool Element::AddAnimationKey(const String & property_name, const Property & target_value, float duration, Tween tween)
 {
+	if (!cold_data)
+		return false;
+
 	ElementAnimation* animation = nullptr;
 
 	PropertyId property_id = StyleSheetSpecification::GetPropertyId(property_name);
 
-	for (auto& existing_animation : animations) {
+	for (auto& existing_animation : cold_data->animations) {
 		if (existing_animation.GetPropertyId() == property_id) {
 			animation = &existing_animation;
 			break;
@@ -2163,6 +2693,11 @@ bool Element::AddAnimationKey(const String & property_name, const Property & tar
 
 ElementAnimationList::iterator Element::StartAnimation(PropertyId property_id, const Property* start_value, int num_iterations, bool alternate_direction, float delay, bool initiated_by_animation_property)
 {
+	ElementAnimationList& animations = GetColdData().animations;
+
+	// Animations are advanced during update.
+	RequestUpdate();
+
 	auto it = std::find_if(animations.begin(), animations.end(), [&](const ElementAnimation& el) { return el.GetPropertyId() == property_id; });
 
 	if (it != animations.end())
@@ -2210,12 +2745,12 @@ bool Element::AddAnimationKeyTime(PropertyId property_id, const Property* target
 {
 	if (!target_value)
 		target_value = meta->style.GetProperty(property_id);
-	if (!target_value)
+	if (!target_value || !cold_data)
 		return false;
 
 	ElementAnimation* animation = nullptr;
 
-	for (auto& existing_animation : animations) {
+	for (auto& existing_animation : cold_data->animations) {
 		if (existing_animation.GetPropertyId() == property_id) {
 			animation = &existing_animation;
 			break;
@@ -2231,6 +2766,11 @@ bool Element::AddAnimationKeyTime(PropertyId property_id, const Property* target
 
 bool Element::StartTransition(const Transition & transition, const Property& start_value, const Property & target_value)
 {
+	ElementAnimationList& animations = GetColdData().animations;
+
+	// Transitions are advanced during update.
+	RequestUpdate();
+
 	auto it = std::find_if(animations.begin(), animations.end(), [&](const ElementAnimation& el) { return el.GetPropertyId() == transition.id; });
 
 	if (it != animations.end() && !it->IsTransition())
@@ -2276,9 +2816,10 @@ void Element::HandleTransitionProperty()
 		// Remove all transitions that are no longer in our local list
 		const TransitionList& keep_transitions = GetComputedValues().transition;
 
-		if (keep_transitions.all)
+		if (keep_transitions.all || !cold_data)
 			return;
 
+		ElementAnimationList& animations = cold_data->animations;
 		auto it_remove = animations.end();
 
 		if (keep_transitions.none)
@@ -2324,7 +2865,7 @@ void Element::HandleAnimationProperty()
 		dirty_animation = false;
 
 		const AnimationList& animation_list = meta->computed_values.animation;
-		bool element_has_animations = (!animation_list.empty() || !animations.empty());
+		bool element_has_animations = (!animation_list.empty() || (cold_data && !cold_data->animations.empty()));
 		StyleSheet* stylesheet = nullptr;
 
 		if (element_has_animations)
@@ -2334,6 +2875,8 @@ void Element::HandleAnimationProperty()
 		{
 			// Remove existing animations
 			{
+				ElementAnimationList& animations = GetColdData().animations;
+
 				// We only touch the animations that originate from the 'animation' property.
 				auto it_remove = std::partition(animations.begin(), animations.end(), 
 					[](const ElementAnimation & animation) { return animation.GetOrigin() != ElementAnimationOrigin::Animation; }
@@ -2383,8 +2926,9 @@ void Element::HandleAnimationProperty()
 
 void Element::AdvanceAnimations()
 {
-	if (!animations.empty())
+	if (cold_data && !cold_data->animations.empty())
 	{
+		ElementAnimationList& animations = cold_data->animations;
 		double time = Clock::GetElapsedTime();
 
 		for (auto& animation : animations)
@@ -2426,18 +2970,25 @@ void Element::AdvanceAnimations()
 
 
 
-void Element::DirtyTransformState(bool perspective_dirty, bool transform_dirty)
+void Element::DirtyTransformState(bool perspective_dirty, bool transform_dirty, bool parent_transform_dirty)
 {
+	// Untransformed elements may become transformed, which makes them unbounded for culling.
+	if (!transform_state && (perspective_dirty || transform_dirty || parent_transform_dirty))
+		DirtyClippingRegions();
+
 	dirty_perspective |= perspective_dirty;
 	dirty_transform |= transform_dirty;
+	dirty_parent_transform |= parent_transform_dirty;
 }
 
 
 void Element::UpdateTransformState()
 {
-	if (!dirty_perspective && !dirty_transform)
+	if (!dirty_perspective && !dirty_transform && !dirty_parent_transform)
 		return;
 
+	const bool had_transform_state = (transform_state != nullptr);
+
 	const ComputedValues& computed = meta->computed_values;
 
 	const Vector2f pos = GetAbsoluteOffset(Box::BORDER);
@@ -2495,32 +3046,36 @@ void Element::UpdateTransformState()
 	}
 
 
-	if (dirty_transform)
+	if (dirty_transform || dirty_parent_transform)
 	{
 		// We want to find the accumulated transform given all our ancestors. It is assumed here that the parent transform is already updated,
 		// so that we only need to consider our local transform and combine it with our parent's transform and perspective matrices.
 		bool had_transform = (transform_state && transform_state->GetTransform());
 
-		bool have_transform = false;
-		Matrix4f transform = Matrix4f::Identity();
-
-		if (computed.transform)
+		// The local transform is only resolved again when it may have changed, otherwise only an ancestor's transform has.
+		if (dirty_transform)
 		{
-			// First find the current element's transform
-			const int n = computed.transform->GetNumPrimitives();
-			for (int i = 0; i < n; ++i)
-			{
-				const Transforms::Primitive& primitive = computed.transform->GetPrimitive(i);
+			bool have_local_transform = false;
+			Matrix4f local_transform = Matrix4f::Identity();
 
-				Matrix4f matrix;
-				if (primitive.ResolveTransform(matrix, *this))
+			if (computed.transform)
+			{
+				// First find the current element's transform
+				const int n = computed.transform->GetNumPrimitives();
+				for (int i = 0; i < n; ++i)
 				{
-					transform *= matrix;
-					have_transform = true;
+					const Transforms::Primitive& primitive = computed.transform->GetPrimitive(i);
+
+					Matrix4f matrix;
+					if (primitive.ResolveTransform(matrix, *this))
+					{
+						local_transform *= matrix;
+						have_local_transform = true;
+					}
 				}
 			}
 
-			if(have_transform)
+			if (have_local_transform)
 			{
 				// Compute the transform origin
 				Vector3f transform_origin(pos.x + size.x * 0.5f, pos.y + size.y * 0.5f, 0);
@@ -2538,13 +3093,25 @@ void Element::UpdateTransformState()
 				transform_origin.z = computed.transform_origin_z;
 
 				// Make the transformation apply relative to the transform origin
-				transform = Matrix4f::Translate(transform_origin) * transform * Matrix4f::Translate(-transform_origin);
-			}
+				local_transform = Matrix4f::Translate(transform_origin) * local_transform * Matrix4f::Translate(-transform_origin);
 
-			// We may want to include the local offsets here, as suggested by the CSS specs, so that the local transform is applied after the offset I believe
-			// the motivation is. Then we would need to subtract the absolute zero-offsets during geometry submit whenever we have transforms.
+				// We may want to include the local offsets here, as suggested by the CSS specs, so that the local transform is applied after the offset I believe
+				// the motivation is. Then we would need to subtract the absolute zero-offsets during geometry submit whenever we have transforms.
+
+				if (!transform_state)
+					transform_state = std::make_unique<TransformState>();
+
+				transform_state->SetLocalTransform(&local_transform);
+			}
+			else if (transform_state)
+				transform_state->SetLocalTransform(nullptr);
 		}
 
+		const Matrix4f* local_transform = (transform_state ? transform_state->GetLocalTransform() : nullptr);
+
+		bool have_transform = (local_transform != nullptr);
+		Matrix4f transform = (local_transform ? *local_transform : Matrix4f::Identity());
+
 		if (parent && parent->transform_state)
 		{
 			// Apply the parent's local perspective and transform.
@@ -2575,13 +3142,16 @@ void Element::UpdateTransformState()
 			transform_state->SetTransform(nullptr);
 
 		perspective_or_transform_changed |= (had_transform != have_transform);
+
+		dirty_transform = false;
+		dirty_parent_transform = false;
 	}
 
 	// A change in perspective or transform will require an update to children transforms as well.
 	if (perspective_or_transform_changed)
 	{
 		for (size_t i = 0; i < children.size(); i++)
-			children[i]->DirtyTransformState(false, true);
+			children[i]->DirtyTransformState(false, false, true);
 	}
 
 	// No reason to keep the transform state around if transform and perspective have been removed.
@@ -2589,6 +3159,10 @@ void Element::UpdateTransformState()
 	{
 		transform_state.reset();
 	}
+
+	// Elements are unbounded for culling while transformed or dirty, so their bounds change unless they stay transformed.
+	if (!had_transform_state || !transform_state)
+		DirtyClippingRegions();
 }
 
 }
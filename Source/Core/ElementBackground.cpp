@@ -32,6 +32,7 @@
 #include "../../Include/RmlUi/Core/GeometryUtilities.h"
 #include "../../Include/RmlUi/Core/Property.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
+#include "ContextStatistics.h"
 
 
 namespace Rml {
@@ -70,6 +71,9 @@ void ElementBackground::GenerateBackground()
 {
 	RMLUI_ZoneScoped;
 
+	RMLUI_STATISTICS_COUNT(num_geometry_regenerated, 1);
+	RMLUI_STATISTICS_TRACK_ELEMENT(regenerated_elements, element);
+
 	// Fetch the new colour for the background. If the colour is transparent, then we don't render any background.
 	auto& computed = element->GetComputedValues();
 	Colourb colour = computed.background_color;
@@ -31,6 +31,7 @@
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Property.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
+#include "ContextStatistics.h"
 
 namespace Rml {
 namespace Core {
@@ -67,6 +68,9 @@ void ElementBorder::DirtyBorder()
 // Generates the border geometry for the element.
 void ElementBorder::GenerateBorder()
 {
+	RMLUI_STATISTICS_COUNT(num_geometry_regenerated, 1);
+	RMLUI_STATISTICS_TRACK_ELEMENT(regenerated_elements, element);
+
 	int num_edges = 0;
 
 	for (int i = 0; i < element->GetNumBoxes(); ++i)
@@ -27,6 +27,7 @@
  */
 
 #include "ElementDecoration.h"
+#include "ContextStatistics.h"
 #include "ElementDefinition.h"
 #include "../../Include/RmlUi/Core/Decorator.h"
 #include "../../Include/RmlUi/Core/Element.h"
@@ -50,6 +51,8 @@ ElementDecoration::~ElementDecoration()
 bool ElementDecoration::ReloadDecorators()
 {
 	RMLUI_ZoneScopedC(0xB22222);
+	RMLUI_STATISTICS_COUNT(num_geometry_regenerated, 1);
+	RMLUI_STATISTICS_TRACK_ELEMENT(regenerated_elements, element);
 	ReleaseDecorators();
 
 	auto& decorators_ptr = element->GetComputedValues().decorator;
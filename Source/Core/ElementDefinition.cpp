@@ -28,11 +28,18 @@
 
 #include "ElementDefinition.h"
 #include "StyleSheetNode.h"
+#include "../../Include/RmlUi/Core/MemoryStatistics.h"
 #include "../../Include/RmlUi/Core/PropertyIdSet.h"
 
 namespace Rml {
 namespace Core {
 
+// Estimates the memory used by a definition with the given properties.
+static size_t GetMemoryUsage(const PropertyDictionary& properties)
+{
+	return sizeof(ElementDefinition) + properties.GetNumProperties() * (sizeof(PropertyId) + sizeof(Property));
+}
+
 ElementDefinition::ElementDefinition(const std::vector< const StyleSheetNode* >& style_sheet_nodes)
 {
 	// Initialises the element definition from the list of style sheet nodes.
@@ -41,6 +48,13 @@ ElementDefinition::ElementDefinition(const std::vector< const StyleSheetNode* >&
 
 	for (auto& property : properties.GetProperties())
 		property_ids.Insert(property.first);
+
+	Memory::TrackAllocation(MemoryCategory::StyleSheets, GetMemoryUsage(properties));
+}
+
+ElementDefinition::~ElementDefinition()
+{
+	Memory::TrackDeallocation(MemoryCategory::StyleSheets, GetMemoryUsage(properties));
 }
 
 const Property* ElementDefinition::GetProperty(PropertyId id) const
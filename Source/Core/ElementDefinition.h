@@ -49,6 +49,7 @@ class ElementDefinition : public NonCopyMoveable
 {
 public:
 	ElementDefinition(const std::vector< const StyleSheetNode* >& style_sheet_nodes);
+	~ElementDefinition();
 
 	/// Returns a specific property from the element definition.
 	/// @param[in] id The id of the property to return.
@@ -33,6 +33,7 @@
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/StreamMemory.h"
 #include "../../Include/RmlUi/Core/StyleSheet.h"
+#include "ContextStatistics.h"
 #include "DocumentHeader.h"
 #include "ElementStyle.h"
 #include "EventDispatcher.h"
@@ -56,6 +57,8 @@ ElementDocument::ElementDocument(const String& tag) : Element(tag)
 
 	position_dirty = false;
 
+	num_elements = 0;
+
 	ForceLocalStackingContext();
 	SetOwnerDocument(this);
 
@@ -358,6 +361,12 @@ void ElementDocument::UpdateDocument()
 	UpdatePosition();
 }
 
+// Returns the time spent on this document during the last frame.
+const DocumentStatistics& ElementDocument::GetStatistics() const
+{
+	return last_frame_statistics;
+}
+
 // Updates the layout if necessary.
 void ElementDocument::UpdateLayout()
 {
@@ -368,6 +377,8 @@ void ElementDocument::UpdateLayout()
 		RMLUI_ZoneScoped;
 		RMLUI_ZoneText(source_url.c_str(), source_url.size());
 
+		DocumentStatisticsScope statistics_scope(this, &DocumentStatistics::layout_time);
+
 		layout_dirty = false;
 
 		Vector2f containing_block(0, 0);
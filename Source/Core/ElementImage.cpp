@@ -27,6 +27,7 @@
  */
 
 #include "ElementImage.h"
+#include "ContextStatistics.h"
 #include "TextureDatabase.h"
 #include "../../Include/RmlUi/Core/URL.h"
 #include "../../Include/RmlUi/Core/PropertyIdSet.h"
@@ -145,6 +146,9 @@ void ElementImage::OnResize()
 
 void ElementImage::GenerateGeometry()
 {
+	RMLUI_STATISTICS_COUNT(num_geometry_regenerated, 1);
+	RMLUI_STATISTICS_TRACK_ELEMENT(regenerated_elements, this);
+
 	// Release the old geometry before specifying the new vertices.
 	geometry.Release(true);
 
@@ -38,8 +38,8 @@ ElementInstancer::~ElementInstancer()
 {
 }
 
-static Pool< Element > pool_element(200, true);
-static Pool< ElementTextDefault > pool_text_default(200, true);
+static Pool< Element > pool_element(200, true, MemoryCategory::Elements);
+static Pool< ElementTextDefault > pool_text_default(200, true, MemoryCategory::Elements);
 
 
 ElementPtr ElementInstancerElement::InstanceElement(Element* /*parent*/, const String& tag, const XMLAttributes& /*attributes*/)
@@ -0,0 +1,269 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "ElementLayer.h"
+#include "../../Include/RmlUi/Core/Context.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/ElementUtilities.h"
+#include "../../Include/RmlUi/Core/GeometryUtilities.h"
+#include "../../Include/RmlUi/Core/MemoryStatistics.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/RenderInterface.h"
+#include "../../Include/RmlUi/Core/TransformState.h"
+#include "ContextStatistics.h"
+#include <limits>
+
+namespace Rml {
+namespace Core {
+
+// Larger layers are not cached, the element is rendered as usual instead.
+static constexpr int MAX_LAYER_SIZE = 4096;
+
+// State of the layer currently being captured.
+static Element* capture_element = nullptr;
+static bool capture_transformed = false;
+static Matrix4f capture_transform;
+static Matrix4f capture_inverse_transform;
+
+// Extends the bounds by the area covered by the element and its visible descendants.
+static void ExtendBounds(Element* element, Vector2f& top_left, Vector2f& bottom_right)
+{
+	const Style::ComputedValues& computed = element->GetComputedValues();
+	const Vector2f offset = element->GetAbsoluteOffset(Box::BORDER);
+
+	// Font effects may be drawn outside the element's boxes, their extent is approximated by the font size.
+	const float margin = (computed.font_effect ? computed.font_size : 0.f);
+
+	for (int i = 0; i < element->GetNumBoxes(); i++)
+	{
+		const Box& box = element->GetBox(i);
+		const Vector2f box_size = box.GetSize(Box::BORDER);
+		if (box_size.x <= 0 || box_size.y <= 0)
+			continue;
+
+		const Vector2f box_offset = offset + box.GetOffset();
+		top_left.x = Math::Min(top_left.x, box_offset.x - margin);
+		top_left.y = Math::Min(top_left.y, box_offset.y - margin);
+		bottom_right.x = Math::Max(bottom_right.x, box_offset.x + box_size.x + margin);
+		bottom_right.y = Math::Max(bottom_right.y, box_offset.y + box_size.y + margin);
+	}
+
+	// Descendants can not be drawn outside elements clipping their overflow.
+	if (element->IsClippingEnabled())
+		return;
+
+	for (int i = 0; i < element->GetNumChildren(true); i++)
+	{
+		Element* child = element->GetChild(i);
+		if (child->IsVisible())
+			ExtendBounds(child, top_left, bottom_right);
+	}
+}
+
+ElementLayer::ElementLayer(Element* element) : element(element), texture_render_interface(nullptr), texture(0), texture_dimensions(0, 0), layer_dirty(true), failed_render_interface(nullptr), failed_dimensions(0, 0)
+{
+}
+
+ElementLayer::~ElementLayer()
+{
+	ReleaseTexture();
+}
+
+// Renders the element and its stacking context through the layer.
+bool ElementLayer::RenderLayer()
+{
+	// Layers inside a layer being captured are rendered directly into the outer layer.
+	if (capture_element)
+		return false;
+
+	Context* context = element->GetContext();
+	RenderInterface* render_interface = element->GetRenderInterface();
+	if (!context || !render_interface)
+		return false;
+
+	// The layer failed to capture and nothing inside it has changed since, so it would fail again.
+	if (!layer_dirty && render_interface == failed_render_interface)
+		return false;
+
+	if (layer_dirty || !texture || render_interface != texture_render_interface)
+	{
+		if (!Capture(render_interface, context))
+			return false;
+	}
+
+	ElementUtilities::ApplyTransform(*element);
+
+	if (ElementUtilities::SetClippingRegion(element))
+	{
+		render_interface->RenderGeometry(vertices, 4, indices, 6, texture, Vector2f(0, 0));
+		RMLUI_STATISTICS_COUNT(num_draw_calls, 1);
+	}
+
+	return true;
+}
+
+// Marks the cached rendering as outdated.
+void ElementLayer::DirtyLayer()
+{
+	layer_dirty = true;
+}
+
+Element* ElementLayer::GetCaptureElement()
+{
+	return capture_element;
+}
+
+bool ElementLayer::GetCaptureTransform(const Matrix4f& transform, Matrix4f& relative_transform)
+{
+	if (!capture_transformed)
+	{
+		relative_transform = transform;
+		return true;
+	}
+
+	// Elements without a transform of their own share the layer's transform.
+	if (transform == capture_transform)
+		return false;
+
+	relative_transform = capture_inverse_transform * transform;
+	return true;
+}
+
+bool ElementLayer::Capture(RenderInterface* render_interface, Context* context)
+{
+	RMLUI_ZoneScoped;
+
+	Vector2f top_left(std::numeric_limits<float>::max());
+	Vector2f bottom_right(std::numeric_limits<float>::lowest());
+	ExtendBounds(element, top_left, bottom_right);
+
+	const Vector2i origin(Math::RoundDownToInteger(top_left.x), Math::RoundDownToInteger(top_left.y));
+	const Vector2i dimensions(Math::RoundUpToInteger(bottom_right.x) - origin.x, Math::RoundUpToInteger(bottom_right.y) - origin.y);
+
+	if (render_interface == failed_render_interface && dimensions == failed_dimensions)
+	{
+		CleanLayer();
+		return false;
+	}
+
+	if (top_left.x >= bottom_right.x || top_left.y >= bottom_right.y || dimensions.x > MAX_LAYER_SIZE || dimensions.y > MAX_LAYER_SIZE)
+	{
+		SetCaptureFailed(render_interface, dimensions);
+		return false;
+	}
+
+	// Elements inside the layer are rendered relative to the layer's own transform, which is applied when the layer is rendered.
+	const TransformState* transform_state = element->GetTransformState();
+	const Matrix4f* transform = (transform_state ? transform_state->GetTransform() : nullptr);
+	if (transform)
+	{
+		capture_inverse_transform = *transform;
+		if (!capture_inverse_transform.Invert())
+			return false;
+		capture_transform = *transform;
+	}
+
+	if (!texture || dimensions != texture_dimensions || render_interface != texture_render_interface)
+	{
+		ReleaseTexture();
+
+		if (!render_interface->GenerateRenderTexture(texture, dimensions))
+		{
+			texture = 0;
+			SetCaptureFailed(render_interface, dimensions);
+			return false;
+		}
+
+		texture_render_interface = render_interface;
+		texture_dimensions = dimensions;
+
+		Memory::TrackAllocation(MemoryCategory::Textures, size_t(dimensions.x) * size_t(dimensions.y) * 4);
+	}
+
+	// Any changes made while rendering the element are picked up the next time.
+	CleanLayer();
+	failed_render_interface = nullptr;
+
+	Vector2i clip_origin(-1, -1);
+	Vector2i clip_dimensions(-1, -1);
+	context->GetActiveClipRegion(clip_origin, clip_dimensions);
+
+	capture_element = element;
+	capture_transformed = (transform != nullptr);
+
+	render_interface->PushRenderTexture(texture, origin);
+
+	// The layer is rendered in full without any clipping from outside the element, so that it can be reused anywhere.
+	context->SetActiveClipRegion(Vector2i(-1, -1), Vector2i(-1, -1));
+	ElementUtilities::ApplyActiveClipRegion(context, render_interface);
+
+	element->RenderStackingContext();
+
+	render_interface->PopRenderTexture();
+
+	capture_element = nullptr;
+	capture_transformed = false;
+
+	context->SetActiveClipRegion(clip_origin, clip_dimensions);
+	ElementUtilities::ApplyActiveClipRegion(context, render_interface);
+
+	GeometryUtilities::GenerateQuad(vertices, indices, Vector2f((float)origin.x, (float)origin.y), Vector2f((float)dimensions.x, (float)dimensions.y), Colourb(255, 255, 255), Vector2f(0, 0), Vector2f(1, 1));
+
+	return true;
+}
+
+void ElementLayer::SetCaptureFailed(RenderInterface* render_interface, const Vector2i& dimensions)
+{
+	failed_render_interface = render_interface;
+	failed_dimensions = dimensions;
+	CleanLayer();
+}
+
+void ElementLayer::CleanLayer()
+{
+	layer_dirty = false;
+
+	// Changes to the element and its descendants need to dirty the layer again.
+	element->ClearLayerDamagePending();
+}
+
+void ElementLayer::ReleaseTexture()
+{
+	if (texture && texture_render_interface)
+	{
+		texture_render_interface->ReleaseTexture(texture);
+		Memory::TrackDeallocation(MemoryCategory::Textures, size_t(texture_dimensions.x) * size_t(texture_dimensions.y) * 4);
+	}
+
+	texture = 0;
+	texture_render_interface = nullptr;
+	texture_dimensions = Vector2i(0, 0);
+}
+
+}
+}
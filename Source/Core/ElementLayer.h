@@ -0,0 +1,96 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUICOREELEMENTLAYER_H
+#define RMLUICOREELEMENTLAYER_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+#include "../../Include/RmlUi/Core/Vertex.h"
+
+namespace Rml {
+namespace Core {
+
+class Context;
+class Element;
+class RenderInterface;
+
+/**
+	Caches the rendering of an element and its descendants in a texture, which is then rendered as a single quad until
+	anything inside the element changes. Used for elements with the 'render-cache: layer' property.
+ */
+
+class ElementLayer
+{
+public:
+	ElementLayer(Element* element);
+	~ElementLayer();
+
+	/// Renders the element and its stacking context through the layer, capturing it into the texture first if necessary.
+	/// @return False if the layer could not be used, in which case the element must be rendered as usual.
+	bool RenderLayer();
+
+	/// Marks the cached rendering as outdated.
+	void DirtyLayer();
+
+	/// Returns the element currently being captured into its layer, or nullptr if none.
+	static Element* GetCaptureElement();
+	/// Returns the transform of elements being captured relative to the layer.
+	/// @param[in] transform The transform of an element inside the layer.
+	/// @param[out] relative_transform The transform to apply while rendering into the layer.
+	/// @return False if the element's transform equals that of the layer, in which case no transform should be applied.
+	static bool GetCaptureTransform(const Matrix4f& transform, Matrix4f& relative_transform);
+
+private:
+	// Renders the element into the texture, regenerating the texture if its size has changed.
+	bool Capture(RenderInterface* render_interface, Context* context);
+	// Remembers that the layer could not be captured, the element is rendered as usual until the layer changes.
+	void SetCaptureFailed(RenderInterface* render_interface, const Vector2i& dimensions);
+	// Marks the layer as up to date with the element.
+	void CleanLayer();
+	void ReleaseTexture();
+
+	Element* element;
+
+	RenderInterface* texture_render_interface;
+	TextureHandle texture;
+	Vector2i texture_dimensions;
+
+	Vertex vertices[4];
+	int indices[6];
+
+	bool layer_dirty;
+
+	// The render interface and dimensions of the last failed capture, it is not attempted again until either changes.
+	RenderInterface* failed_render_interface;
+	Vector2i failed_dimensions;
+};
+
+}
+}
+
+#endif
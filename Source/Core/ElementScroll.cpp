@@ -66,13 +66,17 @@ void ElementScroll::ClearScrollbars()
 }
 
 // Updates the increment / decrement arrows.
-void ElementScroll::Update()
+bool ElementScroll::Update()
 {
+	bool arrows_held = false;
+
 	for (int i = 0; i < 2; i++)
 	{
 		if (scrollbars[i].widget != nullptr)
-			scrollbars[i].widget->Update();
+			arrows_held |= scrollbars[i].widget->Update();
 	}
+
+	return arrows_held;
 }
 
 // Enables and sizes one of the scrollbars.
@@ -46,6 +46,7 @@
 #include "ElementDecoration.h"
 #include "ElementDefinition.h"
 #include "ComputeProperty.h"
+#include "ContextStatistics.h"
 #include "PropertiesIterator.h"
 #include <algorithm>
 
@@ -173,6 +174,8 @@ void ElementStyle::UpdateDefinition()
 
 		definition_dirty = false;
 
+		RMLUI_STATISTICS_COUNT(num_definitions_resolved, 1);
+
 		SharedPtr<ElementDefinition> new_definition;
 		
 		if (auto& style_sheet = element->GetStyleSheet())
@@ -433,11 +436,13 @@ float ElementStyle::ResolveLength(const Property* property, RelativeTarget relat
 void ElementStyle::DirtyDefinition()
 {
 	definition_dirty = true;
+	element->RequestUpdate();
 }
 
 void ElementStyle::DirtyInheritedProperties()
 {
 	dirty_properties |= StyleSheetSpecification::GetRegisteredInheritedProperties();
+	element->RequestUpdate();
 }
 
 void ElementStyle::DirtyChildDefinitions()
@@ -496,12 +501,17 @@ PropertiesIterator ElementStyle::Iterate() const {
 void ElementStyle::DirtyProperty(PropertyId id)
 {
 	dirty_properties.Insert(id);
+	element->RequestUpdate();
 }
 
 // Sets a list of properties as dirty.
 void ElementStyle::DirtyProperties(const PropertyIdSet& properties)
 {
+	if (properties.Empty())
+		return;
+
 	dirty_properties |= properties;
+	element->RequestUpdate();
 }
 
 PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const Style::ComputedValues* parent_values, const Style::ComputedValues* document_values, bool values_are_default_initialized, float dp_ratio)
@@ -511,6 +521,8 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 
 	RMLUI_ZoneScopedC(0xFF7F50);
 
+	RMLUI_STATISTICS_COUNT(num_properties_computed, dirty_properties.Size());
+
 	// Generally, this is how it works:
 	//   1. Assign default values (clears any removed properties)
 	//   2. Inherit inheritable values from parent
@@ -807,6 +819,9 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 		case PropertyId::PointerEvents:
 			values.pointer_events = (PointerEvents)p->Get<int>();
 			break;
+		case PropertyId::RenderCache:
+			values.render_cache = (RenderCache)p->Get<int>();
+			break;
 
 		case PropertyId::Perspective:
 			values.perspective = ComputeLength(p, font_size, document_font_size, dp_ratio);
@@ -903,6 +918,7 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 		{
 			auto child = element->GetChild(i);
 			child->GetStyle()->dirty_properties |= dirty_inherited_properties;
+			child->RequestUpdate();
 		}
 	}
 	
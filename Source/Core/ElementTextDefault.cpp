@@ -27,6 +27,7 @@
  */
 
 #include "ElementTextDefault.h"
+#include "ContextStatistics.h"
 #include "ElementDefinition.h"
 #include "ElementStyle.h"
 #include "../../Include/RmlUi/Core/Core.h"
@@ -57,6 +58,7 @@ ElementTextDefault::ElementTextDefault(const String& tag) : ElementText(tag), co
 	font_effects_handle = 0;
 	font_effects_dirty = true;
 	font_handle_version = 0;
+	font_glyphs_pending = false;
 }
 
 ElementTextDefault::~ElementTextDefault()
@@ -67,6 +69,8 @@ void ElementTextDefault::SetText(const String& _text)
 {
 	if (text != _text)
 	{
+		MarkDamaged();
+
 		text = _text;
 
 		if (dirty_layout_on_change)
@@ -101,7 +105,10 @@ void ElementTextDefault::OnRender()
 
 	// Regenerate the geometry if the colour or font configuration has altered.
 	if (geometry_dirty)
+	{
 		GenerateGeometry(font_face_handle);
+		WatchPendingGlyphs(font_face_handle);
+	}
 
 	Vector2f translation = GetAbsoluteOffset();
 	
@@ -262,6 +269,8 @@ bool ElementTextDefault::GenerateLine(String& line, int& line_length, float& lin
 // Clears all lines of generated text and prepares the element for generating new lines.
 void ElementTextDefault::ClearLines()
 {
+	MarkDamaged();
+
 	// Clear the rendering information.
 	for (size_t i = 0; i < geometry.size(); ++i)
 		geometry[i].Release(true);
@@ -285,6 +294,8 @@ void ElementTextDefault::AddLine(const Vector2f& line_position, const String& li
 	lines.push_back(Line(line, baseline_position));
 
 	geometry_dirty = true;
+
+	WatchPendingGlyphs(font_face_handle);
 }
 
 // Prevents the element from dirtying its document's layout when its text is changed.
@@ -293,6 +304,37 @@ void ElementTextDefault::SuppressAutoLayout()
 	dirty_layout_on_change = false;
 }
 
+void ElementTextDefault::OnUpdate()
+{
+	if (!font_glyphs_pending)
+		return;
+
+	FontFaceHandle font_face_handle = GetFontFaceHandle();
+	if (font_face_handle == 0)
+	{
+		font_glyphs_pending = false;
+		return;
+	}
+
+	// Retrieving the version takes in any glyphs that have arrived. Once all of them are available, format and generate
+	// the text again with their proper metrics.
+	FontEngineInterface* font_engine_interface = GetFontEngineInterface();
+	font_engine_interface->GetVersion(font_face_handle);
+
+	if (font_engine_interface->HasPendingGlyphs(font_face_handle))
+	{
+		RequestUpdate();
+		return;
+	}
+
+	font_glyphs_pending = false;
+	geometry_dirty = true;
+	MarkDamaged();
+
+	if (dirty_layout_on_change)
+		DirtyLayout();
+}
+
 void ElementTextDefault::OnPropertyChange(const PropertyIdSet& changed_properties)
 {
 	RMLUI_ZoneScoped;
@@ -407,11 +449,24 @@ bool ElementTextDefault::UpdateFontEffects()
 	return false;
 }
 
+// Requests updates until the font engine has no more pending glyphs.
+void ElementTextDefault::WatchPendingGlyphs(FontFaceHandle font_face_handle)
+{
+	if (!font_glyphs_pending && GetFontEngineInterface()->HasPendingGlyphs(font_face_handle))
+	{
+		font_glyphs_pending = true;
+		RequestUpdate();
+	}
+}
+
 // Clears and regenerates all of the text's geometry.
 void ElementTextDefault::GenerateGeometry(const FontFaceHandle font_face_handle)
 {
 	RMLUI_ZoneScopedC(0xD2691E);
 
+	RMLUI_STATISTICS_COUNT(num_geometry_regenerated, 1);
+	RMLUI_STATISTICS_TRACK_ELEMENT(regenerated_elements, this);
+
 	// Release the old geometry ...
 	for (size_t i = 0; i < geometry.size(); ++i)
 		geometry[i].Release(true);
@@ -81,6 +81,8 @@ public:
 	void SuppressAutoLayout() override;
 
 protected:
+	void OnUpdate() override;
+
 	void OnPropertyChange(const PropertyIdSet& properties) override;
 
 	/// Returns the RML of this element
@@ -91,6 +93,9 @@ private:
 	// Prepares the font effects this element uses for its font.
 	bool UpdateFontEffects();
 
+	// Requests updates until the font engine has no more pending glyphs, if any of them may be used by this text.
+	void WatchPendingGlyphs(FontFaceHandle font_face_handle);
+
 	// Used to store the position and length of each line we have geometry for.
 	struct Line
 	{
@@ -132,6 +137,9 @@ private:
 	bool font_effects_dirty;
 
 	int font_handle_version;
+
+	// Set while the text may be formatted or generated with placeholders for glyphs that are not yet available.
+	bool font_glyphs_pending;
 };
 
 }
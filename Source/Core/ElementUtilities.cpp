@@ -37,6 +37,7 @@
 #include "../../Include/RmlUi/Core/Factory.h"
 #include <queue>
 #include <limits>
+#include "ElementLayer.h"
 #include "LayoutEngine.h"
 #include "ElementStyle.h"
 
@@ -175,8 +176,8 @@ void ElementUtilities::BindEventAttributes(Element* element)
 	}
 }
 	
-// Generates the clipping region for an element.
-bool ElementUtilities::GetClippingRegion(Vector2i& clip_origin, Vector2i& clip_dimensions, Element* element)
+// Generates the clipping region for an element by walking its ancestors.
+static bool GenerateClippingRegion(Vector2i& clip_origin, Vector2i& clip_dimensions, Element* element, Element* capture_element)
 {
 	clip_origin = Vector2i(-1, -1);
 	clip_dimensions = Vector2i(-1, -1);
@@ -185,6 +186,10 @@ bool ElementUtilities::GetClippingRegion(Vector2i& clip_origin, Vector2i& clip_d
 	if (num_ignored_clips < 0)
 		return false;
 
+	// Layers are captured without clipping from outside the layer element.
+	if (element == capture_element)
+		return false;
+
 	// Search through the element's ancestors, finding all elements that clip their overflow and have overflow to clip.
 	// For each that we find, we combine their clipping region with the existing clipping region, and so build up a
 	// complete clipping region for the element.
@@ -235,7 +240,7 @@ bool ElementUtilities::GetClippingRegion(Vector2i& clip_origin, Vector2i& clip_d
 		// Determine how many clip regions this ancestor ignores, and inherit the value. If this region ignores all
 		// clipping regions, then we do too.
 		int clipping_element_ignore_clips = clipping_element->GetClippingIgnoreDepth();
-		if (clipping_element_ignore_clips < 0)
+		if (clipping_element_ignore_clips < 0 || clipping_element == capture_element)
 			break;
 		
 		num_ignored_clips = Math::Max(num_ignored_clips, clipping_element_ignore_clips);
@@ -247,6 +252,26 @@ bool ElementUtilities::GetClippingRegion(Vector2i& clip_origin, Vector2i& clip_d
 	return clip_dimensions.x >= 0 && clip_dimensions.y >= 0;
 }
 
+// Generates the clipping region for an element.
+bool ElementUtilities::GetClippingRegion(Vector2i& clip_origin, Vector2i& clip_dimensions, Element* element)
+{
+	// The region depends on the element being captured while a layer is captured, so it is not cached then.
+	Element* capture_element = ElementLayer::GetCaptureElement();
+	if (capture_element)
+		return GenerateClippingRegion(clip_origin, clip_dimensions, element, capture_element);
+
+	// Otherwise the cached region is reused until any layout, offset, hierarchy or clipping property changes.
+	if (element->clip_generation != Element::clipping_generation)
+	{
+		element->clip_region_valid = GenerateClippingRegion(element->clip_origin, element->clip_dimensions, element, nullptr);
+		element->clip_generation = Element::clipping_generation;
+	}
+
+	clip_origin = element->clip_origin;
+	clip_dimensions = element->clip_dimensions;
+	return element->clip_region_valid;
+}
+
 // Sets the clipping region from an element and its ancestors.
 bool ElementUtilities::SetClippingRegion(Element* element, Context* context)
 {	
@@ -270,6 +295,29 @@ bool ElementUtilities::SetClippingRegion(Element* element, Context* context)
 	Vector2i clip_origin = { -1, -1 };
 	Vector2i clip_dimensions = { -1, -1 };
 	bool clip = element && GetClippingRegion(clip_origin, clip_dimensions, element);
+
+	// Restrict the clipping region to the damaged region being redrawn, if any. Layers are always captured in full.
+	Vector2i redraw_origin;
+	Vector2i redraw_dimensions;
+	if (!ElementLayer::GetCaptureElement() && context->GetRedrawRegion(redraw_origin, redraw_dimensions))
+	{
+		if (!clip)
+		{
+			clip_origin = redraw_origin;
+			clip_dimensions = redraw_dimensions;
+			clip = true;
+		}
+		else
+		{
+			Vector2i top_left(Math::Max(clip_origin.x, redraw_origin.x), Math::Max(clip_origin.y, redraw_origin.y));
+			Vector2i bottom_right(Math::Min(clip_origin.x + clip_dimensions.x, redraw_origin.x + redraw_dimensions.x),
+								  Math::Min(clip_origin.y + clip_dimensions.y, redraw_origin.y + redraw_dimensions.y));
+
+			clip_origin = top_left;
+			clip_dimensions.x = Math::Max(0, bottom_right.x - top_left.x);
+			clip_dimensions.y = Math::Max(0, bottom_right.y - top_left.y);
+		}
+	}
 	
 	Vector2i current_origin = { -1, -1 };
 	Vector2i current_dimensions = { -1, -1 };
@@ -277,7 +325,12 @@ bool ElementUtilities::SetClippingRegion(Element* element, Context* context)
 	if (current_clip != clip || (clip && (clip_origin != current_origin || clip_dimensions != current_dimensions)))
 	{
 		context->SetActiveClipRegion(clip_origin, clip_dimensions);
-		ApplyActiveClipRegion(context, render_interface);
+
+		// Only submit the parts of the scissor state that changed.
+		if (current_clip != clip)
+			render_interface->EnableScissorRegion(clip);
+		if (clip)
+			render_interface->SetScissorRegion(clip_origin.x, clip_origin.y, clip_dimensions.x, clip_dimensions.y);
 	}
 
 	return true;
@@ -361,8 +414,13 @@ bool ElementUtilities::ApplyTransform(Element &element)
 	if (const TransformState* state = element.GetTransformState())
 		new_transform = state->GetTransform();
 
+	// Elements captured into a layer are transformed relative to the layer, whose transform is applied when the layer is rendered.
+	static Matrix4f layer_relative_transform;
+	if (new_transform && ElementLayer::GetCaptureElement())
+		new_transform = (ElementLayer::GetCaptureTransform(*new_transform, layer_relative_transform) ? &layer_relative_transform : nullptr);
+
 	// Only changed transforms are submitted.
-	if (old_transform != new_transform)
+	if (old_transform != new_transform || new_transform == &layer_relative_transform)
 	{
 		Matrix4f& old_transform_value = it->second.value;
 
@@ -31,7 +31,9 @@
 #include "../../Include/RmlUi/Core/Event.h"
 #include "../../Include/RmlUi/Core/EventListener.h"
 #include "../../Include/RmlUi/Core/Factory.h"
+#include "ContextStatistics.h"
 #include "EventSpecification.h"
+#include "Memory.h"
 #include <algorithm>
 #include <limits.h>
 
@@ -49,6 +51,25 @@ struct CompareIdPhase {
 	bool operator()(EventListenerEntry a, EventListenerEntry b) const { return std::tie(a.id, a.in_capture_phase) < std::tie(b.id, b.in_capture_phase); }
 };
 
+// The number of listeners attached to all dispatchers for each event id, so that events nobody listens to need not look for listeners.
+static std::vector<int> listener_counts;
+
+static void AddListenerCount(EventId id, int count)
+{
+	const size_t index = (size_t)id;
+	if (index >= listener_counts.size())
+		listener_counts.resize(index + 1, 0);
+
+	listener_counts[index] += count;
+	RMLUI_ASSERT(listener_counts[index] >= 0);
+}
+
+static bool HasListeners(EventId id)
+{
+	const size_t index = (size_t)id;
+	return index < listener_counts.size() && listener_counts[index] > 0;
+}
+
 
 
 EventDispatcher::EventDispatcher(Element* _element)
@@ -60,7 +81,10 @@ EventDispatcher::~EventDispatcher()
 {
 	// Detach from all event dispatchers
 	for (const auto& event : listeners)
+	{
+		AddListenerCount(event.id, -1);
 		event.listener->OnDetach(element);
+	}
 }
 
 void EventDispatcher::AttachEvent(EventId id, EventListener* listener, bool in_capture_phase)
@@ -75,6 +99,7 @@ void EventDispatcher::AttachEvent(EventId id, EventListener* listener, bool in_c
 	{
 		// No existing entry found, add it to the end of the (id, phase) range
 		listeners.emplace(it, entry);
+		AddListenerCount(id, 1);
 		listener->OnAttach(element);
 	}
 }
@@ -93,6 +118,7 @@ void EventDispatcher::DetachEvent(EventId id, EventListener* listener, bool in_c
 	{
 		// We found our listener, remove it
 		listeners.erase(it);
+		AddListenerCount(id, -1);
 		listener->OnDetach(element);
 	}
 }
@@ -101,7 +127,10 @@ void EventDispatcher::DetachEvent(EventId id, EventListener* listener, bool in_c
 void EventDispatcher::DetachAllEvents()
 {
 	for (const auto& event : listeners)
+	{
+		AddListenerCount(event.id, -1);
 		event.listener->OnDetach(element);
+	}
 
 	listeners.clear();
 
@@ -117,6 +146,7 @@ void EventDispatcher::DetachAllEvents()
 */
 struct CollectedListener {
 
+	CollectedListener() = default;
 	CollectedListener(Element* _element, EventListener* _listener, int dom_distance_from_target, bool in_capture_phase) : element(_element->GetObserverPtr()), listener(_listener->GetObserverPtr())
 	{
 		sort = dom_distance_from_target * (in_capture_phase ? -1 : 1);
@@ -131,10 +161,6 @@ struct CollectedListener {
 
 	// Default actions are returned by EventPhase::None.
 	EventPhase GetPhase() const { return sort < 0 ? EventPhase::Capture : (sort == 0 ? EventPhase::Target : EventPhase::Bubble); }
-
-	bool operator<(const CollectedListener& other) const {
-		return sort < other.sort;
-	}
 };
 
 
@@ -142,38 +168,71 @@ bool EventDispatcher::DispatchEvent(Element* target_element, const EventId id, c
 {
 	RMLUI_ASSERTMSG(!((int)default_action_phase & (int)EventPhase::Capture), "We assume here that the default action phases cannot include capture phase.");
 
-	std::vector<CollectedListener> listeners;
-	std::vector<ObserverPtr<Element>> default_action_elements;
+	RMLUI_STATISTICS_COUNT(num_events_dispatched, 1);
+	DocumentStatisticsScope statistics_scope(ContextStatisticsScope::GetActive() ? target_element->GetOwnerDocument() : nullptr, &DocumentStatistics::event_time);
 
 	const EventPhase phases_to_execute = EventPhase((int)EventPhase::Capture | (int)EventPhase::Target | (bubbles ? (int)EventPhase::Bubble : 0));
-	
-	// Walk the DOM tree from target to root, collecting all possible listeners and elements with default actions in the process.
+	const bool has_listeners = HasListeners(id);
+
+	// Walk the DOM tree from target to root first to size the collections, counting the listeners attached to this event id.
+	int num_listeners = 0;
+	int num_default_action_elements = 0;
+	for (Element* walk_element = target_element; walk_element; walk_element = walk_element->GetParentNode())
+	{
+		if (has_listeners)
+		{
+			auto range = walk_element->GetEventDispatcher()->GetListeners(id);
+			num_listeners += (int)(range.second - range.first);
+		}
+
+		if (walk_element == target_element ? ((int)default_action_phase & (int)EventPhase::Target) : ((int)default_action_phase & (int)EventPhase::Bubble))
+			num_default_action_elements += 1;
+	}
+
+	if (num_listeners == 0 && num_default_action_elements == 0)
+		return true;
+
+	// The collections are allocated from the global stack allocator. Listeners dispatching other events allocate and release
+	// their own collections on top of these before returning, so common dispatches allocate nothing from the heap.
+	DynamicArray<CollectedListener, GlobalStackAllocator<CollectedListener>> listeners(num_listeners);
+	DynamicArray<ObserverPtr<Element>, GlobalStackAllocator<ObserverPtr<Element>>> default_action_elements(num_default_action_elements);
+
+	// Walk the DOM tree again, collecting all possible listeners and elements with default actions in the process. Capture phase
+	// listeners are collected from the back, which places the elements closest to the root first while keeping the order of the
+	// listeners within each element. Then they only need to be moved in front of the other listeners.
+	int front_index = 0;
+	int back_index = num_listeners;
+	int default_action_index = 0;
 	int dom_distance_from_target = 0;
 	Element* walk_element = target_element;
 	while (walk_element)
 	{
-		EventDispatcher* dispatcher = walk_element->GetEventDispatcher();
-		dispatcher->CollectListeners(dom_distance_from_target, id, phases_to_execute, listeners);
+		if (has_listeners)
+		{
+			EventDispatcher* dispatcher = walk_element->GetEventDispatcher();
+			dispatcher->CollectListeners(dom_distance_from_target, id, phases_to_execute, listeners.data(), front_index, back_index);
+		}
 
 		if(dom_distance_from_target == 0)
 		{
 			if ((int)default_action_phase & (int)EventPhase::Target)
-				default_action_elements.push_back(walk_element->GetObserverPtr());
+				default_action_elements[default_action_index++] = walk_element->GetObserverPtr();
 		}
 		else if((int)default_action_phase & (int)EventPhase::Bubble)
 		{
-			default_action_elements.push_back(walk_element->GetObserverPtr());
+			default_action_elements[default_action_index++] = walk_element->GetObserverPtr();
 		}
 
 		walk_element = walk_element->GetParentNode();
 		dom_distance_from_target += 1;
 	}
 
-	if (listeners.empty() && default_action_elements.empty())
-		return true;
+	const int num_capture_listeners = num_listeners - back_index;
+	std::rotate(listeners.data(), listeners.data() + back_index, listeners.data() + num_listeners);
+	const int num_collected_listeners = front_index + num_capture_listeners;
 
-	// Use stable_sort so that the order of the listeners in a given element is maintained.
-	std::stable_sort(listeners.begin(), listeners.end());
+	if (num_collected_listeners == 0 && num_default_action_elements == 0)
+		return true;
 
 	// Instance event
 	EventPtr event = Factory::InstanceEvent(target_element, id, type, parameters, interruptible);
@@ -183,8 +242,9 @@ bool EventDispatcher::DispatchEvent(Element* target_element, const EventId id, c
 	int previous_sort_value = INT_MAX;
 
 	// Process the event in each listener.
-	for (const auto& listener_desc : listeners)
+	for (int i = 0; i < num_collected_listeners; i++)
 	{
+		const CollectedListener& listener_desc = listeners[i];
 		Element* element = listener_desc.element.get();
 		EventListener* listener = listener_desc.listener.get();
 
@@ -209,8 +269,9 @@ bool EventDispatcher::DispatchEvent(Element* target_element, const EventId id, c
 	}
 
 	// Process the default actions.
-	for (auto& element_ptr : default_action_elements)
+	for (int i = 0; i < num_default_action_elements; i++)
 	{
+		const ObserverPtr<Element>& element_ptr = default_action_elements[i];
 		if (!event->IsPropagating())
 			break;
 
@@ -228,11 +289,20 @@ bool EventDispatcher::DispatchEvent(Element* target_element, const EventId id, c
 }
 
 
-void EventDispatcher::CollectListeners(int dom_distance_from_target, const EventId event_id, const EventPhase event_executes_in_phases, std::vector<CollectedListener>& collect_listeners)
+std::pair< EventDispatcher::Listeners::iterator, EventDispatcher::Listeners::iterator > EventDispatcher::GetListeners(const EventId event_id)
 {
 	// Find all the entries with a matching id, given that listeners are sorted by id first.
+	if (listeners.empty())
+		return { listeners.end(), listeners.end() };
+
+	return std::equal_range(listeners.begin(), listeners.end(), EventListenerEntry(event_id, nullptr, false), CompareId());
+}
+
+
+void EventDispatcher::CollectListeners(int dom_distance_from_target, const EventId event_id, const EventPhase event_executes_in_phases, CollectedListener* collect_listeners, int& front_index, int& back_index)
+{
 	Listeners::iterator begin, end;
-	std::tie(begin, end) = std::equal_range(listeners.begin(), listeners.end(), EventListenerEntry(event_id, nullptr, false), CompareId());
+	std::tie(begin, end) = GetListeners(event_id);
 
 	const bool in_target_phase = (dom_distance_from_target == 0);
 
@@ -242,18 +312,26 @@ void EventDispatcher::CollectListeners(int dom_distance_from_target, const Event
 		if ((int)event_executes_in_phases & (int)EventPhase::Target)
 		{
 			for (auto it = begin; it != end; ++it)
-				collect_listeners.emplace_back(element, it->listener, dom_distance_from_target, false);
+				collect_listeners[front_index++] = CollectedListener(element, it->listener, dom_distance_from_target, false);
 		}
 	}
 	else
 	{
+		// Capture phase listeners are sorted after the bubble phase listeners of the same id. Place them in front of the back index
+		// in the same order.
+		const int num_capture_listeners = (int)std::count_if(begin, end, [](const EventListenerEntry& entry) { return entry.in_capture_phase; });
+		int capture_index = (back_index -= num_capture_listeners);
+
 		// Iterate through all the listeners and collect those matching the event execution phase.
 		for (auto it = begin; it != end; ++it)
 		{
 			// Listeners will either attach to capture or bubble phase, make sure the event can execute in the same phase.
 			const EventPhase listener_executes_in_phase = (it->in_capture_phase ? EventPhase::Capture : EventPhase::Bubble);
 			if ((int)event_executes_in_phases & (int)listener_executes_in_phase)
-				collect_listeners.emplace_back(element, it->listener, dom_distance_from_target, it->in_capture_phase);
+			{
+				int& index = (it->in_capture_phase ? capture_index : front_index);
+				collect_listeners[index++] = CollectedListener(element, it->listener, dom_distance_from_target, it->in_capture_phase);
+			}
 		}
 	}
 }
@@ -102,8 +102,12 @@ private:
 	typedef std::vector< EventListenerEntry > Listeners;
 	Listeners listeners;
 
-	// Collect all the listeners from this dispatcher that are allowed to execute given the input arguments.
-	void CollectListeners(int dom_distance_from_target, EventId event_id, EventPhase phases_to_execute, std::vector<CollectedListener>& collect_listeners);
+	// Returns the range of listeners attached to the given event id.
+	std::pair< Listeners::iterator, Listeners::iterator > GetListeners(EventId event_id);
+
+	// Collect all the listeners from this dispatcher that are allowed to execute given the input arguments. Capture phase listeners
+	// are placed in front of the back index, and the others after the front index, advancing the indices towards each other.
+	void CollectListeners(int dom_distance_from_target, EventId event_id, EventPhase phases_to_execute, CollectedListener* collect_listeners, int& front_index, int& back_index);
 };
 
 
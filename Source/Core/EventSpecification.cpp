@@ -77,6 +77,7 @@ void Initialize()
 		{EventId::Scroll        , "scroll"        , false , true  , DefaultActionPhase::None},
 		{EventId::Animationend  , "animationend"  , false , true  , DefaultActionPhase::None},
 		{EventId::Transitionend , "transitionend" , false , true  , DefaultActionPhase::None},
+		{EventId::Loadprogress  , "loadprogress"  , false , false , DefaultActionPhase::None},
 								 				 
 		{EventId::Change        , "change"        , false , true  , DefaultActionPhase::None},
 		{EventId::Submit        , "submit"        , true  , true  , DefaultActionPhase::None},
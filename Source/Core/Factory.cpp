@@ -333,6 +333,19 @@ ElementPtr Factory::InstanceDocumentStream(Rml::Core::Context* context, Stream*
 {
 	RMLUI_ZoneScoped;
 
+	ElementPtr element = InstanceDocument(context);
+	if (!element)
+		return nullptr;
+
+	XMLParser parser(element.get());
+	parser.Parse(stream);
+
+	return element;
+}
+
+// Instances an empty document.
+ElementPtr Factory::InstanceDocument(Rml::Core::Context* context)
+{
 	ElementPtr element = Factory::InstanceElement(nullptr, "body", "body", XMLAttributes());
 	if (!element)
 	{
@@ -349,9 +362,6 @@ ElementPtr Factory::InstanceDocumentStream(Rml::Core::Context* context, Stream*
 
 	document->context = context;
 
-	XMLParser parser(element.get());
-	parser.Parse(stream);
-
 	return element;
 }
 
@@ -49,5 +49,17 @@ size_t FileInterface::Length(FileHandle file)
     return length;
 }
 
+// Maps a file into memory, not supported by default.
+const byte* FileInterface::Map(const String& /*path*/, size_t& length)
+{
+	length = 0;
+	return nullptr;
+}
+
+// Unmaps a file previously mapped into memory.
+void FileInterface::Unmap(const byte* /*data*/, size_t /*length*/)
+{
+}
+
 }
 }
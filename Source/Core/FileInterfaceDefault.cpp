@@ -30,6 +30,15 @@
 
 #ifndef RMLUI_NO_FILE_INTERFACE_DEFAULT
 
+#if defined(RMLUI_PLATFORM_WIN32)
+#include <windows.h>
+#elif defined(RMLUI_PLATFORM_UNIX)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace Rml {
 namespace Core {
 
@@ -67,6 +76,72 @@ size_t FileInterfaceDefault::Tell(FileHandle file)
 	return ftell((FILE*) file);
 }
 
+// Maps a file into memory.
+const byte* FileInterfaceDefault::Map(const String& path, size_t& length)
+{
+	length = 0;
+	const byte* data = nullptr;
+
+#if defined(RMLUI_PLATFORM_WIN32)
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return nullptr;
+
+	LARGE_INTEGER file_size;
+	if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0)
+	{
+		// The view keeps the mapping alive after its handles are closed.
+		HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mapping)
+		{
+			data = (const byte*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			if (data)
+				length = (size_t)file_size.QuadPart;
+			CloseHandle(mapping);
+		}
+	}
+
+	CloseHandle(file);
+
+#elif defined(RMLUI_PLATFORM_UNIX)
+	int file = open(path.c_str(), O_RDONLY);
+	if (file < 0)
+		return nullptr;
+
+	struct stat file_status;
+	if (fstat(file, &file_status) == 0 && file_status.st_size > 0)
+	{
+		// The mapping stays valid after the file is closed.
+		void* mapping = mmap(nullptr, (size_t)file_status.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+		if (mapping != MAP_FAILED)
+		{
+			data = (const byte*)mapping;
+			length = (size_t)file_status.st_size;
+		}
+	}
+
+	close(file);
+#else
+	(void)path;
+#endif
+
+	return data;
+}
+
+// Unmaps a file previously mapped into memory.
+void FileInterfaceDefault::Unmap(const byte* data, size_t length)
+{
+#if defined(RMLUI_PLATFORM_WIN32)
+	(void)length;
+	UnmapViewOfFile(data);
+#elif defined(RMLUI_PLATFORM_UNIX)
+	munmap(const_cast<byte*>(data), length);
+#else
+	(void)data;
+	(void)length;
+#endif
+}
+
 }
 }
 
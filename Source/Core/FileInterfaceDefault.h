@@ -71,6 +71,16 @@ public:
 	/// @param file The handle of the file to be queried.
 	/// @return The number of bytes from the origin of the file.
 	size_t Tell(FileHandle file) override;
+
+	/// Maps a file into memory using the platform's file mapping functions.
+	/// @param path The path of the file to map.
+	/// @param length The length of the mapped file in bytes.
+	/// @return A pointer to the read-only contents of the file, or nullptr if the file could not be mapped.
+	const byte* Map(const String& path, size_t& length) override;
+	/// Unmaps a file previously mapped through Map().
+	/// @param data The pointer returned by Map().
+	/// @param length The length of the mapped file in bytes.
+	void Unmap(const byte* data, size_t length) override;
 };
 
 }
@@ -0,0 +1,416 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#include "BitmapFont.h"
+#include "../../../Include/RmlUi/Core/Core.h"
+#include "../../../Include/RmlUi/Core/FileInterface.h"
+#include "../../../Include/RmlUi/Core/Log.h"
+#include "../../../Include/RmlUi/Core/Math.h"
+#include <string.h>
+
+namespace Rml {
+namespace Core {
+
+// Limits of the descriptor, fonts exceeding them fail to load instead of allocating unbounded amounts of memory.
+static constexpr int MAX_PAGES = 256;
+static constexpr int MAX_CHARACTER = 0x10FFFF;
+static constexpr int MAX_KERNING_PAIRS = 1 << 20;
+
+// Integer values are saturated to this magnitude, so that sums and differences of them can not overflow.
+static constexpr int MAX_VALUE = 1 << 24;
+
+static bool IsSpace(char c)
+{
+	return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+// Finds the value of an attribute in a line of the descriptor. Attributes are written as 'name=value' in the text format
+// and as 'name="value"' in the XML format, values containing spaces are quoted in both formats.
+static bool FindAttribute(const char* begin, const char* end, const char* name, const char*& value_begin, const char*& value_end)
+{
+	const size_t name_length = strlen(name);
+	const char* p = begin;
+
+	while (p < end)
+	{
+		while (p < end && IsSpace(*p))
+			p++;
+
+		const char* key_begin = p;
+		while (p < end && *p != '=' && !IsSpace(*p))
+			p++;
+		const char* key_end = p;
+
+		if (p >= end || *p != '=')
+			continue;
+		p++;
+
+		if (p < end && *p == '"')
+		{
+			value_begin = ++p;
+			while (p < end && *p != '"')
+				p++;
+			value_end = p;
+			if (p < end)
+				p++;
+		}
+		else
+		{
+			value_begin = p;
+			while (p < end && !IsSpace(*p) && *p != '/' && *p != '>')
+				p++;
+			value_end = p;
+		}
+
+		if (size_t(key_end - key_begin) == name_length && memcmp(key_begin, name, name_length) == 0)
+			return true;
+	}
+
+	return false;
+}
+
+// Returns the value of an integer attribute, or the default value if the line does not contain the attribute.
+static int GetInt(const char* begin, const char* end, const char* name, int default_value = 0)
+{
+	const char* value_begin = nullptr;
+	const char* value_end = nullptr;
+	if (!FindAttribute(begin, end, name, value_begin, value_end))
+		return default_value;
+
+	bool negative = false;
+	if (value_begin < value_end && *value_begin == '-')
+	{
+		negative = true;
+		value_begin++;
+	}
+
+	int value = 0;
+	for (const char* p = value_begin; p < value_end && *p >= '0' && *p <= '9'; p++)
+		value = Math::Min(value * 10 + (*p - '0'), MAX_VALUE);
+
+	return negative ? -value : value;
+}
+
+// Returns the value of a string attribute, or an empty string if the line does not contain the attribute.
+static String GetString(const char* begin, const char* end, const char* name)
+{
+	const char* value_begin = nullptr;
+	const char* value_end = nullptr;
+	if (!FindAttribute(begin, end, name, value_begin, value_end))
+		return String();
+
+	return String(value_begin, value_end);
+}
+
+BitmapFont::BitmapFont()
+{
+	metrics = {};
+}
+
+UniquePtr<BitmapFont> BitmapFont::Load(const String& file_name)
+{
+	FileInterface* file_interface = GetFileInterface();
+
+	// The descriptor is parsed straight from the mapped file when possible, only the parsed glyphs are kept.
+	size_t length = 0;
+	const byte* mapped_data = file_interface->Map(file_name, length);
+	UniquePtr<byte[]> buffer;
+
+	if (!mapped_data)
+	{
+		FileHandle handle = file_interface->Open(file_name);
+		if (!handle)
+		{
+			Log::Message(Log::LT_ERROR, "Failed to load bitmap font from %s, could not open file.", file_name.c_str());
+			return nullptr;
+		}
+
+		length = file_interface->Length(handle);
+		buffer.reset(new byte[length]);
+		length = file_interface->Read(buffer.get(), length, handle);
+		file_interface->Close(handle);
+	}
+
+	const char* data = (const char*)(mapped_data ? mapped_data : buffer.get());
+	const char* data_end = data + length;
+
+	UniquePtr<BitmapFont> font(new BitmapFont);
+	bool result = true;
+
+	if (length >= 3 && memcmp(data, "BMF", 3) == 0)
+	{
+		Log::Message(Log::LT_ERROR, "Failed to load bitmap font from %s, the binary descriptor format is not supported.", file_name.c_str());
+		result = false;
+	}
+
+	for (const char* line_begin = data; result && line_begin < data_end;)
+	{
+		const char* line_end = (const char*)memchr(line_begin, '\n', size_t(data_end - line_begin));
+		if (!line_end)
+			line_end = data_end;
+
+		result = font->ParseLine(line_begin, line_end, file_name);
+		line_begin = line_end + 1;
+	}
+
+	if (mapped_data)
+		file_interface->Unmap(mapped_data, length);
+
+	if (!result)
+		return nullptr;
+
+	if (font->metrics.size <= 0 || font->glyphs.empty() || font->pages.empty() || font->atlas_dimensions.x <= 0 || font->atlas_dimensions.y <= 0)
+	{
+		Log::Message(Log::LT_ERROR, "Failed to load bitmap font from %s, the descriptor is incomplete.", file_name.c_str());
+		return nullptr;
+	}
+
+	for (const Texture& page : font->pages)
+	{
+		if (page.GetSource().empty())
+		{
+			Log::Message(Log::LT_ERROR, "Failed to load bitmap font from %s, the descriptor is missing a page.", file_name.c_str());
+			return nullptr;
+		}
+	}
+
+	// The atlas boxes are read in pixels, as the characters may be listed before the dimensions of the atlas.
+	for (auto& pair : font->atlas_boxes)
+	{
+		AtlasBox& box = pair.second;
+		box.texcoords[0] = box.texcoords[0] / font->atlas_dimensions;
+		box.texcoords[1] = box.texcoords[1] / font->atlas_dimensions;
+	}
+
+	FontMetrics& metrics = font->metrics;
+	metrics.baseline = metrics.line_height - font->base;
+
+	auto it_x = font->glyphs.find((Character)'x');
+	if (it_x != font->glyphs.end())
+		metrics.x_height = it_x->second.dimensions.y;
+
+	// The descriptor has no underline information, place it halfway into the descent.
+	metrics.underline_position = -Math::Max(float(metrics.baseline) * 0.5f, 1.0f);
+	metrics.underline_thickness = 1.0f;
+
+	return font;
+}
+
+bool BitmapFont::ParseLine(const char* begin, const char* end, const String& file_name)
+{
+	// Lines start with their tag, such as 'char' in the text format or '<char' in the XML format.
+	while (begin < end && (IsSpace(*begin) || *begin == '<'))
+		begin++;
+
+	const char* tag_begin = begin;
+	while (begin < end && *begin >= 'a' && *begin <= 'z')
+		begin++;
+
+	const String tag(tag_begin, begin);
+
+	if (tag == "info")
+	{
+		family = GetString(begin, end, "face");
+		// Negative sizes denote the size was matched against the cell height rather than the character height.
+		const int size = GetInt(begin, end, "size");
+		metrics.size = (size < 0 ? -size : size);
+		style = (GetInt(begin, end, "italic") == 1 ? Style::FontStyle::Italic : Style::FontStyle::Normal);
+		weight = (GetInt(begin, end, "bold") == 1 ? Style::FontWeight::Bold : Style::FontWeight::Normal);
+	}
+	else if (tag == "common")
+	{
+		metrics.line_height = GetInt(begin, end, "lineHeight");
+		base = GetInt(begin, end, "base");
+		atlas_dimensions.x = (float)GetInt(begin, end, "scaleW");
+		atlas_dimensions.y = (float)GetInt(begin, end, "scaleH");
+
+		const int num_pages = GetInt(begin, end, "pages");
+		if (num_pages < 0 || num_pages > MAX_PAGES)
+		{
+			Log::Message(Log::LT_ERROR, "Failed to load bitmap font from %s, %d pages exceeds the limit of %d.", file_name.c_str(), num_pages, MAX_PAGES);
+			return false;
+		}
+
+		pages.resize((size_t)num_pages);
+	}
+	else if (tag == "page")
+	{
+		const int id = GetInt(begin, end, "id", -1);
+		const String texture_name = GetString(begin, end, "file");
+
+		if (id < 0 || id >= (int)pages.size() || texture_name.empty())
+		{
+			Log::Message(Log::LT_ERROR, "Failed to load bitmap font from %s, invalid page %d.", file_name.c_str(), id);
+			return false;
+		}
+
+		pages[id].Set(texture_name, file_name);
+	}
+	else if (tag == "chars")
+	{
+		const int count = GetInt(begin, end, "count");
+		if (count < 0 || count > MAX_CHARACTER)
+		{
+			Log::Message(Log::LT_ERROR, "Failed to load bitmap font from %s, %d characters exceeds the limit of %d.", file_name.c_str(), count, MAX_CHARACTER);
+			return false;
+		}
+
+		glyphs.reserve((size_t)count);
+		atlas_boxes.reserve((size_t)count);
+	}
+	else if (tag == "char")
+	{
+		const int id = GetInt(begin, end, "id", -1);
+		const int page = GetInt(begin, end, "page");
+		if (id <= 0)
+			return true;
+
+		if (id > MAX_CHARACTER)
+		{
+			Log::Message(Log::LT_ERROR, "Failed to load bitmap font from %s, invalid character %d.", file_name.c_str(), id);
+			return false;
+		}
+
+		if (page < 0 || page >= (int)pages.size())
+		{
+			Log::Message(Log::LT_ERROR, "Failed to load bitmap font from %s, character %d refers to invalid page %d.", file_name.c_str(), id, page);
+			return false;
+		}
+
+		const Character character = (Character)id;
+		const Vector2i position(GetInt(begin, end, "x"), GetInt(begin, end, "y"));
+		const Vector2i dimensions(GetInt(begin, end, "width"), GetInt(begin, end, "height"));
+
+		// The offset is given from the top of the line, while the bearing is given from the baseline.
+		FontGlyph& glyph = glyphs[character];
+		glyph.dimensions = dimensions;
+		glyph.bearing = Vector2i(GetInt(begin, end, "xoffset"), base - GetInt(begin, end, "yoffset"));
+		glyph.advance = GetInt(begin, end, "xadvance");
+
+		AtlasBox& box = atlas_boxes[character];
+		box.texcoords[0] = Vector2f((float)position.x, (float)position.y);
+		box.texcoords[1] = Vector2f(float(position.x + dimensions.x), float(position.y + dimensions.y));
+		box.page = page;
+	}
+	else if (tag == "kernings")
+	{
+		const int count = GetInt(begin, end, "count");
+		if (count < 0 || count > MAX_KERNING_PAIRS)
+		{
+			Log::Message(Log::LT_ERROR, "Failed to load bitmap font from %s, %d kerning pairs exceeds the limit of %d.", file_name.c_str(), count, MAX_KERNING_PAIRS);
+			return false;
+		}
+
+		kerning.reserve((size_t)count);
+	}
+	else if (tag == "kerning")
+	{
+		const int first = GetInt(begin, end, "first");
+		const int second = GetInt(begin, end, "second");
+		const int amount = GetInt(begin, end, "amount");
+
+		if (first < 0 || first > MAX_CHARACTER || second < 0 || second > MAX_CHARACTER)
+		{
+			Log::Message(Log::LT_ERROR, "Failed to load bitmap font from %s, invalid kerning pair %d, %d.", file_name.c_str(), first, second);
+			return false;
+		}
+
+		if (first != 0 && second != 0 && amount != 0)
+		{
+			const std::uint64_t key = ((std::uint64_t)first << 32) | (std::uint64_t)second;
+
+			// The count is optional, so the number of pairs is also limited as they are added.
+			if ((int)kerning.size() >= MAX_KERNING_PAIRS && kerning.find(key) == kerning.end())
+			{
+				Log::Message(Log::LT_ERROR, "Failed to load bitmap font from %s, the kerning pairs exceed the limit of %d.", file_name.c_str(), MAX_KERNING_PAIRS);
+				return false;
+			}
+
+			kerning[key] = amount;
+		}
+	}
+
+	return true;
+}
+
+const String& BitmapFont::GetFamily() const
+{
+	return family;
+}
+
+Style::FontStyle BitmapFont::GetStyle() const
+{
+	return style;
+}
+
+Style::FontWeight BitmapFont::GetWeight() const
+{
+	return weight;
+}
+
+const FontMetrics& BitmapFont::GetMetrics() const
+{
+	return metrics;
+}
+
+const FontGlyphMap& BitmapFont::GetGlyphs() const
+{
+	return glyphs;
+}
+
+const BitmapFont::AtlasBox* BitmapFont::GetAtlasBox(Character character) const
+{
+	auto it = atlas_boxes.find(character);
+	if (it == atlas_boxes.end())
+		return nullptr;
+
+	return &it->second;
+}
+
+bool BitmapFont::HasKerning() const
+{
+	return !kerning.empty();
+}
+
+int BitmapFont::GetKerning(Character lhs, Character rhs) const
+{
+	const std::uint64_t key = ((std::uint64_t)lhs << 32) | (std::uint64_t)rhs;
+
+	auto it = kerning.find(key);
+	if (it == kerning.end())
+		return 0;
+
+	return it->second;
+}
+
+const std::vector<Texture>& BitmapFont::GetPages() const
+{
+	return pages;
+}
+
+}
+}
@@ -0,0 +1,105 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#ifndef RMLUICOREBITMAPFONT_H
+#define RMLUICOREBITMAPFONT_H
+
+#include "../../../Include/RmlUi/Core/Texture.h"
+#include "../../../Include/RmlUi/Core/Traits.h"
+#include "../../../Include/RmlUi/Core/Types.h"
+#include "FontTypes.h"
+#include <cstdint>
+
+namespace Rml {
+namespace Core {
+
+/**
+	A pre-rendered font loaded from a BMFont descriptor in the text or XML format, along with its atlas textures. The
+	glyphs are rendered straight from the atlas, so the font is used without rasterizing glyphs or generating textures.
+ */
+class BitmapFont final : public NonCopyMoveable
+{
+public:
+	/// The location of a glyph in the atlas.
+	struct AtlasBox
+	{
+		Vector2f texcoords[2];
+		int page = 0;
+	};
+
+	/// Loads a font from its descriptor file, mapping the file through the file interface where possible. The atlas
+	/// textures are loaded relative to the descriptor when first rendered.
+	/// @param[in] file_name The path of the descriptor file.
+	/// @return The loaded font, or nullptr if the descriptor could not be loaded.
+	static UniquePtr<BitmapFont> Load(const String& file_name);
+
+	/// Returns the family, style and weight the font was generated from.
+	const String& GetFamily() const;
+	Style::FontStyle GetStyle() const;
+	Style::FontWeight GetWeight() const;
+
+	/// Returns the metrics of the font at the size it was rendered at.
+	const FontMetrics& GetMetrics() const;
+
+	/// Returns the glyphs of the font. The glyphs have no bitmaps, they are rendered from the atlas instead.
+	const FontGlyphMap& GetGlyphs() const;
+	/// Returns the location of a glyph in the atlas, or nullptr if the font has no glyph for the character.
+	const AtlasBox* GetAtlasBox(Character character) const;
+
+	/// Returns true if the descriptor contains any kerning pairs.
+	bool HasKerning() const;
+	/// Returns the kerning between two characters.
+	int GetKerning(Character lhs, Character rhs) const;
+
+	/// Returns the atlas textures, indexed by page.
+	const std::vector<Texture>& GetPages() const;
+
+private:
+	BitmapFont();
+
+	// Reads one line of the descriptor, returning false if the line is invalid.
+	bool ParseLine(const char* begin, const char* end, const String& file_name);
+
+	String family;
+	Style::FontStyle style = Style::FontStyle::Normal;
+	Style::FontWeight weight = Style::FontWeight::Normal;
+
+	FontMetrics metrics;
+	int base = 0;
+	Vector2f atlas_dimensions;
+
+	FontGlyphMap glyphs;
+	UnorderedMap< Character, AtlasBox > atlas_boxes;
+	UnorderedMap< std::uint64_t, int > kerning;
+
+	std::vector<Texture> pages;
+};
+
+}
+}
+
+#endif
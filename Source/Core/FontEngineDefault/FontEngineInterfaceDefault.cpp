@@ -111,8 +111,26 @@ int FontEngineInterfaceDefault::GenerateString(FontFaceHandle handle, FontEffect
 int FontEngineInterfaceDefault::GetVersion(FontFaceHandle handle)
 {
 	auto handle_default = reinterpret_cast<FontFaceHandleDefault*>(handle);
+	handle_default->UpdatePendingGlyphs();
 	return handle_default->GetVersion();
 }
 
+bool FontEngineInterfaceDefault::HasPendingGlyphs(FontFaceHandle handle)
+{
+	auto handle_default = reinterpret_cast<FontFaceHandleDefault*>(handle);
+	return handle_default->HasPendingGlyphs();
+}
+
+void FontEngineInterfaceDefault::PrewarmGlyphs(FontFaceHandle handle, FontEffectsHandle font_effects_handle, const String& characters, RenderInterface* render_interface)
+{
+	auto handle_default = reinterpret_cast<FontFaceHandleDefault*>(handle);
+	handle_default->Prewarm(characters, (int)font_effects_handle, render_interface);
+}
+
+void FontEngineInterfaceDefault::GetFontFaceStatistics(std::vector<FontFaceStatistics>& statistics)
+{
+	FontProvider::GetFontFaceStatistics(statistics);
+}
+
 }
 }
@@ -74,6 +74,15 @@ public:
 
 	/// Returns the current version of the font face.
 	int GetVersion(FontFaceHandle handle) override;
+
+	/// Returns true while any glyphs of the font face are being rasterized in the background.
+	bool HasPendingGlyphs(FontFaceHandle handle) override;
+
+	/// Rasterizes the given characters and generates the textures of the layers of the given font effects.
+	void PrewarmGlyphs(FontFaceHandle handle, FontEffectsHandle font_effects_handle, const String& characters, RenderInterface* render_interface) override;
+
+	/// Appends the information of all font face handles in use.
+	void GetFontFaceStatistics(std::vector<FontFaceStatistics>& statistics) override;
 };
 
 }
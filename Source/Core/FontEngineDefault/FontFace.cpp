@@ -26,60 +26,92 @@
  *
  */
 
+#include "../../../Include/RmlUi/Core/FileInterface.h"
+#include "../../../Include/RmlUi/Core/FontEngineInterface.h"
 #include "../../../Include/RmlUi/Core/Log.h"
 #include "FontFace.h"
+#include "BitmapFont.h"
 #include "FontFaceHandleDefault.h"
 #include "FreeTypeInterface.h"
+#include "GlyphCache.h"
+#include "TextShaper.h"
 
 namespace Rml {
 namespace Core {
 
-FontFace::FontFace(FontFaceHandleFreetype _face, Style::FontStyle _style, Style::FontWeight _weight, bool _release_stream)
+FontFace::FontFace(FontFaceHandleFreetype _face, DataOwner _data_owner, FileInterface* _file_interface)
 {
-	style = _style;
-	weight = _weight;
 	face = _face;
 
-	release_stream = _release_stream;
+	data_owner = _data_owner;
+	file_interface = _file_interface;
+}
+
+FontFace::FontFace(UniquePtr<BitmapFont> _bitmap_font) : bitmap_font(std::move(_bitmap_font))
+{
+	face = 0;
+
+	data_owner = DataOwner::FontEngine;
+	file_interface = nullptr;
 }
 
 FontFace::~FontFace()
 {
+	// Handles store their glyphs in the glyph cache when destroyed, which requires the face.
+	handles.clear();
+
 	if (face) 
 	{
-		FreeType::ReleaseFace(face, release_stream);
+		const byte* data = nullptr;
+		int data_length = 0;
+		FreeType::GetFaceData(face, data, data_length);
+
+		if (TextShaper* text_shaper = TextShaper::Get())
+			text_shaper->ReleaseFace(face);
+
+		FreeType::ReleaseFace(face, data_owner == DataOwner::FontEngine);
 		face = 0;
+
+		if (data_owner == DataOwner::FileInterface)
+			file_interface->Unmap(data, (size_t)data_length);
 	}
-	handles.clear();
 }
 
-// Returns the style of the font face.
-Style::FontStyle FontFace::GetStyle() const
+// Returns the FreeType face.
+FontFaceHandleFreetype FontFace::GetFace() const
 {
-	return style;
+	return face;
 }
 
-// Returns the weight of the font face.
-Style::FontWeight FontFace::GetWeight() const
+// Returns the bitmap font.
+const BitmapFont* FontFace::GetBitmapFont() const
 {
-	return weight;
+	return bitmap_font.get();
 }
 
 FontFaceHandleDefault* FontFace::GetHandle(int size) {
+	// Bitmap fonts are pre-rendered at a single size, all sizes share its handle.
+	if (bitmap_font)
+		size = bitmap_font->GetMetrics().size;
+
 	auto it = handles.find(size);
 	if (it != handles.end())
 		return it->second.get();
 
 	// See if this face has been released.
-	if (!face)
+	if (!face && !bitmap_font)
 	{
 		Log::Message(Log::LT_WARNING, "Font face has been released, unable to generate new handle.");
 		return nullptr;
 	}
 
+	if (GlyphCache::IsEnabled() && face && glyph_cache_key.empty())
+		glyph_cache_key = GlyphCache::GenerateFaceKey(face);
+
 	// Construct and initialise the new handle.
 	auto handle = std::make_unique<FontFaceHandleDefault>();
-	if (!handle->Initialize(face, size))
+	const bool initialized = (bitmap_font ? handle->Initialize(bitmap_font.get()) : handle->Initialize(face, size, glyph_cache_key));
+	if (!initialized)
 	{
 		handles[size] = nullptr;
 		return nullptr;
@@ -93,6 +125,21 @@ FontFaceHandleDefault* FontFace::GetHandle(int size) {
 	return result;
 }
 
+// Appends the information of all handles generated from this face.
+void FontFace::GetFontFaceStatistics(const String& family, Style::FontStyle style, Style::FontWeight weight, std::vector<FontFaceStatistics>& statistics)
+{
+	for (auto& pair : handles)
+	{
+		FontFaceStatistics handle_statistics;
+		handle_statistics.family = family;
+		handle_statistics.style = style;
+		handle_statistics.weight = weight;
+		handle_statistics.size = pair.first;
+		pair.second->GetStatistics(handle_statistics);
+
+		statistics.push_back(std::move(handle_statistics));
+	}
+}
 
 }
 }
@@ -35,37 +35,61 @@
 namespace Rml {
 namespace Core {
 
+class BitmapFont;
+class FileInterface;
 class FontFaceHandleDefault;
+struct FontFaceStatistics;
 
 /**
+	A loaded FreeType face or bitmap font, and the handles generated from it. Each face is loaded once, and may be
+	registered in several font families.
+
 	@author Peter Curry
  */
 
 class FontFace
 {
 public:
-	FontFace(FontFaceHandleFreetype face, Style::FontStyle style, Style::FontWeight weight, bool release_stream);
+	/// Who releases the memory the face was loaded from.
+	enum class DataOwner { Application, FontEngine, FileInterface };
+
+	/// @param[in] face The loaded FreeType face.
+	/// @param[in] data_owner Who releases the memory of the face when it is destroyed.
+	/// @param[in] file_interface The file interface the memory was mapped through, when owned by the file interface.
+	FontFace(FontFaceHandleFreetype face, DataOwner data_owner, FileInterface* file_interface = nullptr);
+	/// @param[in] bitmap_font The loaded bitmap font.
+	FontFace(UniquePtr<BitmapFont> bitmap_font);
 	~FontFace();
 
-	Style::FontStyle GetStyle() const;
-	Style::FontWeight GetWeight() const;
+	/// Returns the FreeType face, or zero for bitmap fonts.
+	FontFaceHandleFreetype GetFace() const;
+	/// Returns the bitmap font, or nullptr for FreeType faces.
+	const BitmapFont* GetBitmapFont() const;
 
 	/// Returns a handle for positioning and rendering this face at the given size.
-	/// @param[in] size The size of the desired handle, in points.
+	/// @param[in] size The size of the desired handle, in points. Bitmap fonts are only rendered at their own size.
 	/// @return The font handle.
 	FontFaceHandleDefault* GetHandle(int size);
 
+	/// Appends the information of all handles generated from this face.
+	/// @param[in] family The name of the family the face is registered in.
+	/// @param[in] style The style the face is registered as.
+	/// @param[in] weight The weight the face is registered as.
+	void GetFontFaceStatistics(const String& family, Style::FontStyle style, Style::FontWeight weight, std::vector<FontFaceStatistics>& statistics);
+
 private:
-	Style::FontStyle style;
-	Style::FontWeight weight;
+	DataOwner data_owner;
+	FileInterface* file_interface;
 
-	bool release_stream;
+	// Identifies the face data in the glyph cache, generated when the first handle is created with the cache enabled.
+	String glyph_cache_key;
 
 	// Key is font size
 	using HandleMap = UnorderedMap< int, UniquePtr<FontFaceHandleDefault> >;
 	HandleMap handles;
 
 	FontFaceHandleFreetype face;
+	UniquePtr<BitmapFont> bitmap_font;
 };
 
 }
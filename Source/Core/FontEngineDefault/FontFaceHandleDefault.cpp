@@ -27,40 +27,86 @@
  */
 
 #include "FontFaceHandleDefault.h"
+#include "../../../Include/RmlUi/Core/FontEngineInterface.h"
+#include "../../../Include/RmlUi/Core/Log.h"
+#include "../../../Include/RmlUi/Core/MemoryStatistics.h"
+#include "../../../Include/RmlUi/Core/RenderInterface.h"
 #include "../../../Include/RmlUi/Core/StringUtilities.h"
 #include "../TextureLayout.h"
 #include "FontProvider.h"
+#include "BitmapFont.h"
 #include "FontFaceLayer.h"
 #include "FreeTypeInterface.h"
+#include "GlyphCache.h"
+#include "GlyphRasterizer.h"
+#include "../ContextStatistics.h"
 #include <algorithm>
 
 namespace Rml {
 namespace Core {
 
+constexpr int FontFaceHandleDefault::NumAsciiCharacters;
+constexpr int FontFaceHandleDefault::KerningTableFirst;
+constexpr int FontFaceHandleDefault::KerningTableSize;
+constexpr short FontFaceHandleDefault::KerningUnknown;
+constexpr int FontFaceHandleDefault::ShapedRunGenerationSize;
+
+// Returns the memory used by a cached shaped run.
+static size_t GetShapedRunMemory(const String& segment, const ShapedRun& run)
+{
+	return sizeof(ShapedRun) + segment.size() + run.glyphs.capacity() * sizeof(ShapedGlyph);
+}
+
 FontFaceHandleDefault::FontFaceHandleDefault()
 {
 	base_layer = nullptr;
 	metrics = {};
 	ft_face = 0;
+	std::fill(ascii_advances, ascii_advances + NumAsciiCharacters, -1);
 }
 
 FontFaceHandleDefault::~FontFaceHandleDefault()
 {
+	Memory::TrackDeallocation(MemoryCategory::Fonts, glyph_memory, num_tracked_glyphs);
+	Memory::TrackDeallocation(MemoryCategory::Fonts, kerning_memory, 0);
+	Memory::TrackDeallocation(MemoryCategory::Fonts, shaped_run_memory, 0);
+
+	// The glyphs may point into the file being replaced, so they are stored before being cleared.
+	if (is_glyph_cache_dirty && !glyph_cache_key.empty())
+		GlyphCache::StoreGlyphs(glyph_cache_key, metrics.size, ft_face, glyphs, glyph_cache_file);
+
 	glyphs.clear();
 	layers.clear();
 }
 
-bool FontFaceHandleDefault::Initialize(FontFaceHandleFreetype face, int font_size)
+bool FontFaceHandleDefault::Initialize(FontFaceHandleFreetype face, int font_size, const String& _glyph_cache_key)
 {
 	ft_face = face;
+	glyph_cache_key = _glyph_cache_key;
 
 	RMLUI_ASSERTMSG(layer_configurations.empty(), "Initialize must only be called once.");
 
-	if (!FreeType::InitialiseFaceHandle(ft_face, font_size, glyphs, metrics))
+	// Glyphs from a previous run are used in place of rasterizing the initial glyphs again.
+	if (!glyph_cache_key.empty())
+	{
+		glyph_cache_file = GlyphCache::LoadGlyphs(glyph_cache_key, font_size, glyphs);
+		is_glyph_cache_dirty = !glyph_cache_file;
+	}
+
+	if (!FreeType::InitialiseFaceHandle(ft_face, font_size, !glyph_cache_file, glyphs, metrics))
 	{
 		return false;
 	}
 
+	has_kerning = FreeType::HasKerning(ft_face);
+
+	UpdateGlyphMemory();
+	UpdateAsciiAdvances();
+
+	auto it_replacement = glyphs.find(Character::Replacement);
+	if (it_replacement != glyphs.end())
+		placeholder_glyph.advance = it_replacement->second.advance;
+
 	// Generate the default layer and layer configuration.
 	base_layer = GetOrCreateLayer(nullptr);
 	layer_configurations.push_back(LayerConfiguration{ base_layer });
@@ -68,6 +114,28 @@ bool FontFaceHandleDefault::Initialize(FontFaceHandleFreetype face, int font_siz
 	return true;
 }
 
+bool FontFaceHandleDefault::Initialize(const BitmapFont* _bitmap_font)
+{
+	bitmap_font = _bitmap_font;
+
+	RMLUI_ASSERTMSG(layer_configurations.empty(), "Initialize must only be called once.");
+
+	metrics = bitmap_font->GetMetrics();
+	for (const auto& pair : bitmap_font->GetGlyphs())
+		glyphs.emplace(pair.first, pair.second.WeakCopy());
+
+	has_kerning = bitmap_font->HasKerning();
+
+	UpdateGlyphMemory();
+	UpdateAsciiAdvances();
+
+	// The base layer renders from the atlas of the bitmap font.
+	base_layer = GetOrCreateLayer(nullptr);
+	layer_configurations.push_back(LayerConfiguration{ base_layer });
+
+	return true;
+}
+
 // Returns the point size of this font face.
 int FontFaceHandleDefault::GetSize() const
 {
@@ -107,20 +175,31 @@ float FontFaceHandleDefault::GetUnderline(float& thickness) const
 // Returns the width a string will take up if rendered with this handle.
 int FontFaceHandleDefault::GetStringWidth(const String& string, Character prior_character)
 {
+	// Shaped text is measured from the same runs as it is generated from.
+	if (TextShaper* text_shaper = GetTextShaper())
+		return GatherShapedRuns(text_shaper, string, prior_character);
+
 	int width = 0;
 	for (auto it_string = StringIteratorU8(string); it_string; ++it_string)
 	{
 		Character character = *it_string;
 
-		const FontGlyph* glyph = GetOrAppendGlyph(character);
-		if (!glyph)
-			continue;
+		// Most characters are ASCII, measure them without looking up their glyph.
+		int advance = GetAsciiAdvance(character);
+		if (advance < 0)
+		{
+			const FontGlyph* glyph = GetOrAppendGlyph(character);
+			if (!glyph)
+				continue;
+
+			advance = glyph->advance;
+		}
 
 		// Adjust the cursor for the kerning between this character and the previous one.
 		if (prior_character != Character::Null)
 			width += GetKerning(prior_character, character);
 		// Adjust the cursor for this character's advance.
-		width += glyph->advance;
+		width += advance;
 
 		prior_character = character;
 	}
@@ -221,6 +300,11 @@ int FontFaceHandleDefault::GenerateString(GeometryList& geometry, const String&
 	RMLUI_ASSERT(layer_configuration_index >= 0);
 	RMLUI_ASSERT(layer_configuration_index < (int) layer_configurations.size());
 
+	// Shape the text before regenerating the layers, as any new glyphs are added while shaping.
+	TextShaper* text_shaper = GetTextShaper();
+	if (text_shaper)
+		GatherShapedRuns(text_shaper, string, Character::Null);
+
 	UpdateLayersOnDirty();
 
 	// Fetch the requested configuration and generate the geometry for each one.
@@ -260,6 +344,24 @@ int FontFaceHandleDefault::GenerateString(GeometryList& geometry, const String&
 		geometry[geometry_index].GetIndices().reserve(string.size() * 6);
 		geometry[geometry_index].GetVertices().reserve(string.size() * 4);
 
+		if (text_shaper)
+		{
+			for (const ShapedSegment& segment : shaped_segments)
+			{
+				line_width += segment.kerning;
+
+				for (const ShapedGlyph& glyph : segment.run->glyphs)
+				{
+					const Vector2f glyph_position(position.x + line_width + glyph.offset.x, position.y + glyph.offset.y);
+					layer->GenerateGeometry(&geometry[geometry_index], glyph.glyph, glyph_position, layer_colour);
+					line_width += glyph.advance;
+				}
+			}
+
+			geometry_index += num_textures;
+			continue;
+		}
+
 		for (auto it_string = StringIteratorU8(string); it_string; ++it_string)
 		{
 			Character character = *it_string;
@@ -316,19 +418,201 @@ int FontFaceHandleDefault::GetVersion() const
 	return version;
 }
 
+void FontFaceHandleDefault::UpdatePendingGlyphs()
+{
+	if (pending_glyphs.empty() && !has_arrived_glyphs)
+		return;
+
+	GlyphRasterizer::ProcessCompleted();
+
+	// Glyphs pending in fallback faces are copied once they arrive there.
+	for (auto it = pending_glyphs.begin(); it != pending_glyphs.end();)
+	{
+		const Character character = it->first;
+		FontFaceHandleDefault* source_handle = it->second;
+
+		if (source_handle == this || source_handle->pending_glyphs.find(character) != source_handle->pending_glyphs.end())
+		{
+			++it;
+			continue;
+		}
+
+		auto it_source = source_handle->glyphs.find(character);
+		if (it_source != source_handle->glyphs.end())
+		{
+			glyphs.emplace(character, it_source->second.WeakCopy());
+			UpdateGlyphMemory();
+		}
+		else
+		{
+			failed_glyphs.insert(character);
+		}
+
+		has_arrived_glyphs = true;
+		it = pending_glyphs.erase(it);
+	}
+
+	if (has_arrived_glyphs)
+	{
+		// Runs may have been measured with placeholders for glyphs missing from this face.
+		ReleaseShapedRuns(true);
+
+		has_arrived_glyphs = false;
+		is_layers_dirty = true;
+		UpdateLayersOnDirty();
+	}
+}
+
+bool FontFaceHandleDefault::HasPendingGlyphs() const
+{
+	return !pending_glyphs.empty();
+}
+
+void FontFaceHandleDefault::InsertRasterizedGlyph(Character character, FontGlyph&& glyph, bool success)
+{
+	pending_glyphs.erase(character);
+
+	if (success && glyphs.emplace(character, std::move(glyph)).second)
+	{
+		RMLUI_STATISTICS_COUNT(num_glyphs_rasterized, 1);
+		is_glyph_cache_dirty = true;
+		UpdateGlyphMemory();
+		UpdateAsciiAdvances();
+	}
+	else
+	{
+		failed_glyphs.insert(character);
+	}
+
+	// Handles copying this glyph from us as a fallback face pick it up on their next update.
+	has_arrived_glyphs = true;
+}
+
+void FontFaceHandleDefault::GetStatistics(FontFaceStatistics& statistics)
+{
+	statistics.num_glyphs = (int)glyphs.size();
+	statistics.num_layers = (int)layers.size();
+
+	for (auto& pair : layers)
+		pair.layer->GetTextureUsage(statistics.num_textures, statistics.texture_area, statistics.used_texture_area);
+}
+
+void FontFaceHandleDefault::Prewarm(const String& characters, int layer_configuration_index, RenderInterface* render_interface)
+{
+	RMLUI_ASSERT(layer_configuration_index >= 0);
+	RMLUI_ASSERT(layer_configuration_index < (int)layer_configurations.size());
+
+	for (auto it_string = StringIteratorU8(characters); it_string; ++it_string)
+	{
+		Character character = *it_string;
+		GetOrAppendGlyph(character, true, false);
+	}
+
+	UpdateLayersOnDirty();
+
+	if (!render_interface)
+		return;
+
+	// Textures are otherwise generated when first rendered.
+	for (FontFaceLayer* layer : layer_configurations[layer_configuration_index])
+	{
+		for (int i = 0; i < layer->GetNumTextures(); i++)
+			layer->GetTexture(i)->GetHandle(render_interface);
+	}
+}
+
 bool FontFaceHandleDefault::AppendGlyph(Character character)
 {
+	// Bitmap fonts only have the glyphs in their atlas.
+	if (bitmap_font)
+		return false;
+
 	bool result = FreeType::AppendGlyph(ft_face, metrics.size, character, glyphs);
+	if (result)
+	{
+		is_glyph_cache_dirty = true;
+		UpdateGlyphMemory();
+		UpdateAsciiAdvances();
+	}
 	return result;
 }
 
-int FontFaceHandleDefault::GetKerning(Character lhs, Character rhs) const
+int FontFaceHandleDefault::GetKerning(Character lhs, Character rhs)
 {
-	int result = FreeType::GetKerning(ft_face, metrics.size, lhs, rhs);
-	return result;
+	if (!has_kerning)
+		return 0;
+
+	const char32_t lhs_code = (char32_t)lhs;
+	const char32_t rhs_code = (char32_t)rhs;
+
+	// Pairs of printable ASCII characters are looked up in the dense table.
+	if (lhs_code >= KerningTableFirst && lhs_code < NumAsciiCharacters && rhs_code >= KerningTableFirst && rhs_code < NumAsciiCharacters)
+	{
+		if (!kerning_table)
+		{
+			const int num_entries = KerningTableSize * KerningTableSize;
+			kerning_table.reset(new short[num_entries]);
+			std::fill(kerning_table.get(), kerning_table.get() + num_entries, KerningUnknown);
+
+			kerning_memory += num_entries * sizeof(short);
+			Memory::TrackAllocation(MemoryCategory::Fonts, num_entries * sizeof(short), 0);
+		}
+
+		short& kerning = kerning_table[(lhs_code - KerningTableFirst) * KerningTableSize + (rhs_code - KerningTableFirst)];
+		if (kerning == KerningUnknown)
+			kerning = (short)LookupKerning(lhs, rhs);
+
+		return kerning;
+	}
+
+	// All other pairs are looked up in the map.
+	const std::uint64_t key = ((std::uint64_t)lhs_code << 32) | (std::uint64_t)rhs_code;
+
+	auto it = kerning_map.find(key);
+	if (it != kerning_map.end())
+		return it->second;
+
+	const int kerning = LookupKerning(lhs, rhs);
+	kerning_map.emplace(key, kerning);
+
+	kerning_memory += sizeof(KerningMap::value_type);
+	Memory::TrackAllocation(MemoryCategory::Fonts, sizeof(KerningMap::value_type), 0);
+
+	return kerning;
+}
+
+int FontFaceHandleDefault::LookupKerning(Character lhs, Character rhs) const
+{
+	if (bitmap_font)
+		return bitmap_font->GetKerning(lhs, rhs);
+
+	return FreeType::GetKerning(ft_face, metrics.size, lhs, rhs);
+}
+
+int FontFaceHandleDefault::GetAsciiAdvance(Character character) const
+{
+	const char32_t code = (char32_t)character;
+	if (code >= NumAsciiCharacters)
+		return -1;
+
+	return ascii_advances[code];
 }
 
-const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, bool look_in_fallback_fonts)
+void FontFaceHandleDefault::UpdateAsciiAdvances()
+{
+	// Control characters are never rendered, leave them without an advance.
+	for (int i = ' '; i < NumAsciiCharacters; i++)
+	{
+		if (ascii_advances[i] >= 0)
+			continue;
+
+		auto it = glyphs.find((Character)i);
+		if (it != glyphs.end())
+			ascii_advances[i] = it->second.advance;
+	}
+}
+
+const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, bool look_in_fallback_fonts, bool allow_background)
 {
 	// Don't try to render control characters
 	if ((char32_t)character < (char32_t)' ')
@@ -337,6 +621,13 @@ const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, b
 	auto it_glyph = glyphs.find(character);
 	if (it_glyph == glyphs.end())
 	{
+		// When rasterizing in the background, the placeholder is used until the glyph arrives.
+		if (allow_background && !bitmap_font && GlyphRasterizer::IsEnabled())
+		{
+			if (const FontGlyph* placeholder = QueueGlyph(character, look_in_fallback_fonts))
+				return placeholder;
+		}
+
 		bool result = AppendGlyph(character);
 
 		if (result)
@@ -352,21 +643,26 @@ const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, b
 		}
 		else if (look_in_fallback_fonts)
 		{
-			const int num_fallback_faces = FontProvider::CountFallbackFontFaces();
+			// Bitmap fonts render only from their atlas, so glyphs from the fallback faces cannot be mixed in.
+			const int num_fallback_faces = (bitmap_font ? 0 : FontProvider::CountFallbackFontFaces());
 			for (int i = 0; i < num_fallback_faces; i++)
 			{
 				FontFaceHandleDefault* fallback_face = FontProvider::GetFallbackFontFace(i, metrics.size);
 				if (!fallback_face || fallback_face == this)
 					continue;
 
-				const FontGlyph* glyph = fallback_face->GetOrAppendGlyph(character, false);
+				const FontGlyph* glyph = fallback_face->GetOrAppendGlyph(character, false, allow_background);
 				if (glyph)
 				{
 					// Insert the new glyph into our own set of glyphs
 					auto pair = glyphs.emplace(character, glyph->WeakCopy());
 					it_glyph = pair.first;
 					if(pair.second)
+					{
 						is_layers_dirty = true;
+						UpdateGlyphMemory();
+						UpdateAsciiAdvances();
+					}
 					break;
 				}
 			}
@@ -390,6 +686,202 @@ const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, b
 	return glyph;
 }
 
+const FontGlyph* FontFaceHandleDefault::QueueGlyph(Character character, bool look_in_fallback_fonts)
+{
+	if (pending_glyphs.find(character) != pending_glyphs.end())
+		return &placeholder_glyph;
+
+	if (failed_glyphs.find(character) != failed_glyphs.end())
+		return nullptr;
+
+	if (FreeType::HasGlyph(ft_face, character))
+	{
+		pending_glyphs.emplace(character, this);
+		GlyphRasterizer::Enqueue(this, ft_face, metrics.size, character);
+		return &placeholder_glyph;
+	}
+
+	if (look_in_fallback_fonts)
+	{
+		// Search the fallback faces in the same order as when building glyphs immediately.
+		const int num_fallback_faces = FontProvider::CountFallbackFontFaces();
+		for (int i = 0; i < num_fallback_faces; i++)
+		{
+			FontFaceHandleDefault* fallback_face = FontProvider::GetFallbackFontFace(i, metrics.size);
+			if (!fallback_face || fallback_face == this)
+				continue;
+
+			// Glyphs already built in the fallback face are copied immediately.
+			if (fallback_face->glyphs.find(character) != fallback_face->glyphs.end())
+				return nullptr;
+
+			if (FreeType::HasGlyph(fallback_face->ft_face, character))
+			{
+				if (!fallback_face->QueueGlyph(character, false))
+					return nullptr;
+
+				pending_glyphs.emplace(character, fallback_face);
+				return &placeholder_glyph;
+			}
+		}
+	}
+
+	return nullptr;
+}
+
+TextShaper* FontFaceHandleDefault::GetTextShaper() const
+{
+	// Shapers work on the FreeType face, bitmap fonts are laid out from their own advances and kerning pairs.
+	if (bitmap_font)
+		return nullptr;
+
+	return TextShaper::Get();
+}
+
+int FontFaceHandleDefault::GatherShapedRuns(TextShaper* text_shaper, const String& string, Character prior_character)
+{
+	if ((int)shaped_runs.size() >= ShapedRunGenerationSize)
+		ReleaseShapedRuns(false);
+
+	shaped_segments.clear();
+
+	int width = 0;
+	size_t segment_begin = 0;
+
+	while (segment_begin < string.size())
+	{
+		// Segments end after each space, so that the same words are shaped once wherever they appear.
+		size_t segment_end = string.find(' ', segment_begin);
+		segment_end = (segment_end == String::npos ? string.size() : segment_end + 1);
+
+		segment_buffer.assign(string, segment_begin, segment_end - segment_begin);
+		const ShapedRun* run = GetShapedRun(text_shaper, segment_buffer);
+
+		// Adjacent segments are kerned against each other as unshaped text.
+		int kerning = 0;
+		if (prior_character != Character::Null && run->first_character != Character::Null)
+			kerning = GetKerning(prior_character, run->first_character);
+
+		shaped_segments.push_back(ShapedSegment{ run, kerning });
+		width += kerning + run->width;
+
+		if (run->last_character != Character::Null)
+			prior_character = run->last_character;
+
+		segment_begin = segment_end;
+	}
+
+	return width;
+}
+
+const ShapedRun* FontFaceHandleDefault::GetShapedRun(TextShaper* text_shaper, const String& segment)
+{
+	auto it = shaped_runs.find(segment);
+	if (it != shaped_runs.end())
+		return it->second.get();
+
+	// Runs used again are moved to the current generation.
+	auto it_previous = previous_shaped_runs.find(segment);
+	if (it_previous != previous_shaped_runs.end())
+	{
+		const ShapedRun* run = it_previous->second.get();
+		shaped_runs.emplace(segment, std::move(it_previous->second));
+		previous_shaped_runs.erase(it_previous);
+		return run;
+	}
+
+	auto run = std::make_unique<ShapedRun>();
+
+	if (text_shaper->Shape(ft_face, metrics.size, segment, *run))
+	{
+		RMLUI_STATISTICS_COUNT(num_text_runs_shaped, 1);
+
+		for (ShapedGlyph& glyph : run->glyphs)
+		{
+			// Glyphs missing from this face are taken from the fallback faces, with their own advance.
+			if (glyph.missing)
+			{
+				const FontGlyph* font_glyph = GetOrAppendGlyph(glyph.glyph);
+				glyph.advance = (font_glyph ? font_glyph->advance : 0);
+				if (!font_glyph)
+					glyph.glyph = Character::Null;
+			}
+			else
+			{
+				Character character = glyph.glyph;
+				GetOrAppendGlyph(character, false);
+			}
+		}
+	}
+	else
+	{
+		// Lay out the segment one code point per glyph instead, as without a shaper.
+		run->glyphs.clear();
+
+		Character prior_character = Character::Null;
+		for (auto it_string = StringIteratorU8(segment); it_string; ++it_string)
+		{
+			Character character = *it_string;
+
+			const FontGlyph* font_glyph = GetOrAppendGlyph(character);
+			if (!font_glyph)
+				continue;
+
+			if (prior_character != Character::Null)
+				run->glyphs.back().advance += GetKerning(prior_character, character);
+
+			ShapedGlyph glyph;
+			glyph.glyph = character;
+			glyph.advance = font_glyph->advance;
+			run->glyphs.push_back(glyph);
+
+			prior_character = character;
+		}
+	}
+
+	for (const ShapedGlyph& glyph : run->glyphs)
+		run->width += glyph.advance;
+
+	auto it_string = StringIteratorU8(segment);
+	if (it_string)
+	{
+		run->first_character = *it_string;
+		run->last_character = StringUtilities::ToCharacter(StringUtilities::SeekBackwardUTF8(&segment.back(), segment.data()));
+	}
+
+	const size_t run_memory = GetShapedRunMemory(segment, *run);
+	shaped_run_memory += run_memory;
+	Memory::TrackAllocation(MemoryCategory::Fonts, run_memory, 0);
+
+	const ShapedRun* result = run.get();
+	shaped_runs.emplace(segment, std::move(run));
+
+	return result;
+}
+
+void FontFaceHandleDefault::ReleaseShapedRuns(bool release_all)
+{
+	if (release_all)
+	{
+		Memory::TrackDeallocation(MemoryCategory::Fonts, shaped_run_memory, 0);
+		shaped_run_memory = 0;
+
+		shaped_runs.clear();
+		previous_shaped_runs.clear();
+		return;
+	}
+
+	size_t released_memory = 0;
+	for (const auto& pair : previous_shaped_runs)
+		released_memory += GetShapedRunMemory(pair.first, *pair.second);
+
+	Memory::TrackDeallocation(MemoryCategory::Fonts, released_memory, 0);
+	shaped_run_memory -= released_memory;
+
+	previous_shaped_runs = std::move(shaped_runs);
+	shaped_runs.clear();
+}
+
 // Generates (or shares) a layer derived from a font effect.
 FontFaceLayer* FontFaceHandleDefault::GetOrCreateLayer(const SharedPtr<const FontEffect>& font_effect)
 {
@@ -418,7 +910,16 @@ bool FontFaceHandleDefault::GenerateLayer(FontFaceLayer* layer)
 
 	if (!font_effect)
 	{
-		result = layer->Generate(this);
+		if (bitmap_font)
+			result = layer->GenerateFromAtlas(this, *bitmap_font);
+		else
+			result = layer->Generate(this);
+	}
+	else if (bitmap_font)
+	{
+		// Font effects generate their textures from the glyph bitmaps, which bitmap fonts do not have. The layer is
+		// left without any textures, so nothing is rendered for it.
+		Log::Message(Log::LT_WARNING, "Font effects are not supported on bitmap fonts, ignoring effect on font face of size %d.", metrics.size);
 	}
 	else
 	{
@@ -440,6 +941,10 @@ bool FontFaceHandleDefault::GenerateLayer(FontFaceLayer* layer)
 				clone = cache_iterator->second;
 		}
 
+		// Layers generating their own textures reuse the images generated by their effect in previous runs.
+		if (!clone && !glyph_cache_key.empty())
+			layer->EnableImageCache(glyph_cache_key, metrics.size);
+
 		// Create a new layer.
 		result = layer->Generate(this, clone, clone_glyph_origins);
 
@@ -451,5 +956,22 @@ bool FontFaceHandleDefault::GenerateLayer(FontFaceLayer* layer)
 	return result;
 }
 
+void FontFaceHandleDefault::UpdateGlyphMemory()
+{
+	// Weak copies of glyphs from fallback fonts don't own their bitmaps, only count the bitmaps owned by this handle.
+	size_t new_glyph_memory = glyphs.size() * sizeof(FontGlyphMap::value_type);
+	for (const auto& pair : glyphs)
+	{
+		if (pair.second.bitmap_owned_data)
+			new_glyph_memory += size_t(pair.second.bitmap_dimensions.x) * size_t(pair.second.bitmap_dimensions.y);
+	}
+
+	Memory::TrackDeallocation(MemoryCategory::Fonts, glyph_memory, num_tracked_glyphs);
+	Memory::TrackAllocation(MemoryCategory::Fonts, new_glyph_memory, (int)glyphs.size());
+
+	glyph_memory = new_glyph_memory;
+	num_tracked_glyphs = (int)glyphs.size();
+}
+
 }
 }
@@ -35,11 +35,17 @@
 #include "../../../Include/RmlUi/Core/Geometry.h"
 #include "../../../Include/RmlUi/Core/Texture.h"
 #include "FontTypes.h"
+#include "TextShaper.h"
+#include <cstdint>
 
 namespace Rml {
 namespace Core {
 
+class BitmapFont;
 class FontFaceLayer;
+class GlyphCacheFile;
+class RenderInterface;
+struct FontFaceStatistics;
 
 
 /**
@@ -52,7 +58,13 @@ public:
 	FontFaceHandleDefault();
 	~FontFaceHandleDefault();
 
-	bool Initialize(FontFaceHandleFreetype face, int font_size);
+	/// @param[in] face The font face to render.
+	/// @param[in] font_size The size of the handle, in points.
+	/// @param[in] glyph_cache_key The key of the face in the glyph cache, or empty if the cache is disabled.
+	bool Initialize(FontFaceHandleFreetype face, int font_size, const String& glyph_cache_key);
+	/// Initializes the handle to render a bitmap font from its atlas, without rasterizing glyphs or using fallback faces.
+	/// @param[in] bitmap_font The bitmap font to render, owned by the font face.
+	bool Initialize(const BitmapFont* bitmap_font);
 
 	/// Returns the point size of this font face.
 	int GetSize() const;
@@ -99,18 +111,61 @@ public:
 	/// Version is changed whenever the layers are dirtied, requiring regeneration of string geometry.
 	int GetVersion() const;
 
+	/// Takes in any glyphs rasterized in the background since the last call, changing the version if any arrived.
+	void UpdatePendingGlyphs();
+	/// Returns true while any glyphs requested from this handle are still being rasterized in the background.
+	bool HasPendingGlyphs() const;
+	/// Hands back a glyph queued for rasterization in the background by this handle.
+	/// @param[in] character The code point of the glyph.
+	/// @param[in] glyph The rasterized glyph.
+	/// @param[in] success False if the glyph could not be rasterized, it is then built immediately on next use.
+	void InsertRasterizedGlyph(Character character, FontGlyph&& glyph, bool success);
+
+	/// Fills in the glyph, layer and texture information of the handle.
+	void GetStatistics(FontFaceStatistics& statistics);
+
+	/// Rasterizes the given characters immediately, and generates the textures of a layer configuration.
+	/// @param[in] characters The characters to rasterize, in UTF-8.
+	/// @param[in] layer_configuration The index of the layer configuration to generate the textures of.
+	/// @param[in] render_interface The render interface to generate the textures with, or nullptr to skip generating them.
+	void Prewarm(const String& characters, int layer_configuration, RenderInterface* render_interface);
+
 
 private:
 	// Build and append glyph to 'glyphs'
 	bool AppendGlyph(Character character);
 
-	int GetKerning(Character lhs, Character rhs) const;
+	// Returns the kerning between two characters, only looked up in the face the first time each pair is encountered.
+	int GetKerning(Character lhs, Character rhs);
+	// Looks up the kerning between two characters in the FreeType face or bitmap font.
+	int LookupKerning(Character lhs, Character rhs) const;
+
+	// Returns the advance of a glyph in the ASCII range, or -1 if it has no glyph yet.
+	int GetAsciiAdvance(Character character) const;
+	// Fills in the ASCII advances from the generated glyphs.
+	void UpdateAsciiAdvances();
 
 	/// Retrieve a glyph from the given code point, building and appending a new glyph if not already built.
 	/// @param[in-out] character  The character, can be changed e.g. to the replacement character if no glyph is found.
 	/// @param[in] look_in_fallback_fonts  Look for the glyph in fallback fonts if not found locally, adding it to our glyphs.
+	/// @param[in] allow_background  Queue the glyph for rasterization in the background if enabled, otherwise build it immediately.
 	/// @return The font glyph for the returned code point.
-	const FontGlyph* GetOrAppendGlyph(Character& character, bool look_in_fallback_fonts = true);
+	const FontGlyph* GetOrAppendGlyph(Character& character, bool look_in_fallback_fonts = true, bool allow_background = true);
+
+	// Queues a glyph for rasterization in the background, either in this face or the fallback face containing it.
+	// Returns the placeholder glyph while it is pending, or nullptr if the glyph must be built immediately instead.
+	const FontGlyph* QueueGlyph(Character character, bool look_in_fallback_fonts);
+
+	// Returns the text shaper to shape text with, or nullptr if the text is laid out one code point per glyph.
+	TextShaper* GetTextShaper() const;
+
+	// Splits a string into segments after each space, and collects the shaped run of each segment into the list of shaped
+	// segments. Returns the width of the string.
+	int GatherShapedRuns(TextShaper* text_shaper, const String& string, Character prior_character);
+	// Returns the shaped run of a segment of text, shaping it if not already cached.
+	const ShapedRun* GetShapedRun(TextShaper* text_shaper, const String& segment);
+	// Releases the previous generation of shaped runs, or all of them.
+	void ReleaseShapedRuns(bool release_all);
 
 	// Regenerate layers if dirty, such as after adding new glyphs.
 	bool UpdateLayersOnDirty();
@@ -121,8 +176,50 @@ private:
 	// (Re-)generate a layer in this font face handle.
 	bool GenerateLayer(FontFaceLayer* layer);
 
+	// Accounts any change in the memory used by the glyphs since the last call.
+	void UpdateGlyphMemory();
+
 	FontGlyphMap glyphs;
 
+	// The advances of the glyphs for the ASCII characters, or -1 for characters without a glyph yet.
+	static constexpr int NumAsciiCharacters = 128;
+	int ascii_advances[NumAsciiCharacters];
+
+	// Kerning lookups are cached, in a table for pairs of printable ASCII characters allocated on first use, and in a
+	// map for all other pairs. Faces without kerning information never look up any kerning.
+	static constexpr int KerningTableFirst = 32;
+	static constexpr int KerningTableSize = NumAsciiCharacters - KerningTableFirst;
+	static constexpr short KerningUnknown = -32768;
+	using KerningMap = UnorderedMap< std::uint64_t, int >;
+
+	bool has_kerning = false;
+	UniquePtr< short[] > kerning_table;
+	KerningMap kerning_map;
+
+	// Glyphs being rasterized in the background, mapped to the handle rasterizing them which may be a fallback face.
+	UnorderedMap< Character, FontFaceHandleDefault* > pending_glyphs;
+	// Glyphs which could not be rasterized in the background, they are built immediately instead to report any errors.
+	UnorderedSet< Character > failed_glyphs;
+	// Used to measure pending glyphs, it has the advance of the replacement character and renders nothing.
+	FontGlyph placeholder_glyph;
+	bool has_arrived_glyphs = false;
+
+	// Runs of text shaped by the text shaper, keyed by their segment of text. Runs are cached in two generations, used
+	// runs are moved to the current generation, and the previous generation is released once the current one is full.
+	// Runs are only released before gathering new segments, so the gathered runs stay valid until the next gathering.
+	static constexpr int ShapedRunGenerationSize = 1024;
+	using ShapedRunMap = UnorderedMap< String, UniquePtr<ShapedRun> >;
+	struct ShapedSegment {
+		const ShapedRun* run;
+		int kerning;
+	};
+
+	ShapedRunMap shaped_runs;
+	ShapedRunMap previous_shaped_runs;
+	std::vector< ShapedSegment > shaped_segments;
+	String segment_buffer;
+	size_t shaped_run_memory = 0;
+
 	struct EffectLayerPair {
 		const FontEffect* font_effect;
 		UniquePtr<FontFaceLayer> layer; 
@@ -147,6 +244,19 @@ private:
 	FontMetrics metrics;
 
 	FontFaceHandleFreetype ft_face;
+	const BitmapFont* bitmap_font = nullptr;
+
+	// The key of the face in the glyph cache, the file our cached glyph bitmaps point into, and whether any glyphs were
+	// rasterized since it was loaded.
+	String glyph_cache_key;
+	UniquePtr<GlyphCacheFile> glyph_cache_file;
+	bool is_glyph_cache_dirty = false;
+
+	// The memory and number of glyphs currently accounted to the font category.
+	size_t glyph_memory = 0;
+	int num_tracked_glyphs = 0;
+	// The memory of the kerning caches accounted to the font category.
+	size_t kerning_memory = 0;
 };
 
 }
@@ -27,7 +27,10 @@
  */
 
 #include "FontFaceLayer.h"
+#include "BitmapFont.h"
 #include "FontFaceHandleDefault.h"
+#include "../../../Include/RmlUi/Core/MemoryStatistics.h"
+#include <string.h>
 
 namespace Rml {
 namespace Core {
@@ -40,7 +43,12 @@ FontFaceLayer::FontFaceLayer(const SharedPtr<const FontEffect>& _effect) : colou
 }
 
 FontFaceLayer::~FontFaceLayer()
-{}
+{
+	if (is_image_cache_dirty)
+		GlyphCache::StoreImages(image_cache_key, image_cache_size, effect->GetFingerprint(), cached_images, image_cache_file);
+
+	Memory::TrackDeallocation(MemoryCategory::Fonts, image_cache_memory, 0);
+}
 
 bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFaceLayer* clone, bool clone_glyph_origins)
 {
@@ -169,7 +177,7 @@ bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFace
 			};
 
 			Texture texture;
-			texture.Set("font-face-layer", texture_callback);
+			texture.Set("font-face-layer", texture_callback, MemoryCategory::FontTextures);
 			textures.push_back(texture);
 		}
 	}
@@ -177,6 +185,39 @@ bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFace
 	return true;
 }
 
+bool FontFaceLayer::GenerateFromAtlas(const FontFaceHandleDefault* handle, const BitmapFont& bitmap_font)
+{
+	RMLUI_ASSERT(!effect);
+
+	texture_layout = TextureLayout{};
+	character_boxes.clear();
+	textures = bitmap_font.GetPages();
+
+	const FontGlyphMap& glyphs = handle->GetGlyphs();
+	character_boxes.reserve(glyphs.size());
+
+	for (auto& pair : glyphs)
+	{
+		const FontGlyph& glyph = pair.second;
+		const BitmapFont::AtlasBox* atlas_box = bitmap_font.GetAtlasBox(pair.first);
+
+		// Glyphs without any area, such as spaces, only advance the cursor.
+		if (!atlas_box || glyph.dimensions.x <= 0 || glyph.dimensions.y <= 0)
+			continue;
+
+		TextureBox box;
+		box.origin = Vector2f(float(glyph.bearing.x), float(-glyph.bearing.y));
+		box.dimensions = Vector2f(float(glyph.dimensions.x), float(glyph.dimensions.y));
+		box.texcoords[0] = atlas_box->texcoords[0];
+		box.texcoords[1] = atlas_box->texcoords[1];
+		box.texture_index = atlas_box->page;
+
+		character_boxes[pair.first] = box;
+	}
+
+	return true;
+}
+
 // Generates the texture data for a layer (for the texture database).
 bool FontFaceLayer::GenerateTexture(UniquePtr<const byte[]>& texture_data, Vector2i& texture_dimensions, int texture_id, const FontGlyphMap& glyphs)
 {
@@ -225,13 +266,77 @@ bool FontFaceLayer::GenerateTexture(UniquePtr<const byte[]>& texture_data, Vecto
 		}
 		else
 		{
-			effect->GenerateGlyphTexture(rectangle.GetTextureData(), Vector2i(Math::RealToInteger(box.dimensions.x), Math::RealToInteger(box.dimensions.y)), rectangle.GetTextureStride(), glyph);
+			const Vector2i dimensions(Math::RealToInteger(box.dimensions.x), Math::RealToInteger(box.dimensions.y));
+			const size_t row_size = size_t(dimensions.x) * 4;
+
+			if (!image_cache_key.empty())
+			{
+				// Copy the image from the cache if the effect already generated this glyph, skipping the effect.
+				auto it_image = cached_images.find(character);
+				if (it_image != cached_images.end() && it_image->second.dimensions == dimensions)
+				{
+					byte* destination = rectangle.GetTextureData();
+					const byte* source = it_image->second.data;
+
+					for (int j = 0; j < dimensions.y; ++j)
+					{
+						memcpy(destination, source, row_size);
+						destination += rectangle.GetTextureStride();
+						source += row_size;
+					}
+
+					continue;
+				}
+			}
+
+			effect->GenerateGlyphTexture(rectangle.GetTextureData(), dimensions, rectangle.GetTextureStride(), glyph);
+
+			if (!image_cache_key.empty())
+			{
+				GlyphImage& image = cached_images[character];
+				if (image.owned_data)
+				{
+					const size_t previous_size = size_t(image.dimensions.x) * size_t(image.dimensions.y) * 4;
+					image_cache_memory -= previous_size;
+					Memory::TrackDeallocation(MemoryCategory::Fonts, previous_size, 0);
+				}
+
+				image.dimensions = dimensions;
+				image.owned_data.reset(new byte[row_size * size_t(dimensions.y)]);
+				image.data = image.owned_data.get();
+
+				const byte* source = rectangle.GetTextureData();
+				byte* destination = image.owned_data.get();
+
+				for (int j = 0; j < dimensions.y; ++j)
+				{
+					memcpy(destination, source, row_size);
+					source += rectangle.GetTextureStride();
+					destination += row_size;
+				}
+
+				image_cache_memory += row_size * size_t(dimensions.y);
+				Memory::TrackAllocation(MemoryCategory::Fonts, row_size * size_t(dimensions.y), 0);
+				is_image_cache_dirty = true;
+			}
 		}
 	}
 
 	return true;
 }
 
+// Loads the glyph images of the layer's effect from the glyph cache.
+void FontFaceLayer::EnableImageCache(const String& face_key, int font_size)
+{
+	RMLUI_ASSERT(effect);
+	if (!image_cache_key.empty())
+		return;
+
+	image_cache_key = face_key;
+	image_cache_size = font_size;
+	image_cache_file = GlyphCache::LoadImages(image_cache_key, image_cache_size, effect->GetFingerprint(), cached_images);
+}
+
 // Returns the effect used to generate the layer.
 const FontEffect* FontFaceLayer::GetFontEffect() const
 {
@@ -253,6 +358,25 @@ int FontFaceLayer::GetNumTextures() const
 	return (int)textures.size();
 }
 
+// Adds the number of textures generated by this layer, and their usage.
+void FontFaceLayer::GetTextureUsage(int& num_textures, int& texture_area, int& used_texture_area)
+{
+	num_textures += texture_layout.GetNumTextures();
+
+	for (int i = 0; i < texture_layout.GetNumTextures(); ++i)
+	{
+		const Vector2i dimensions = texture_layout.GetTexture(i).GetDimensions();
+		texture_area += dimensions.x * dimensions.y;
+	}
+
+	for (int i = 0; i < texture_layout.GetNumRectangles(); ++i)
+	{
+		TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
+		if (rectangle.GetTextureIndex() >= 0)
+			used_texture_area += rectangle.GetDimensions().x * rectangle.GetDimensions().y;
+	}
+}
+
 // Returns the layer's colour.
 const Colourb& FontFaceLayer::GetColour() const
 {
@@ -34,10 +34,12 @@
 #include "../../../Include/RmlUi/Core/GeometryUtilities.h"
 #include "../../../Include/RmlUi/Core/Texture.h"
 #include "../TextureLayout.h"
+#include "GlyphCache.h"
 
 namespace Rml {
 namespace Core {
 
+class BitmapFont;
 class FontEffect;
 class FontFaceHandleDefault;
 
@@ -61,6 +63,12 @@ public:
 	/// @return True if the layer was generated successfully, false if not.
 	bool Generate(const FontFaceHandleDefault* handle, const FontFaceLayer* clone = nullptr, bool clone_glyph_origins = false);
 
+	/// Generates the character data for the base layer of a bitmap font, which renders from the font's atlas textures.
+	/// @param[in] handle The handle generating this layer.
+	/// @param[in] bitmap_font The bitmap font providing the atlas.
+	/// @return True if the layer was generated successfully, false if not.
+	bool GenerateFromAtlas(const FontFaceHandleDefault* handle, const BitmapFont& bitmap_font);
+
 	/// Generates the texture data for a layer (for the texture database).
 	/// @param[out] texture_data The pointer to be set to the generated texture data.
 	/// @param[out] texture_dimensions The dimensions of the texture.
@@ -68,6 +76,12 @@ public:
 	/// @param[in] glyphs The glyphs required by the font face handle.
 	bool GenerateTexture(UniquePtr<const byte[]>& texture_data, Vector2i& texture_dimensions, int texture_id, const FontGlyphMap& glyphs);
 
+	/// Loads the glyph images generated by the layer's font effect in previous runs from the glyph cache, and stores
+	/// them there again when the layer is destroyed if any were added. Only for layers with their own textures.
+	/// @param[in] face_key The key of the font face in the glyph cache.
+	/// @param[in] font_size The size of the handle generating this layer.
+	void EnableImageCache(const String& face_key, int font_size);
+
 	/// Generates the geometry required to render a single character.
 	/// @param[out] geometry An array of geometries this layer will write to. It must be at least as big as the number of textures in this layer.
 	/// @param[in] character_code The character to generate geometry for.
@@ -110,6 +124,10 @@ public:
 	/// Returns the number of textures employed by this layer.
 	int GetNumTextures() const;
 
+	/// Adds the number of textures generated by this layer, their area, and the area occupied by glyphs. Textures
+	/// cloned from another layer are not included.
+	void GetTextureUsage(int& num_textures, int& texture_area, int& used_texture_area);
+
 	/// Returns the layer's colour.
 	const Colourb& GetColour() const;
 
@@ -141,6 +159,15 @@ private:
 	CharacterMap character_boxes;
 	TextureList textures;
 	Colourb colour;
+
+	// Glyph images generated by the effect, when the glyph cache is enabled. Loaded images point into the cache file.
+	String image_cache_key;
+	int image_cache_size = 0;
+	GlyphImageMap cached_images;
+	UniquePtr<GlyphCacheFile> image_cache_file;
+	bool is_image_cache_dirty = false;
+	// The memory of the images generated since the cache file was loaded, accounted to the font category.
+	size_t image_cache_memory = 0;
 };
 
 }
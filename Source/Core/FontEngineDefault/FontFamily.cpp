@@ -45,11 +45,11 @@ FontFaceHandleDefault* FontFamily::GetFaceHandle(Style::FontStyle style, Style::
 	{
 		// If we've found a face matching the style, then ... great! We'll match it regardless of the weight. However,
 		// if it's a perfect match, then we'll stop looking altogether.
-		if (font_faces[i]->GetStyle() == style)
+		if (font_faces[i].style == style)
 		{
-			matching_face = font_faces[i].get();
+			matching_face = font_faces[i].face;
 
-			if (font_faces[i]->GetWeight() == weight)
+			if (font_faces[i].weight == weight)
 				break;
 		}
 	}
@@ -61,15 +61,26 @@ FontFaceHandleDefault* FontFamily::GetFaceHandle(Style::FontStyle style, Style::
 }
 
 
-// Adds a new face to the family.
-FontFace* FontFamily::AddFace(FontFaceHandleFreetype ft_face, Style::FontStyle style, Style::FontWeight weight, bool release_stream)
+// Adds a face to the family.
+void FontFamily::AddFace(FontFace* face, Style::FontStyle style, Style::FontWeight weight)
 {
-	auto face = std::make_unique<FontFace>(ft_face, style, weight, release_stream);
-	FontFace* result = face.get();
+	for (const FaceEntry& entry : font_faces)
+	{
+		if (entry.face == face && entry.style == style && entry.weight == weight)
+			return;
+	}
 
-	font_faces.push_back(std::move(face));
+	font_faces.push_back(FaceEntry{ face, style, weight });
+}
 
-	return result;
+// Appends the information of the handles of all faces in the family.
+void FontFamily::GetFontFaceStatistics(std::vector<FontFaceStatistics>& statistics, SmallUnorderedSet<const FontFace*>& visited_faces)
+{
+	for (const FaceEntry& entry : font_faces)
+	{
+		if (visited_faces.insert(entry.face).second)
+			entry.face->GetFontFaceStatistics(name, entry.style, entry.weight, statistics);
+	}
 }
 
 }
@@ -36,6 +36,7 @@ namespace Core {
 
 class FontFace;
 class FontFaceHandleDefault;
+struct FontFaceStatistics;
 
 /**
 	@author Peter Curry
@@ -54,18 +55,28 @@ public:
 	FontFaceHandleDefault* GetFaceHandle(Style::FontStyle style, Style::FontWeight weight, int size);
 
 
-	/// Adds a new face to the family.
-	/// @param[in] ft_face The previously loaded FreeType face.
-	/// @param[in] style The style of the new face.
-	/// @param[in] weight The weight of the new face.
-	/// @param[in] release_stream True if the application must free the face's memory stream.
-	/// @return True if the face was loaded successfully, false otherwise.
-	FontFace* AddFace(FontFaceHandleFreetype ft_face, Style::FontStyle style, Style::FontWeight weight, bool release_stream);
+	/// Adds a face to the family, unless it is already registered with the same style and weight.
+	/// @param[in] face The previously loaded face, owned by the font provider.
+	/// @param[in] style The style to register the face as.
+	/// @param[in] weight The weight to register the face as.
+	void AddFace(FontFace* face, Style::FontStyle style, Style::FontWeight weight);
+
+	/// Appends the information of the handles of all faces in the family.
+	/// @param[out] statistics The list to append the information to.
+	/// @param[in-out] visited_faces Faces already reported through other families, which are skipped.
+	void GetFontFaceStatistics(std::vector<FontFaceStatistics>& statistics, SmallUnorderedSet<const FontFace*>& visited_faces);
 
 protected:
 	String name;
 
-	using FontFaceList = std::vector< UniquePtr<FontFace> >;
+	struct FaceEntry
+	{
+		FontFace* face;
+		Style::FontStyle style;
+		Style::FontWeight weight;
+	};
+
+	using FontFaceList = std::vector< FaceEntry >;
 	FontFaceList font_faces;
 };
 
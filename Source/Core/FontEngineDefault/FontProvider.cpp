@@ -27,12 +27,18 @@
  */
 
 #include "FontProvider.h"
+#include "BitmapFont.h"
 #include "FontFace.h"
 #include "FontFamily.h"
 #include "FreeTypeInterface.h"
+#include "GlyphCache.h"
+#include "GlyphRasterizer.h"
+#include "TextShaper.h"
 #include "../../../Include/RmlUi/Core/Core.h"
 #include "../../../Include/RmlUi/Core/FileInterface.h"
 #include "../../../Include/RmlUi/Core/Log.h"
+#include "../../../Include/RmlUi/Core/MemoryInterface.h"
+#include "../../../Include/RmlUi/Core/MemoryStatistics.h"
 #include "../../../Include/RmlUi/Core/StringUtilities.h"
 #include <algorithm>
 
@@ -57,14 +63,22 @@ bool FontProvider::Initialise()
 	if (!FreeType::Initialise())
 		return false;
 	g_font_provider = new FontProvider;
+	GlyphRasterizer::Initialise();
+	GlyphCache::Initialise();
+	TextShaper::Initialise();
 	return true;
 }
 
 void FontProvider::Shutdown()
 {
 	RMLUI_ASSERT(g_font_provider);
+	// The rasterizer thread uses the memory of the faces, stop it before they are released.
+	GlyphRasterizer::Shutdown();
 	delete g_font_provider;
 	g_font_provider = nullptr;
+	// The handles store their glyphs in the cache as they are released above.
+	GlyphCache::Shutdown();
+	TextShaper::Shutdown();
 	FreeType::Shutdown();
 }
 
@@ -102,70 +116,160 @@ FontFaceHandleDefault* FontProvider::GetFallbackFontFace(int index, int font_siz
 	return nullptr;
 }
 
+void FontProvider::GetFontFaceStatistics(std::vector<FontFaceStatistics>& statistics)
+{
+	// Faces registered in several families are only reported once.
+	SmallUnorderedSet<const FontFace*> visited_faces;
+
+	for (auto& pair : Get().font_families)
+		pair.second->GetFontFaceStatistics(statistics, visited_faces);
+}
+
 
 bool FontProvider::LoadFontFace(const String& file_name, bool fallback_face)
 {
+	FontProvider& provider = Get();
+
+	// Registering the same file again shares the face loaded the first time.
+	auto it_face = provider.file_faces.find(file_name);
+	if (it_face != provider.file_faces.end())
+		return provider.AddFace(it_face->second, String(), Style::FontStyle::Normal, Style::FontWeight::Normal, fallback_face, file_name);
+
+	// Descriptors of pre-rendered bitmap fonts are recognized by their extension.
+	const bool is_bitmap_font = (file_name.size() > 4 && StringUtilities::ToLower(file_name.substr(file_name.size() - 4)) == ".fnt");
+	if (is_bitmap_font)
+	{
+		FontFace* face = provider.LoadBitmapFace(file_name);
+		if (!face)
+			return false;
+
+		provider.file_faces[file_name] = face;
+
+		return provider.AddFace(face, String(), Style::FontStyle::Normal, Style::FontWeight::Normal, fallback_face, file_name);
+	}
+
 	FileInterface* file_interface = GetFileInterface();
-	FileHandle handle = file_interface->Open(file_name);
+	FontFace* face = nullptr;
 
-	if (!handle)
+	// Prefer mapping the file, so that only the parts of the font in use are paged into memory.
+	size_t length = 0;
+	if (const byte* mapped_data = file_interface->Map(file_name, length))
 	{
-		Log::Message(Log::LT_ERROR, "Failed to load font face from %s, could not open file.", file_name.c_str());
-		return false;
+		face = provider.LoadFace(mapped_data, (int)length, FontFace::DataOwner::FileInterface, file_interface, file_name);
 	}
+	else
+	{
+		FileHandle handle = file_interface->Open(file_name);
+
+		if (!handle)
+		{
+			Log::Message(Log::LT_ERROR, "Failed to load font face from %s, could not open file.", file_name.c_str());
+			return false;
+		}
+
+		length = file_interface->Length(handle);
+
+		byte* buffer = (byte*)GetMemoryInterface()->Allocate(length, 1, MemoryCategory::Fonts);
+		if (!buffer)
+		{
+			file_interface->Close(handle);
+			Log::Message(Log::LT_ERROR, "Failed to load font face from %s, could not allocate %zu bytes.", file_name.c_str(), length);
+			return false;
+		}
+
+		Memory::TrackAllocation(MemoryCategory::Fonts, length);
+		file_interface->Read(buffer, length, handle);
+		file_interface->Close(handle);
 
-	size_t length = file_interface->Length(handle);
+		face = provider.LoadFace(buffer, (int)length, FontFace::DataOwner::FontEngine, nullptr, file_name);
+	}
 
-	byte* buffer = new byte[length];
-	file_interface->Read(buffer, length, handle);
-	file_interface->Close(handle);
+	if (!face)
+		return false;
 
-	bool result = Get().LoadFontFace(buffer, (int)length, fallback_face, true, file_name);
+	provider.file_faces[file_name] = face;
 
-	return result;
+	return provider.AddFace(face, String(), Style::FontStyle::Normal, Style::FontWeight::Normal, fallback_face, file_name);
 }
 
 
 bool FontProvider::LoadFontFace(const byte* data, int data_size, const String& font_family, Style::FontStyle style, Style::FontWeight weight, bool fallback_face)
 {
+	FontProvider& provider = Get();
 	const String source = "memory";
-	
-	bool result = Get().LoadFontFace(data, data_size, fallback_face, false, source, font_family, style, weight);
-	
-	return result;
+
+	// Registering the same memory again, such as under another family name, shares the face loaded the first time.
+	FontFace* face = nullptr;
+
+	auto it_face = provider.memory_faces.find(data);
+	if (it_face != provider.memory_faces.end())
+	{
+		face = it_face->second;
+	}
+	else
+	{
+		face = provider.LoadFace(data, data_size, FontFace::DataOwner::Application, nullptr, source);
+		if (!face)
+			return false;
+
+		provider.memory_faces[data] = face;
+	}
+
+	return provider.AddFace(face, font_family, style, weight, fallback_face, source);
 }
 
-bool FontProvider::LoadFontFace(const byte* data, int data_size, bool fallback_face, bool local_data, const String& source,
-	String font_family, Style::FontStyle style, Style::FontWeight weight)
+FontFace* FontProvider::LoadFace(const byte* data, int data_size, FontFace::DataOwner data_owner, FileInterface* file_interface, const String& source)
 {
 	FontFaceHandleFreetype ft_face = FreeType::LoadFace(data, data_size, source);
 	
 	if (!ft_face)
 	{
-		if (local_data)
-			delete[] data;
+		if (data_owner == FontFace::DataOwner::FontEngine)
+		{
+			GetMemoryInterface()->Deallocate(const_cast<byte*>(data), (size_t)data_size, 1, MemoryCategory::Fonts);
+			Memory::TrackDeallocation(MemoryCategory::Fonts, (size_t)data_size);
+		}
+		else if (data_owner == FontFace::DataOwner::FileInterface)
+		{
+			file_interface->Unmap(data, (size_t)data_size);
+		}
 
-		Log::Message(Log::LT_ERROR, "Failed to load font face %s (from %s).", font_family.c_str(), source.c_str());
-		return false;
+		Log::Message(Log::LT_ERROR, "Failed to load font face (from %s).", source.c_str());
+		return nullptr;
 	}
 
-	if (font_family.empty())
-	{
-		FreeType::GetFaceStyle(ft_face, font_family, style, weight);
-	}
+	font_faces.push_back(std::make_unique<FontFace>(ft_face, data_owner, file_interface));
 
-	if (!AddFace(ft_face, font_family, style, weight, fallback_face, local_data))
-	{
-		Log::Message(Log::LT_ERROR, "Failed to load font face %s (from %s).", font_family.c_str(), source.c_str());
-		return false;
-	}
+	return font_faces.back().get();
+}
 
-	Log::Message(Log::LT_INFO, "Loaded font face %s (from %s).", font_family.c_str(), source.c_str());
-	return true;
+FontFace* FontProvider::LoadBitmapFace(const String& file_name)
+{
+	UniquePtr<BitmapFont> bitmap_font = BitmapFont::Load(file_name);
+	if (!bitmap_font)
+		return nullptr;
+
+	font_faces.push_back(std::make_unique<FontFace>(std::move(bitmap_font)));
+
+	return font_faces.back().get();
 }
 
-bool FontProvider::AddFace(FontFaceHandleFreetype face, const String& family, Style::FontStyle style, Style::FontWeight weight, bool fallback_face, bool release_stream)
+bool FontProvider::AddFace(FontFace* face, String family, Style::FontStyle style, Style::FontWeight weight, bool fallback_face, const String& source)
 {
+	if (family.empty())
+	{
+		if (const BitmapFont* bitmap_font = face->GetBitmapFont())
+		{
+			family = bitmap_font->GetFamily();
+			style = bitmap_font->GetStyle();
+			weight = bitmap_font->GetWeight();
+		}
+		else
+		{
+			FreeType::GetFaceStyle(face->GetFace(), family, style, weight);
+		}
+	}
+
 	String family_lower = StringUtilities::ToLower(family);
 	FontFamily* font_family = nullptr;
 	auto it = font_families.find(family_lower);
@@ -180,20 +284,25 @@ bool FontProvider::AddFace(FontFaceHandleFreetype face, const String& family, St
 		font_families[family_lower] = std::move(font_family_ptr);
 	}
 
-	FontFace* font_face_result = font_family->AddFace(face, style, weight, release_stream);
+	font_family->AddFace(face, style, weight);
 
-	if (font_face_result && fallback_face)
+	// Bitmap fonts are rendered from their own atlas, so they cannot provide glyphs for other faces.
+	if (fallback_face && face->GetBitmapFont())
 	{
-		auto it_fallback_face = std::find(fallback_font_faces.begin(), fallback_font_faces.end(), font_face_result);
+		Log::Message(Log::LT_WARNING, "Bitmap font %s cannot be used as a fallback face (from %s).", family.c_str(), source.c_str());
+	}
+	else if (fallback_face)
+	{
+		auto it_fallback_face = std::find(fallback_font_faces.begin(), fallback_font_faces.end(), face);
 		if (it_fallback_face == fallback_font_faces.end())
 		{
-			fallback_font_faces.push_back(font_face_result);
+			fallback_font_faces.push_back(face);
 		}
 	}
 
-	return static_cast<bool>(font_face_result);
+	Log::Message(Log::LT_INFO, "Loaded font face %s (from %s).", family.c_str(), source.c_str());
+	return true;
 }
 
-
 }
 }
@@ -31,13 +31,15 @@
 
 #include "../../../Include/RmlUi/Core/Types.h"
 #include "../../../Include/RmlUi/Core/ComputedValues.h"
+#include "FontFace.h"
 #include "FontTypes.h"
 
 namespace Rml {
 namespace Core {
 
-class FontFace;
+class FileInterface;
 class FontFamily;
+struct FontFaceStatistics;
 class FontFaceHandleDefault;
 
 /**
@@ -62,6 +64,7 @@ public:
 	static FontFaceHandleDefault* GetFontFaceHandle(const String& family, Style::FontStyle style, Style::FontWeight weight, int size);
 
 	/// Adds a new font face to the database. The face's family, style and weight will be determined from the face itself.
+	/// Files with the '.fnt' extension are loaded as pre-rendered bitmap fonts in the BMFont format.
 	static bool LoadFontFace(const String& file_name, bool fallback_face);
 
 	/// Adds a new font face from memory.
@@ -73,20 +76,33 @@ public:
 	/// Return a font face handle with the given index, at the given font size.
 	static FontFaceHandleDefault* GetFallbackFontFace(int index, int font_size);
 
+	/// Appends the information of all font face handles in use.
+	static void GetFontFaceStatistics(std::vector<FontFaceStatistics>& statistics);
+
 private:
 	FontProvider();
 	~FontProvider();
 
 	static FontProvider& Get();
 
-	bool LoadFontFace(const byte* data, int data_size, bool fallback_face, bool local_data, const String& source,
-		String font_family = {}, Style::FontStyle style = Style::FontStyle::Normal, Style::FontWeight weight = Style::FontWeight::Normal);
+	// Loads a face from memory, releasing the memory according to its owner if it fails to load.
+	FontFace* LoadFace(const byte* data, int data_size, FontFace::DataOwner data_owner, FileInterface* file_interface, const String& source);
+
+	// Loads a bitmap font from its descriptor file.
+	FontFace* LoadBitmapFace(const String& file_name);
 
-	bool AddFace(FontFaceHandleFreetype face, const String& family, Style::FontStyle style, Style::FontWeight weight, bool fallback_face, bool release_stream);
+	// Registers a loaded face in a family, and as a fallback face if requested. The family, style and weight are read
+	// from the face itself if no family is given.
+	bool AddFace(FontFace* face, String family, Style::FontStyle style, Style::FontWeight weight, bool fallback_face, const String& source);
 
 	using FontFaceList = std::vector<FontFace*>;
 	using FontFamilyMap = UnorderedMap< String, UniquePtr<FontFamily>>;
 
+	// All loaded faces. Each file or memory buffer is loaded once, no matter how many times it is registered.
+	std::vector< UniquePtr<FontFace> > font_faces;
+	UnorderedMap< String, FontFace* > file_faces;
+	UnorderedMap< const byte*, FontFace* > memory_faces;
+
 	FontFamilyMap font_families;
 	FontFaceList fallback_font_faces;
 
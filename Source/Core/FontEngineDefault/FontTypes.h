@@ -39,6 +39,23 @@ namespace Core {
 
 using FontFaceHandleFreetype = uintptr_t;
 
+// Glyphs which do not represent a single code point, such as ligatures produced by text shaping, are stored along with
+// the other glyphs of a handle keyed by their glyph index in the face, offset beyond the Unicode range.
+constexpr char32_t GlyphIndexCharacterBase = 0x110000;
+
+inline Character GlyphIndexToCharacter(unsigned int glyph_index)
+{
+	return Character(GlyphIndexCharacterBase + glyph_index);
+}
+inline bool IsGlyphIndexCharacter(Character character)
+{
+	return (char32_t)character >= GlyphIndexCharacterBase;
+}
+inline unsigned int CharacterToGlyphIndex(Character character)
+{
+	return (unsigned int)((char32_t)character - GlyphIndexCharacterBase);
+}
+
 struct FontMetrics 
 {
 	int size;
@@ -27,19 +27,29 @@
  */
 
 #include "FreeTypeInterface.h"
+#include "../../../Include/RmlUi/Core/Core.h"
 #include "../../../Include/RmlUi/Core/Log.h"
+#include "../../../Include/RmlUi/Core/MemoryInterface.h"
+#include "../../../Include/RmlUi/Core/MemoryStatistics.h"
+#include "../ContextStatistics.h"
 
 #include <string.h>
 #include <ft2build.h>
 #include FT_FREETYPE_H
+#include FT_TRUETYPE_TABLES_H
 
 namespace Rml {
 namespace Core {
 
 static FT_Library ft_library = nullptr;
+// Only used by the glyph rasterizer thread.
+static FT_Library worker_ft_library = nullptr;
 
 
+static bool SelectCharmap(FT_Face face);
+static FT_UInt GetGlyphIndex(FT_Face face, Character character);
 static bool BuildGlyph(FT_Face ft_face, Character character, FontGlyphMap& glyphs);
+static bool RenderGlyph(FT_Face ft_face, Character character, FontGlyph& glyph, bool log_errors);
 static void BuildGlyphMap(FT_Face ft_face, int size, FontGlyphMap& glyphs);
 static void GenerateMetrics(FT_Face ft_face, FontMetrics& metrics);
 
@@ -82,15 +92,11 @@ FontFaceHandleFreetype FreeType::LoadFace(const byte* data, int data_length, con
 	}
 
 	// Initialise the character mapping on the face.
-	if (face->charmap == nullptr)
+	if (!SelectCharmap(face))
 	{
-		FT_Select_Charmap(face, FT_ENCODING_APPLE_ROMAN);
-		if (face->charmap == nullptr)
-		{
-			Log::Message(Log::LT_ERROR, "Font face (from %s) does not contain a Unicode or Apple Roman character map.", source.c_str());
-			FT_Done_Face(face);
-			return 0;
-		}
+		Log::Message(Log::LT_ERROR, "Font face (from %s) does not contain a Unicode or Apple Roman character map.", source.c_str());
+		FT_Done_Face(face);
+		return 0;
 	}
 
 	return (FontFaceHandleFreetype)face;
@@ -101,14 +107,40 @@ bool FreeType::ReleaseFace(FontFaceHandleFreetype in_face, bool release_stream)
 	FT_Face face = (FT_Face)in_face;
 
 	FT_Byte* face_memory = face->stream->base;
+	const size_t face_memory_size = (size_t)face->stream->size;
 	FT_Error error = FT_Done_Face(face);
 
 	if (release_stream)
-		delete[] face_memory;
+	{
+		GetMemoryInterface()->Deallocate(face_memory, face_memory_size, 1, MemoryCategory::Fonts);
+		Memory::TrackDeallocation(MemoryCategory::Fonts, face_memory_size);
+	}
 
 	return (error == 0);
 }
 
+void FreeType::GetFaceData(FontFaceHandleFreetype in_face, const byte*& data, int& data_length)
+{
+	FT_Face face = (FT_Face)in_face;
+
+	data = (const byte*)face->stream->base;
+	data_length = (int)face->stream->size;
+}
+
+bool FreeType::GetFaceRevision(FontFaceHandleFreetype in_face, unsigned long& checksum, long& revision, unsigned long& modified)
+{
+	FT_Face face = (FT_Face)in_face;
+
+	const TT_Header* header = (const TT_Header*)FT_Get_Sfnt_Table(face, FT_SFNT_HEAD);
+	if (!header)
+		return false;
+
+	checksum = (unsigned long)header->CheckSum_Adjust;
+	revision = (long)header->Font_Revision;
+	modified = (unsigned long)header->Modified[1];
+	return true;
+}
+
 void FreeType::GetFaceStyle(FontFaceHandleFreetype in_face, String& font_family, Style::FontStyle& style, Style::FontWeight& weight)
 {
 	FT_Face face = (FT_Face)in_face;
@@ -121,7 +153,7 @@ void FreeType::GetFaceStyle(FontFaceHandleFreetype in_face, String& font_family,
 
 
 // Initialises the handle so it is able to render text.
-bool FreeType::InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size, FontGlyphMap& glyphs, FontMetrics& metrics)
+bool FreeType::InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size, bool build_glyph_map, FontGlyphMap& glyphs, FontMetrics& metrics)
 {
 	FT_Face ft_face = (FT_Face)face;
 
@@ -136,7 +168,8 @@ bool FreeType::InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size,
 	}
 
 	// Construct the initial list of glyphs.
-	BuildGlyphMap(ft_face, font_size, glyphs);
+	if (build_glyph_map)
+		BuildGlyphMap(ft_face, font_size, glyphs);
 
 	// Generate the metrics for the handle.
 	GenerateMetrics(ft_face, metrics);
@@ -166,6 +199,20 @@ bool FreeType::AppendGlyph(FontFaceHandleFreetype face, int font_size, Character
 }
 
 
+bool FreeType::HasGlyph(FontFaceHandleFreetype face, Character character)
+{
+	FT_Face ft_face = (FT_Face)face;
+
+	return GetGlyphIndex(ft_face, character) != 0;
+}
+
+bool FreeType::HasKerning(FontFaceHandleFreetype face)
+{
+	FT_Face ft_face = (FT_Face)face;
+
+	return FT_HAS_KERNING(ft_face);
+}
+
 int FreeType::GetKerning(FontFaceHandleFreetype face, int font_size, Character lhs, Character rhs)
 {
 	FT_Face ft_face = (FT_Face)face;
@@ -182,8 +229,8 @@ int FreeType::GetKerning(FontFaceHandleFreetype face, int font_size, Character l
 
 	ft_error = FT_Get_Kerning(
 		ft_face,
-		FT_Get_Char_Index(ft_face, (FT_ULong)lhs),
-		FT_Get_Char_Index(ft_face, (FT_ULong)rhs),
+		GetGlyphIndex(ft_face, lhs),
+		GetGlyphIndex(ft_face, rhs),
 		FT_KERNING_DEFAULT,
 		&ft_kerning
 	);
@@ -196,6 +243,80 @@ int FreeType::GetKerning(FontFaceHandleFreetype face, int font_size, Character l
 }
 
 
+bool FreeType::InitialiseWorker()
+{
+	RMLUI_ASSERT(!worker_ft_library);
+
+	if (FT_Init_FreeType(&worker_ft_library) != 0)
+	{
+		worker_ft_library = nullptr;
+		return false;
+	}
+
+	return true;
+}
+
+void FreeType::ShutdownWorker()
+{
+	if (worker_ft_library != nullptr)
+	{
+		FT_Done_FreeType(worker_ft_library);
+		worker_ft_library = nullptr;
+	}
+}
+
+FontFaceHandleFreetype FreeType::LoadWorkerFace(const byte* data, int data_length)
+{
+	RMLUI_ASSERT(worker_ft_library);
+
+	FT_Face face = nullptr;
+	if (FT_New_Memory_Face(worker_ft_library, (const FT_Byte*)data, data_length, 0, &face) != 0)
+		return 0;
+
+	// Use the same character mapping as the face loaded on the main thread.
+	if (!SelectCharmap(face))
+	{
+		FT_Done_Face(face);
+		return 0;
+	}
+
+	return (FontFaceHandleFreetype)face;
+}
+
+bool FreeType::RasterizeGlyph(FontFaceHandleFreetype face, int font_size, Character character, FontGlyph& glyph)
+{
+	FT_Face ft_face = (FT_Face)face;
+
+	if (FT_Set_Char_Size(ft_face, 0, font_size << 6, 0, 0) != 0)
+		return false;
+
+	return RenderGlyph(ft_face, character, glyph, false);
+}
+
+
+
+static bool SelectCharmap(FT_Face face)
+{
+	// FreeType selects a Unicode character map by default when the face contains one.
+	if (face->charmap == nullptr)
+		FT_Select_Charmap(face, FT_ENCODING_APPLE_ROMAN);
+
+	return face->charmap != nullptr;
+}
+
+
+
+// Returns the index of the glyph of a code point, or of a glyph identified directly by its index, or zero if none.
+static FT_UInt GetGlyphIndex(FT_Face face, Character character)
+{
+	if (IsGlyphIndexCharacter(character))
+	{
+		const unsigned int glyph_index = CharacterToGlyphIndex(character);
+		return (glyph_index < (unsigned int)face->num_glyphs ? (FT_UInt)glyph_index : 0);
+	}
+
+	return FT_Get_Char_Index(face, (FT_ULong)character);
+}
 
 static void BuildGlyphMap(FT_Face ft_face, int size, FontGlyphMap& glyphs)
 {
@@ -239,33 +360,44 @@ static void BuildGlyphMap(FT_Face ft_face, int size, FontGlyphMap& glyphs)
 
 static bool BuildGlyph(FT_Face ft_face, Character character, FontGlyphMap& glyphs)
 {
-	int index = FT_Get_Char_Index(ft_face, (FT_ULong)character);
-	if (index == 0)
+	FontGlyph glyph;
+	if (!RenderGlyph(ft_face, character, glyph, true))
 		return false;
 
-	FT_Error error = FT_Load_Glyph(ft_face, index, 0);
-	if (error != 0)
+	RMLUI_STATISTICS_COUNT(num_glyphs_rasterized, 1);
+
+	auto result = glyphs.emplace(character, std::move(glyph));
+	if (!result.second)
 	{
-		Log::Message(Log::LT_WARNING, "Unable to load glyph for character '%u' on the font face '%s %s'; error code: %d.", character, ft_face->family_name, ft_face->style_name, error);
+		Log::Message(Log::LT_WARNING, "Glyph character '%u' is already loaded in the font face '%s %s'.", character, ft_face->family_name, ft_face->style_name);
 		return false;
 	}
 
-	error = FT_Render_Glyph(ft_face->glyph, FT_RENDER_MODE_NORMAL);
+	return true;
+}
+
+static bool RenderGlyph(FT_Face ft_face, Character character, FontGlyph& glyph, bool log_errors)
+{
+	FT_UInt index = GetGlyphIndex(ft_face, character);
+	if (index == 0)
+		return false;
+
+	FT_Error error = FT_Load_Glyph(ft_face, index, 0);
 	if (error != 0)
 	{
-		Log::Message(Log::LT_WARNING, "Unable to render glyph for character '%u' on the font face '%s %s'; error code: %d.", character, ft_face->family_name, ft_face->style_name, error);
+		if (log_errors)
+			Log::Message(Log::LT_WARNING, "Unable to load glyph for character '%u' on the font face '%s %s'; error code: %d.", character, ft_face->family_name, ft_face->style_name, error);
 		return false;
 	}
 
-	auto result = glyphs.emplace(character, FontGlyph{});
-	if (!result.second)
+	error = FT_Render_Glyph(ft_face->glyph, FT_RENDER_MODE_NORMAL);
+	if (error != 0)
 	{
-		Log::Message(Log::LT_WARNING, "Glyph character '%u' is already loaded in the font face '%s %s'.", character, ft_face->family_name, ft_face->style_name);
+		if (log_errors)
+			Log::Message(Log::LT_WARNING, "Unable to render glyph for character '%u' on the font face '%s %s'; error code: %d.", character, ft_face->family_name, ft_face->style_name, error);
 		return false;
 	}
 
-	FontGlyph& glyph = result.first->second;
-
 	FT_GlyphSlot ft_glyph = ft_face->glyph;
 
 	// Set the glyph's dimensions.
@@ -292,7 +424,8 @@ static bool BuildGlyph(FT_Face ft_face, Character character, FontGlyphMap& glyph
 		{
 			glyph.bitmap_owned_data.reset();
 			glyph.bitmap_data = nullptr;
-			Log::Message(Log::LT_WARNING, "Unable to render glyph on the font face '%s %s'; unsupported pixel mode (%d).", ft_glyph->face->family_name, ft_glyph->face->style_name, ft_glyph->bitmap.pixel_mode);
+			if (log_errors)
+				Log::Message(Log::LT_WARNING, "Unable to render glyph on the font face '%s %s'; unsupported pixel mode (%d).", ft_glyph->face->family_name, ft_glyph->face->style_name, ft_glyph->bitmap.pixel_mode);
 		}
 		else
 		{
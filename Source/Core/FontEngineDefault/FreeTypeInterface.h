@@ -46,18 +46,47 @@ FontFaceHandleFreetype LoadFace(const byte* data, int data_length, const String&
 // Releases the FreeType face.
 bool ReleaseFace(FontFaceHandleFreetype face, bool release_stream);
 
+// Returns the memory the face was loaded from.
+void GetFaceData(FontFaceHandleFreetype face, const byte*& data, int& data_length);
+
+// Retrieves the checksum, revision and modification time from the font header of the face, without reading the rest of
+// its data. Returns false if the face has no font header.
+bool GetFaceRevision(FontFaceHandleFreetype face, unsigned long& checksum, long& revision, unsigned long& modified);
+
 // Retrieves the font family, style and weight of the given font face.
 void GetFaceStyle(FontFaceHandleFreetype face, String& font_family, Style::FontStyle& style, Style::FontWeight& weight);
 
-// Initializes a face for a given font size. Glyphs are filled with the ASCII subset, and the font face metrics are set.
-bool InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size, FontGlyphMap& glyphs, FontMetrics& metrics);
+// Initializes a face for a given font size. Glyphs are filled with the ASCII subset unless already loaded from elsewhere,
+// and the font face metrics are set.
+bool InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size, bool build_glyph_map, FontGlyphMap& glyphs, FontMetrics& metrics);
 
 // Build a new glyph representing the given code point and append to 'glyphs'.
 bool AppendGlyph(FontFaceHandleFreetype face, int font_size, Character character, FontGlyphMap& glyphs);
 
+// Returns true if the face contains a glyph for the given code point.
+bool HasGlyph(FontFaceHandleFreetype face, Character character);
+
+// Returns true if the face contains kerning information.
+bool HasKerning(FontFaceHandleFreetype face);
+
 // Returns the kerning between two characters.
 int GetKerning(FontFaceHandleFreetype face, int font_size, Character lhs, Character rhs);
 
+
+// The functions below are used by the glyph rasterizer thread, which has its own FreeType library and faces. They must
+// only be called from that thread, and never log.
+
+// Initialize the FreeType library of the calling thread.
+bool InitialiseWorker();
+// Shutdown the FreeType library of the calling thread.
+void ShutdownWorker();
+
+// Loads a face for the calling thread from the memory of a face loaded with LoadFace. Release it without its stream.
+FontFaceHandleFreetype LoadWorkerFace(const byte* data, int data_length);
+
+// Build a new glyph representing the given code point.
+bool RasterizeGlyph(FontFaceHandleFreetype face, int font_size, Character character, FontGlyph& glyph);
+
 }
 }
 }
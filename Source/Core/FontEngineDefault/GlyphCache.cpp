@@ -0,0 +1,434 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "GlyphCache.h"
+#include "FreeTypeInterface.h"
+#include "../../../Include/RmlUi/Core/Core.h"
+#include "../../../Include/RmlUi/Core/FileInterface.h"
+#include "../../../Include/RmlUi/Core/Log.h"
+#include "../../../Include/RmlUi/Core/StringUtilities.h"
+#include <cstdint>
+#include <cstdio>
+#include <string.h>
+
+namespace Rml {
+namespace Core {
+
+namespace {
+
+// Increment whenever the layout of the files or the rasterization of glyphs changes.
+constexpr std::uint32_t CacheFileVersion = 1;
+
+enum class RecordType : std::uint32_t { Glyph, Image };
+
+// Files consist of the header, followed by the records each directly followed by their data. Values are stored in the
+// native byte order, files are not meant to be shared between platforms.
+struct FileHeader
+{
+	char magic[4];
+	std::uint32_t version;
+	RecordType record_type;
+	std::uint32_t num_records;
+};
+
+struct GlyphRecord
+{
+	std::uint32_t character;
+	std::int32_t dimensions[2];
+	std::int32_t bearing[2];
+	std::int32_t advance;
+	std::int32_t bitmap_dimensions[2];
+};
+
+struct ImageRecord
+{
+	std::uint32_t character;
+	std::int32_t dimensions[2];
+	std::uint32_t reserved;
+};
+
+// Larger glyphs are considered corrupt.
+constexpr std::int32_t MaxDimensions = 1 << 14;
+
+}
+
+static String cache_directory;
+
+
+// Returns the size of the data following a record, padded so that the next record is aligned.
+static size_t PaddedSize(size_t size)
+{
+	return (size + 3) & ~size_t(3);
+}
+
+static String GetFileName(const String& face_key, int font_size, size_t fingerprint)
+{
+	String file_name = cache_directory;
+	if (!file_name.empty() && file_name.back() != '/' && file_name.back() != '\\')
+		file_name += '/';
+
+	file_name += CreateString(64, "%s-%d", face_key.c_str(), font_size);
+	if (fingerprint != 0)
+		file_name += CreateString(32, "-%016llx", (unsigned long long)fingerprint);
+	file_name += ".glyphs";
+
+	return file_name;
+}
+
+// Loads a file through the file interface, mapping it into memory if supported.
+static UniquePtr<GlyphCacheFile> LoadFile(const String& file_name)
+{
+	FileInterface* file_interface = GetFileInterface();
+
+	size_t length = 0;
+	if (const byte* data = file_interface->Map(file_name, length))
+		return std::make_unique<GlyphCacheFile>(data, length, file_interface, nullptr);
+
+	FileHandle handle = file_interface->Open(file_name);
+	if (!handle)
+		return nullptr;
+
+	length = file_interface->Length(handle);
+	UniquePtr<byte[]> buffer(new byte[length]);
+	const size_t read_length = file_interface->Read(buffer.get(), length, handle);
+	file_interface->Close(handle);
+
+	if (read_length != length)
+		return nullptr;
+
+	const byte* data = buffer.get();
+	return std::make_unique<GlyphCacheFile>(data, length, nullptr, std::move(buffer));
+}
+
+// Returns the number of records in the file if its header is valid for the given record type, or -1 otherwise.
+static int ReadHeader(const GlyphCacheFile& file, RecordType record_type, size_t record_size)
+{
+	FileHeader header;
+	if (file.GetLength() < sizeof(header))
+		return -1;
+
+	memcpy(&header, file.GetData(), sizeof(header));
+
+	if (memcmp(header.magic, "RMLG", 4) != 0 || header.version != CacheFileVersion || header.record_type != record_type)
+		return -1;
+
+	// The records are read before being validated, so make sure a corrupt count can not reserve more than the file holds.
+	if (header.num_records > (file.GetLength() - sizeof(header)) / record_size)
+		return -1;
+
+	return (int)header.num_records;
+}
+
+static void WriteHeader(std::vector<byte>& data, RecordType record_type, size_t num_records)
+{
+	FileHeader header;
+	memcpy(header.magic, "RMLG", 4);
+	header.version = CacheFileVersion;
+	header.record_type = record_type;
+	header.num_records = (std::uint32_t)num_records;
+
+	data.resize(sizeof(header));
+	memcpy(data.data(), &header, sizeof(header));
+}
+
+// Appends a record and its data to the file contents.
+template<typename Record>
+static void WriteRecord(std::vector<byte>& data, const Record& record, const byte* record_data, size_t record_data_size)
+{
+	const size_t offset = data.size();
+	data.resize(offset + sizeof(Record) + PaddedSize(record_data_size), 0);
+
+	memcpy(data.data() + offset, &record, sizeof(Record));
+	if (record_data_size > 0)
+		memcpy(data.data() + offset + sizeof(Record), record_data, record_data_size);
+}
+
+// Writes the file contents, releasing the file previously loaded from the same name first.
+static void StoreFile(const String& file_name, const std::vector<byte>& data, UniquePtr<GlyphCacheFile>& file)
+{
+	// Some platforms do not allow replacing files which are still mapped.
+	file.reset();
+
+	// Write to a temporary file first, so that an interrupted write never leaves a partial file behind.
+	const String temporary_file_name = file_name + ".tmp";
+
+	FILE* fp = fopen(temporary_file_name.c_str(), "wb");
+	if (!fp)
+	{
+		Log::Message(Log::LT_WARNING, "Unable to write glyph cache file '%s'.", temporary_file_name.c_str());
+		return;
+	}
+
+	const bool written = (fwrite(data.data(), 1, data.size(), fp) == data.size());
+	const bool closed = (fclose(fp) == 0);
+
+	if (!written || !closed)
+	{
+		Log::Message(Log::LT_WARNING, "Unable to write glyph cache file '%s'.", temporary_file_name.c_str());
+		remove(temporary_file_name.c_str());
+		return;
+	}
+
+	remove(file_name.c_str());
+	if (rename(temporary_file_name.c_str(), file_name.c_str()) != 0)
+	{
+		Log::Message(Log::LT_WARNING, "Unable to write glyph cache file '%s'.", file_name.c_str());
+		remove(temporary_file_name.c_str());
+	}
+}
+
+
+GlyphCacheFile::GlyphCacheFile(const byte* data, size_t length, FileInterface* file_interface, UniquePtr<byte[]> owned_data)
+	: data(data), length(length), file_interface(file_interface), owned_data(std::move(owned_data))
+{}
+
+GlyphCacheFile::~GlyphCacheFile()
+{
+	if (file_interface)
+		file_interface->Unmap(data, length);
+}
+
+
+void GlyphCache::Initialise()
+{
+	cache_directory = GetGlyphCacheDirectory();
+}
+
+void GlyphCache::Shutdown()
+{
+	cache_directory.clear();
+}
+
+bool GlyphCache::IsEnabled()
+{
+	return !cache_directory.empty();
+}
+
+String GlyphCache::GenerateFaceKey(FontFaceHandleFreetype face)
+{
+	const byte* data = nullptr;
+	int data_length = 0;
+	FreeType::GetFaceData(face, data, data_length);
+
+	// 64-bit FNV-1a hash.
+	std::uint64_t hash = 14695981039346656037ull;
+	auto add_to_hash = [&hash](const byte* bytes, size_t num_bytes) {
+		for (size_t i = 0; i < num_bytes; i++)
+		{
+			hash ^= (std::uint64_t)bytes[i];
+			hash *= 1099511628211ull;
+		}
+	};
+
+	// The font data may be mapped from large files, so only a few pages of it are hashed to avoid reading all of them
+	// on startup: the length, the start and end of the data, and the whole-file checksum and revision stored in the font
+	// header where available.
+	const size_t length = (size_t)data_length;
+	const size_t sample_length = Math::Min(length, size_t(4096));
+
+	add_to_hash((const byte*)&length, sizeof(length));
+	add_to_hash(data, sample_length);
+	add_to_hash(data + length - sample_length, sample_length);
+
+	unsigned long checksum = 0, modified = 0;
+	long revision = 0;
+	if (FreeType::GetFaceRevision(face, checksum, revision, modified))
+	{
+		add_to_hash((const byte*)&checksum, sizeof(checksum));
+		add_to_hash((const byte*)&revision, sizeof(revision));
+		add_to_hash((const byte*)&modified, sizeof(modified));
+	}
+
+	return CreateString(32, "%016llx", (unsigned long long)hash);
+}
+
+UniquePtr<GlyphCacheFile> GlyphCache::LoadGlyphs(const String& face_key, int font_size, FontGlyphMap& glyphs)
+{
+	UniquePtr<GlyphCacheFile> file = LoadFile(GetFileName(face_key, font_size, 0));
+	if (!file)
+		return nullptr;
+
+	const int num_records = ReadHeader(*file, RecordType::Glyph, sizeof(GlyphRecord));
+	if (num_records < 0)
+		return nullptr;
+
+	const byte* const end = file->GetData() + file->GetLength();
+	const byte* position = file->GetData() + sizeof(FileHeader);
+
+	FontGlyphMap loaded_glyphs;
+	loaded_glyphs.reserve(num_records);
+
+	for (int i = 0; i < num_records; i++)
+	{
+		GlyphRecord record;
+		if (size_t(end - position) < sizeof(record))
+			return nullptr;
+
+		memcpy(&record, position, sizeof(record));
+		position += sizeof(record);
+
+		if (record.bitmap_dimensions[0] < 0 || record.bitmap_dimensions[0] > MaxDimensions ||
+			record.bitmap_dimensions[1] < 0 || record.bitmap_dimensions[1] > MaxDimensions)
+			return nullptr;
+
+		const size_t bitmap_size = size_t(record.bitmap_dimensions[0]) * size_t(record.bitmap_dimensions[1]);
+		if (size_t(end - position) < PaddedSize(bitmap_size))
+			return nullptr;
+
+		FontGlyph glyph;
+		glyph.dimensions = Vector2i(record.dimensions[0], record.dimensions[1]);
+		glyph.bearing = Vector2i(record.bearing[0], record.bearing[1]);
+		glyph.advance = record.advance;
+		glyph.bitmap_dimensions = Vector2i(record.bitmap_dimensions[0], record.bitmap_dimensions[1]);
+		glyph.bitmap_data = (bitmap_size > 0 ? position : nullptr);
+
+		loaded_glyphs.emplace((Character)record.character, std::move(glyph));
+
+		position += PaddedSize(bitmap_size);
+	}
+
+	// Only add the glyphs once the whole file is known to be valid.
+	for (auto& pair : loaded_glyphs)
+		glyphs.emplace(pair.first, std::move(pair.second));
+
+	return file;
+}
+
+void GlyphCache::StoreGlyphs(const String& face_key, int font_size, FontFaceHandleFreetype face, const FontGlyphMap& glyphs, UniquePtr<GlyphCacheFile>& file)
+{
+	size_t num_records = 0;
+	std::vector<byte> data;
+	data.reserve(sizeof(FileHeader) + glyphs.size() * (sizeof(GlyphRecord) + size_t(font_size * font_size)));
+	WriteHeader(data, RecordType::Glyph, 0);
+
+	for (const auto& pair : glyphs)
+	{
+		const Character character = pair.first;
+		const FontGlyph& glyph = pair.second;
+
+		if (character != Character::Replacement && !FreeType::HasGlyph(face, character))
+			continue;
+
+		GlyphRecord record = {};
+		record.character = (std::uint32_t)character;
+		record.dimensions[0] = glyph.dimensions.x;
+		record.dimensions[1] = glyph.dimensions.y;
+		record.bearing[0] = glyph.bearing.x;
+		record.bearing[1] = glyph.bearing.y;
+		record.advance = glyph.advance;
+
+		// Glyphs without bitmap data are stored without dimensions, as nothing is copied from them.
+		if (glyph.bitmap_data)
+		{
+			record.bitmap_dimensions[0] = glyph.bitmap_dimensions.x;
+			record.bitmap_dimensions[1] = glyph.bitmap_dimensions.y;
+		}
+
+		const size_t bitmap_size = size_t(record.bitmap_dimensions[0]) * size_t(record.bitmap_dimensions[1]);
+		WriteRecord(data, record, glyph.bitmap_data, bitmap_size);
+		num_records += 1;
+	}
+
+	FileHeader header;
+	memcpy(&header, data.data(), sizeof(header));
+	header.num_records = (std::uint32_t)num_records;
+	memcpy(data.data(), &header, sizeof(header));
+
+	StoreFile(GetFileName(face_key, font_size, 0), data, file);
+}
+
+UniquePtr<GlyphCacheFile> GlyphCache::LoadImages(const String& face_key, int font_size, size_t fingerprint, GlyphImageMap& images)
+{
+	UniquePtr<GlyphCacheFile> file = LoadFile(GetFileName(face_key, font_size, fingerprint));
+	if (!file)
+		return nullptr;
+
+	const int num_records = ReadHeader(*file, RecordType::Image, sizeof(ImageRecord));
+	if (num_records < 0)
+		return nullptr;
+
+	const byte* const end = file->GetData() + file->GetLength();
+	const byte* position = file->GetData() + sizeof(FileHeader);
+
+	GlyphImageMap loaded_images;
+	loaded_images.reserve(num_records);
+
+	for (int i = 0; i < num_records; i++)
+	{
+		ImageRecord record;
+		if (size_t(end - position) < sizeof(record))
+			return nullptr;
+
+		memcpy(&record, position, sizeof(record));
+		position += sizeof(record);
+
+		if (record.dimensions[0] < 0 || record.dimensions[0] > MaxDimensions ||
+			record.dimensions[1] < 0 || record.dimensions[1] > MaxDimensions)
+			return nullptr;
+
+		const size_t image_size = size_t(record.dimensions[0]) * size_t(record.dimensions[1]) * 4;
+		if (size_t(end - position) < image_size)
+			return nullptr;
+
+		GlyphImage image;
+		image.data = position;
+		image.dimensions = Vector2i(record.dimensions[0], record.dimensions[1]);
+
+		loaded_images.emplace((Character)record.character, std::move(image));
+
+		position += image_size;
+	}
+
+	for (auto& pair : loaded_images)
+		images.emplace(pair.first, std::move(pair.second));
+
+	return file;
+}
+
+void GlyphCache::StoreImages(const String& face_key, int font_size, size_t fingerprint, const GlyphImageMap& images, UniquePtr<GlyphCacheFile>& file)
+{
+	std::vector<byte> data;
+	WriteHeader(data, RecordType::Image, images.size());
+
+	for (const auto& pair : images)
+	{
+		const GlyphImage& image = pair.second;
+
+		ImageRecord record = {};
+		record.character = (std::uint32_t)pair.first;
+		record.dimensions[0] = image.dimensions.x;
+		record.dimensions[1] = image.dimensions.y;
+
+		WriteRecord(data, record, image.data, size_t(image.dimensions.x) * size_t(image.dimensions.y) * 4);
+	}
+
+	StoreFile(GetFileName(face_key, font_size, fingerprint), data, file);
+}
+
+}
+}
@@ -0,0 +1,138 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUICOREGLYPHCACHE_H
+#define RMLUICOREGLYPHCACHE_H
+
+#include "../../../Include/RmlUi/Core/Traits.h"
+#include "../../../Include/RmlUi/Core/Types.h"
+#include "FontTypes.h"
+
+namespace Rml {
+namespace Core {
+
+class FileInterface;
+
+/**
+	The image generated by a font effect for a single glyph.
+ */
+struct GlyphImage
+{
+	/// 32-bit RGBA data of the image, tightly packed.
+	const byte* data = nullptr;
+	Vector2i dimensions;
+
+	// Data may point to this member or into a glyph cache file.
+	UniquePtr<byte[]> owned_data;
+};
+
+using GlyphImageMap = UnorderedMap<Character, GlyphImage>;
+
+
+/**
+	A glyph cache file loaded into memory, which is released when the file is destroyed.
+ */
+class GlyphCacheFile final : public NonCopyMoveable
+{
+public:
+	/// @param[in] data The contents of the file.
+	/// @param[in] length The length of the file in bytes.
+	/// @param[in] file_interface The file interface the file was mapped through, or nullptr if the data is owned below.
+	/// @param[in] owned_data The contents of the file when read instead of mapped.
+	GlyphCacheFile(const byte* data, size_t length, FileInterface* file_interface, UniquePtr<byte[]> owned_data);
+	~GlyphCacheFile();
+
+	const byte* GetData() const { return data; }
+	size_t GetLength() const { return length; }
+
+private:
+	const byte* data;
+	size_t length;
+	FileInterface* file_interface;
+	UniquePtr<byte[]> owned_data;
+};
+
+
+/**
+	Stores rasterized glyphs and font effect images on disk between runs, in the directory set through the core API.
+
+	Each font face handle has a file for its glyphs, and a file for the images of each font effect layer generating its
+	own textures. The files are named after a key identifying the font data, the size, and the fingerprint of the font effect.
+	Loaded files are mapped into memory through the file interface, with the glyph bitmaps and images pointing directly
+	into them. Files are written back when their handle or layer is destroyed, if any glyphs were added since loaded.
+ */
+
+class GlyphCache
+{
+public:
+	/// Enables the cache if a directory is set through the core API.
+	static void Initialise();
+	/// Disables the cache. Must be called after all handles are released, as they store their files when destroyed.
+	static void Shutdown();
+
+	/// Returns true if glyphs should be loaded from and stored to the cache.
+	static bool IsEnabled();
+
+	/// Returns the key identifying the data of a font face in the names of its cache files.
+	static String GenerateFaceKey(FontFaceHandleFreetype face);
+
+	/// Loads the cached glyphs of a font face handle.
+	/// @param[in] face_key The key of the font face.
+	/// @param[in] font_size The size of the handle.
+	/// @param[out] glyphs The map to add the glyphs to, their bitmaps point into the returned file.
+	/// @return The loaded file, or nullptr if there is no valid cache file.
+	static UniquePtr<GlyphCacheFile> LoadGlyphs(const String& face_key, int font_size, FontGlyphMap& glyphs);
+	/// Stores the glyphs of a font face handle, replacing the file they were loaded from. Glyphs copied from fallback
+	/// faces are left out, they are copied again on next use.
+	/// @param[in] face_key The key of the font face.
+	/// @param[in] font_size The size of the handle.
+	/// @param[in] face The font face, to tell its own glyphs from the ones copied from fallback faces.
+	/// @param[in] glyphs The glyphs to store.
+	/// @param[in-out] file The file the glyphs were loaded from, it is released before being replaced.
+	static void StoreGlyphs(const String& face_key, int font_size, FontFaceHandleFreetype face, const FontGlyphMap& glyphs, UniquePtr<GlyphCacheFile>& file);
+
+	/// Loads the cached images of a font effect layer.
+	/// @param[in] face_key The key of the font face.
+	/// @param[in] font_size The size of the handle.
+	/// @param[in] fingerprint The fingerprint of the font effect.
+	/// @param[out] images The map to add the images to, their data points into the returned file.
+	/// @return The loaded file, or nullptr if there is no valid cache file.
+	static UniquePtr<GlyphCacheFile> LoadImages(const String& face_key, int font_size, size_t fingerprint, GlyphImageMap& images);
+	/// Stores the images of a font effect layer, replacing the file they were loaded from.
+	/// @param[in] face_key The key of the font face.
+	/// @param[in] font_size The size of the handle.
+	/// @param[in] fingerprint The fingerprint of the font effect.
+	/// @param[in] images The images to store.
+	/// @param[in-out] file The file the images were loaded from, it is released before being replaced.
+	static void StoreImages(const String& face_key, int font_size, size_t fingerprint, const GlyphImageMap& images, UniquePtr<GlyphCacheFile>& file);
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,203 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "GlyphRasterizer.h"
+#include "FontFaceHandleDefault.h"
+#include "FreeTypeInterface.h"
+#include "../../../Include/RmlUi/Core/Core.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace Rml {
+namespace Core {
+
+namespace {
+
+struct GlyphJob
+{
+	FontFaceHandleDefault* handle;
+	const byte* face_data;
+	int face_data_length;
+	int font_size;
+	Character character;
+};
+
+struct GlyphResult
+{
+	FontFaceHandleDefault* handle;
+	Character character;
+	FontGlyph glyph;
+	bool success;
+};
+
+struct RasterizerState
+{
+	std::thread thread;
+
+	// Protects the members below.
+	std::mutex mutex;
+	std::condition_variable condition;
+	bool stop = false;
+	std::deque<GlyphJob> jobs;
+	std::vector<GlyphResult> completed;
+
+	// Set while there are completed glyphs, so that the main thread can check for them without locking.
+	std::atomic<bool> has_completed{ false };
+};
+
+}
+
+static UniquePtr<RasterizerState> rasterizer;
+
+
+// Entry point of the rasterizer thread.
+static void RunRasterizer(RasterizerState* state)
+{
+	// Faces are loaded by this thread when first needed, keyed by the memory they are loaded from.
+	UnorderedMap<const byte*, FontFaceHandleFreetype> faces;
+
+	const bool library_initialised = FreeType::InitialiseWorker();
+
+	std::unique_lock<std::mutex> lock(state->mutex);
+
+	while (true)
+	{
+		state->condition.wait(lock, [state] { return state->stop || !state->jobs.empty(); });
+		if (state->stop)
+			break;
+
+		GlyphJob job = state->jobs.front();
+		state->jobs.pop_front();
+
+		lock.unlock();
+
+		GlyphResult result;
+		result.handle = job.handle;
+		result.character = job.character;
+		result.success = false;
+
+		if (library_initialised)
+		{
+			FontFaceHandleFreetype& face = faces[job.face_data];
+			if (!face)
+				face = FreeType::LoadWorkerFace(job.face_data, job.face_data_length);
+
+			result.success = (face && FreeType::RasterizeGlyph(face, job.font_size, job.character, result.glyph));
+		}
+
+		lock.lock();
+
+		state->completed.push_back(std::move(result));
+		state->has_completed.store(true, std::memory_order_release);
+	}
+
+	lock.unlock();
+
+	for (auto& pair : faces)
+	{
+		if (pair.second)
+			FreeType::ReleaseFace(pair.second, false);
+	}
+
+	FreeType::ShutdownWorker();
+}
+
+void GlyphRasterizer::Initialise()
+{
+	RMLUI_ASSERT(!rasterizer);
+
+	if (IsAsyncGlyphRasterizationEnabled())
+		rasterizer = std::make_unique<RasterizerState>();
+}
+
+void GlyphRasterizer::Shutdown()
+{
+	if (!rasterizer)
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(rasterizer->mutex);
+		rasterizer->stop = true;
+	}
+	rasterizer->condition.notify_one();
+
+	if (rasterizer->thread.joinable())
+		rasterizer->thread.join();
+
+	rasterizer.reset();
+}
+
+bool GlyphRasterizer::IsEnabled()
+{
+	return (bool)rasterizer;
+}
+
+void GlyphRasterizer::Enqueue(FontFaceHandleDefault* handle, FontFaceHandleFreetype face, int font_size, Character character)
+{
+	RMLUI_ASSERT(rasterizer);
+
+	GlyphJob job;
+	job.handle = handle;
+	FreeType::GetFaceData(face, job.face_data, job.face_data_length);
+	job.font_size = font_size;
+	job.character = character;
+
+	{
+		std::lock_guard<std::mutex> lock(rasterizer->mutex);
+		rasterizer->jobs.push_back(job);
+	}
+
+	// Only start the thread once there is anything to do.
+	if (!rasterizer->thread.joinable())
+		rasterizer->thread = std::thread(RunRasterizer, rasterizer.get());
+
+	rasterizer->condition.notify_one();
+}
+
+void GlyphRasterizer::ProcessCompleted()
+{
+	if (!rasterizer || !rasterizer->has_completed.load(std::memory_order_acquire))
+		return;
+
+	std::vector<GlyphResult> completed;
+
+	{
+		std::lock_guard<std::mutex> lock(rasterizer->mutex);
+		completed.swap(rasterizer->completed);
+		rasterizer->has_completed.store(false, std::memory_order_relaxed);
+	}
+
+	for (GlyphResult& result : completed)
+		result.handle->InsertRasterizedGlyph(result.character, std::move(result.glyph), result.success);
+}
+
+}
+}
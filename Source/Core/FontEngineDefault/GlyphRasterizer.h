@@ -0,0 +1,72 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUICOREGLYPHRASTERIZER_H
+#define RMLUICOREGLYPHRASTERIZER_H
+
+#include "../../../Include/RmlUi/Core/Types.h"
+#include "FontTypes.h"
+
+namespace Rml {
+namespace Core {
+
+class FontFaceHandleDefault;
+
+/**
+	Rasterizes glyphs on a background thread, so that text in new scripts does not stall the frame it first appears in.
+
+	The thread has its own FreeType library, and loads its own face for each face it is given from the same memory.
+	Rasterized glyphs are handed back to their font face handles on the main thread by ProcessCompleted().
+ */
+
+class GlyphRasterizer
+{
+public:
+	/// Enables the rasterizer if requested through the core API, the thread itself is started on first use.
+	static void Initialise();
+	/// Stops the thread and discards any glyphs not yet handed back. Must be called before any faces are released.
+	static void Shutdown();
+
+	/// Returns true if glyphs should be queued for rasterization instead of rasterized immediately.
+	static bool IsEnabled();
+
+	/// Queues a glyph for rasterization.
+	/// @param[in] handle The handle to hand the glyph back to.
+	/// @param[in] face The face of the handle, as loaded on the main thread.
+	/// @param[in] font_size The size of the handle.
+	/// @param[in] character The code point of the glyph.
+	static void Enqueue(FontFaceHandleDefault* handle, FontFaceHandleFreetype face, int font_size, Character character);
+
+	/// Hands all glyphs rasterized since the last call back to their handles. Must be called from the main thread.
+	static void ProcessCompleted();
+};
+
+}
+}
+
+#endif
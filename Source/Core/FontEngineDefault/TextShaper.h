@@ -0,0 +1,109 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUICORETEXTSHAPER_H
+#define RMLUICORETEXTSHAPER_H
+
+#include "../../../Include/RmlUi/Core/Types.h"
+#include "FontTypes.h"
+
+namespace Rml {
+namespace Core {
+
+/**
+	A glyph positioned by a text shaper.
+ */
+struct ShapedGlyph
+{
+	/// The glyph to render, the code point it represents or a glyph index of the face, see GlyphIndexToCharacter().
+	Character glyph = Character::Null;
+	/// The offset of the glyph from the pen position, in pixels, with positive values down.
+	Vector2i offset;
+	/// How far the pen moves after the glyph, in pixels, including any kerning.
+	int advance = 0;
+	/// True if the face has no glyph for the code point. Its glyph and advance are instead taken from the fallback
+	/// faces, or the replacement character.
+	bool missing = false;
+};
+
+/**
+	A segment of text shaped into glyphs, in visual order.
+ */
+struct ShapedRun
+{
+	std::vector<ShapedGlyph> glyphs;
+	/// The sum of the glyph advances, in pixels.
+	int width = 0;
+	/// The first and last code points of the text, to kern the run against adjacent runs.
+	Character first_character = Character::Null;
+	Character last_character = Character::Null;
+};
+
+
+/**
+	Shapes text into positioned glyphs, applying the substitutions and positioning of the font such as ligatures,
+	joining forms and combining marks.
+
+	Without a shaper the default font engine lays out text one code point per glyph with pairwise kerning. With a
+	shaper, font face handles split text into segments after each space, shape each segment once, and cache the runs for
+	measuring and generating text later.
+
+	The active shaper is selected when the font engine is initialised, the HarfBuzz shaper is used when RmlUi is built
+	with it.
+ */
+
+class TextShaper
+{
+public:
+	virtual ~TextShaper();
+
+	/// Shapes a segment of text. The direction and script of the text are determined from its contents.
+	/// @param[in] face The face to shape the text with.
+	/// @param[in] font_size The size of the face, in points.
+	/// @param[in] text The text to shape, in UTF-8.
+	/// @param[out] run The run to append the shaped glyphs to.
+	/// @return True if the text was shaped, false to lay it out one code point per glyph instead.
+	virtual bool Shape(FontFaceHandleFreetype face, int font_size, const String& text, ShapedRun& run) = 0;
+
+	/// Called before a face is released, to release any data the shaper keeps for it.
+	/// @param[in] face The face being released.
+	virtual void ReleaseFace(FontFaceHandleFreetype face);
+
+	/// Creates the shaper the font engine is built with, if any.
+	static void Initialise();
+	/// Destroys the active shaper. Must be called before the FreeType library is released.
+	static void Shutdown();
+
+	/// Returns the active shaper, or nullptr if text is laid out one code point per glyph.
+	static TextShaper* Get();
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,136 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "TextShaperHarfBuzz.h"
+
+#ifdef RMLUI_HARFBUZZ
+
+#include "../../../Include/RmlUi/Core/StringUtilities.h"
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include <hb.h>
+#include <hb-ft.h>
+
+namespace Rml {
+namespace Core {
+
+// Converts a distance in 26.6 fixed point to rounded pixels.
+static int ToPixels(hb_position_t value)
+{
+	return (value + 32) >> 6;
+}
+
+TextShaperHarfBuzz::TextShaperHarfBuzz()
+{
+	buffer = hb_buffer_create();
+}
+
+TextShaperHarfBuzz::~TextShaperHarfBuzz()
+{
+	for (auto& pair : fonts)
+		hb_font_destroy(pair.second);
+
+	hb_buffer_destroy(buffer);
+}
+
+bool TextShaperHarfBuzz::Shape(FontFaceHandleFreetype face, int font_size, const String& text, ShapedRun& run)
+{
+	FT_Face ft_face = (FT_Face)face;
+
+	hb_font_t*& font = fonts[face];
+	if (!font)
+	{
+		font = hb_ft_font_create_referenced(ft_face);
+
+		// Position with the same hinted metrics as the glyphs are rasterized with.
+		hb_ft_font_set_load_flags(font, FT_LOAD_DEFAULT);
+	}
+
+	// Set face size again in case it was used at another size in another font face handle.
+	if (FT_Set_Char_Size(ft_face, 0, font_size << 6, 0, 0) != 0)
+		return false;
+
+	hb_ft_font_changed(font);
+
+	hb_buffer_clear_contents(buffer);
+	hb_buffer_add_utf8(buffer, text.data(), (int)text.size(), 0, (int)text.size());
+	hb_buffer_guess_segment_properties(buffer);
+
+	hb_shape(font, buffer, nullptr, 0);
+
+	unsigned int num_glyphs = 0;
+	const hb_glyph_info_t* glyph_infos = hb_buffer_get_glyph_infos(buffer, &num_glyphs);
+	const hb_glyph_position_t* glyph_positions = hb_buffer_get_glyph_positions(buffer, &num_glyphs);
+
+	run.glyphs.reserve(run.glyphs.size() + num_glyphs);
+
+	for (unsigned int i = 0; i < num_glyphs; i++)
+	{
+		// Clusters are the byte offsets of the code points the glyphs were shaped from.
+		const Character character = StringUtilities::ToCharacter(text.data() + glyph_infos[i].cluster);
+		const unsigned int glyph_index = glyph_infos[i].codepoint;
+
+		ShapedGlyph glyph;
+
+		if (glyph_index == 0)
+		{
+			glyph.glyph = character;
+			glyph.missing = true;
+		}
+		else
+		{
+			// Glyphs representing their code point directly are shared with text laid out without shaping.
+			if (glyph_index == FT_Get_Char_Index(ft_face, (FT_ULong)character))
+				glyph.glyph = character;
+			else
+				glyph.glyph = GlyphIndexToCharacter(glyph_index);
+
+			glyph.offset = Vector2i(ToPixels(glyph_positions[i].x_offset), -ToPixels(glyph_positions[i].y_offset));
+			glyph.advance = ToPixels(glyph_positions[i].x_advance);
+		}
+
+		run.glyphs.push_back(glyph);
+	}
+
+	return true;
+}
+
+void TextShaperHarfBuzz::ReleaseFace(FontFaceHandleFreetype face)
+{
+	auto it = fonts.find(face);
+	if (it != fonts.end())
+	{
+		hb_font_destroy(it->second);
+		fonts.erase(it);
+	}
+}
+
+}
+}
+
+#endif
@@ -0,0 +1,69 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUICORETEXTSHAPERHARFBUZZ_H
+#define RMLUICORETEXTSHAPERHARFBUZZ_H
+
+#ifdef RMLUI_HARFBUZZ
+
+#include "TextShaper.h"
+
+struct hb_buffer_t;
+struct hb_font_t;
+
+namespace Rml {
+namespace Core {
+
+/**
+	Shapes text with HarfBuzz, using the FreeType faces of the font engine.
+ */
+
+class TextShaperHarfBuzz final : public TextShaper
+{
+public:
+	TextShaperHarfBuzz();
+	~TextShaperHarfBuzz();
+
+	bool Shape(FontFaceHandleFreetype face, int font_size, const String& text, ShapedRun& run) override;
+
+	void ReleaseFace(FontFaceHandleFreetype face) override;
+
+private:
+	// Reused between calls, cleared before shaping each segment.
+	hb_buffer_t* buffer;
+
+	// Created for each face when first shaped with.
+	UnorderedMap< FontFaceHandleFreetype, hb_font_t* > fonts;
+};
+
+}
+}
+
+#endif
+
+#endif
@@ -102,5 +102,18 @@ int FontEngineInterface::GetVersion(FontFaceHandle /*handle*/)
 	return 0;
 }
 
+bool FontEngineInterface::HasPendingGlyphs(FontFaceHandle /*handle*/)
+{
+	return false;
+}
+
+void FontEngineInterface::PrewarmGlyphs(FontFaceHandle /*handle*/, FontEffectsHandle /*font_effects_handle*/, const String& /*characters*/, RenderInterface* /*render_interface*/)
+{
+}
+
+void FontEngineInterface::GetFontFaceStatistics(std::vector<FontFaceStatistics>& /*statistics*/)
+{
+}
+
 }
 }
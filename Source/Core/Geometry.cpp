@@ -32,6 +32,8 @@
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
+#include "ContextStatistics.h"
+#include "GeometryArena.h"
 #include "GeometryDatabase.h"
 #include <utility>
 
@@ -39,6 +41,11 @@
 namespace Rml {
 namespace Core {
 
+static size_t num_compile_calls = 0;
+static size_t num_immediate_render_calls = 0;
+static size_t num_compiled_render_calls = 0;
+static size_t num_paged_render_calls = 0;
+
 Geometry::Geometry(Element* host_element) : host_element(host_element)
 {
 	database_handle = GeometryDatabase::Insert(this);
@@ -73,6 +80,7 @@ void Geometry::MoveFrom(Geometry& other)
 	texture = std::exchange(other.texture, nullptr);
 
 	compiled_geometry = std::exchange(other.compiled_geometry, 0);
+	arena_handle = std::exchange(other.arena_handle, 0);
 	compile_attempted = std::exchange(other.compile_attempted, false);
 }
 
@@ -109,9 +117,19 @@ void Geometry::Render(const Vector2f& translation)
 	{
 		RMLUI_ZoneScopedN("RenderCompiled");
 		render_interface->RenderCompiledGeometry(compiled_geometry, translation);
+		num_compiled_render_calls += 1;
+		RMLUI_STATISTICS_COUNT(num_draw_calls, 1);
+	}
+	// Or from the shared geometry pages.
+	else if (arena_handle)
+	{
+		RMLUI_ZoneScopedN("RenderPaged");
+		GeometryArena::Render(arena_handle, render_interface, texture ? texture->GetHandle(render_interface) : 0, translation);
+		num_paged_render_calls += 1;
+		RMLUI_STATISTICS_COUNT(num_draw_calls, 1);
 	}
-	// Otherwise, if we actually have geometry, try to compile it if we haven't already done so, otherwise render it in
-	// immediate mode.
+	// Otherwise, if we actually have geometry, try to store it in a geometry page or compile it if we haven't already
+	// done so, otherwise render it in immediate mode.
 	else
 	{
 		if (vertices.empty() ||
@@ -120,23 +138,41 @@ void Geometry::Render(const Vector2f& translation)
 
 		RMLUI_ZoneScopedN("RenderGeometry");
 
+		const TextureHandle texture_handle = (texture ? texture->GetHandle(render_interface) : 0);
+
 		if (!compile_attempted)
 		{
 			compile_attempted = true;
-			compiled_geometry = render_interface->CompileGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(), texture ? texture->GetHandle(render_interface) : 0);
+
+			// Prefer the geometry pages, they are shared with other geometry and uploaded in bulk.
+			arena_handle = GeometryArena::Allocate(render_interface, &vertices[0], (int)vertices.size(), &indices[0], (int)indices.size());
+			if (arena_handle)
+			{
+				GeometryArena::Render(arena_handle, render_interface, texture_handle, translation);
+				num_paged_render_calls += 1;
+				RMLUI_STATISTICS_COUNT(num_draw_calls, 1);
+				return;
+			}
+
+			compiled_geometry = render_interface->CompileGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(), texture_handle);
 
 			// If we managed to compile the geometry, we can clear the local copy of vertices and indices and
 			// immediately render the compiled version.
 			if (compiled_geometry)
-			{	
+			{
+				num_compile_calls += 1;
 				render_interface->RenderCompiledGeometry(compiled_geometry, translation);
+				num_compiled_render_calls += 1;
+				RMLUI_STATISTICS_COUNT(num_draw_calls, 1);
 				return;
 			}
 		}
 
 		// Either we've attempted to compile before (and failed), or the compile we just attempted failed; either way,
 		// render the uncompiled version.
-		render_interface->RenderGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(), texture ? texture->GetHandle(GetRenderInterface()) : 0, translation);
+		render_interface->RenderGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(), texture_handle, translation);
+		num_immediate_render_calls += 1;
+		RMLUI_STATISTICS_COUNT(num_draw_calls, 1);
 	}
 }
 
@@ -173,6 +209,12 @@ void Geometry::Release(bool clear_buffers)
 		compiled_geometry = 0;
 	}
 
+	if (arena_handle)
+	{
+		GeometryArena::Free(arena_handle);
+		arena_handle = 0;
+	}
+
 	compile_attempted = false;
 
 	if (clear_buffers)
@@ -182,6 +224,19 @@ void Geometry::Release(bool clear_buffers)
 	}
 }
 
+// Returns statistics on all geometry in use.
+GeometryStatistics Geometry::GetStatistics()
+{
+	GeometryStatistics statistics;
+	statistics.num_geometry = GeometryDatabase::GetNumGeometry();
+	statistics.num_compile_calls = num_compile_calls;
+	statistics.num_immediate_render_calls = num_immediate_render_calls;
+	statistics.num_compiled_render_calls = num_compiled_render_calls;
+	statistics.num_paged_render_calls = num_paged_render_calls;
+	GeometryArena::GetStatistics(statistics);
+	return statistics;
+}
+
 // Returns the host context's render interface.
 RenderInterface* Geometry::GetRenderInterface()
 {
@@ -0,0 +1,439 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "GeometryArena.h"
+#include "Memory.h"
+#include "../../Include/RmlUi/Core/Geometry.h"
+#include "../../Include/RmlUi/Core/RenderInterface.h"
+#include <algorithm>
+
+namespace Rml {
+namespace Core {
+namespace GeometryArena {
+
+// Capacity of each page. Most geometry consists of quads, needing six indices for every four vertices.
+static constexpr int page_vertex_capacity = 16384;
+static constexpr int page_index_capacity = (page_vertex_capacity * 3) / 2;
+
+// First-fit allocator of ranges within a fixed-size buffer, merging neighboring ranges when freed.
+class RangeAllocator {
+public:
+	void Initialise(int capacity)
+	{
+		free_ranges.clear();
+		free_ranges.push_back(Range{ 0, capacity });
+	}
+
+	// Returns the offset of the allocated range, or -1 if no free range is large enough.
+	int Allocate(int size)
+	{
+		for (auto it = free_ranges.begin(); it != free_ranges.end(); ++it)
+		{
+			if (it->size >= size)
+			{
+				const int offset = it->offset;
+				it->offset += size;
+				it->size -= size;
+				if (it->size == 0)
+					free_ranges.erase(it);
+				return offset;
+			}
+		}
+		return -1;
+	}
+
+	void Free(int offset, int size)
+	{
+		auto it = std::lower_bound(free_ranges.begin(), free_ranges.end(), offset, [](const Range& range, int offset) { return range.offset < offset; });
+
+		if (it != free_ranges.end() && offset + size == it->offset)
+		{
+			it->offset = offset;
+			it->size += size;
+		}
+		else
+		{
+			it = free_ranges.insert(it, Range{ offset, size });
+		}
+
+		if (it != free_ranges.begin())
+		{
+			auto it_prev = it - 1;
+			if (it_prev->offset + it_prev->size == it->offset)
+			{
+				it_prev->size += it->size;
+				free_ranges.erase(it);
+			}
+		}
+	}
+
+private:
+	struct Range {
+		int offset, size;
+	};
+	// Free ranges, sorted by offset.
+	std::vector<Range> free_ranges;
+};
+
+struct DirtyRange {
+	int begin = 0, end = 0;
+
+	void Add(int offset, int size)
+	{
+		if (begin == end)
+		{
+			begin = offset;
+			end = offset + size;
+		}
+		else
+		{
+			begin = std::min(begin, offset);
+			end = std::max(end, offset + size);
+		}
+	}
+	bool IsEmpty() const { return begin == end; }
+	void Clear() { begin = end = 0; }
+};
+
+struct Page {
+	// The render interface owning the page, or nullptr if the render interface has been destroyed.
+	RenderInterface* render_interface = nullptr;
+	GeometryPageHandle handle = 0;
+
+	// The page data is allocated through the memory interface, it is accounted to the geometry category on demand.
+	std::vector<Vertex, MemoryInterfaceAllocator<Vertex, MemoryCategory::Geometry>> vertices;
+	std::vector<int, MemoryInterfaceAllocator<int, MemoryCategory::Geometry>> indices;
+
+	RangeAllocator vertex_allocator, index_allocator;
+	DirtyRange dirty_vertices, dirty_indices;
+
+	int num_allocations = 0;
+};
+
+struct Allocation {
+	Page* page;
+	int vertex_offset, num_vertices;
+	int index_offset, num_indices;
+};
+
+
+class Arena {
+public:
+	Arena() {
+		constexpr size_t reserve_size = 512;
+		allocations.reserve(reserve_size);
+		free_list.reserve(reserve_size);
+	}
+
+	GeometryArenaHandle allocate(RenderInterface* render_interface, const Vertex* vertices, int num_vertices, const int* indices, int num_indices)
+	{
+		if (num_vertices <= 0 || num_indices <= 0 || num_vertices > page_vertex_capacity || num_indices > page_index_capacity)
+			return 0;
+
+		if (std::find(unsupported_interfaces.begin(), unsupported_interfaces.end(), render_interface) != unsupported_interfaces.end())
+			return 0;
+
+		Allocation allocation = {};
+
+		for (auto& page : pages)
+		{
+			if (page->render_interface != render_interface)
+				continue;
+
+			allocation.vertex_offset = page->vertex_allocator.Allocate(num_vertices);
+			if (allocation.vertex_offset < 0)
+				continue;
+
+			allocation.index_offset = page->index_allocator.Allocate(num_indices);
+			if (allocation.index_offset < 0)
+			{
+				page->vertex_allocator.Free(allocation.vertex_offset, num_vertices);
+				continue;
+			}
+
+			allocation.page = page.get();
+			break;
+		}
+
+		if (!allocation.page)
+		{
+			Page* page = create_page(render_interface);
+			if (!page)
+				return 0;
+
+			allocation.page = page;
+			allocation.vertex_offset = page->vertex_allocator.Allocate(num_vertices);
+			allocation.index_offset = page->index_allocator.Allocate(num_indices);
+		}
+
+		allocation.num_vertices = num_vertices;
+		allocation.num_indices = num_indices;
+
+		Page& page = *allocation.page;
+		std::copy(vertices, vertices + num_vertices, page.vertices.begin() + allocation.vertex_offset);
+		std::copy(indices, indices + num_indices, page.indices.begin() + allocation.index_offset);
+		page.dirty_vertices.Add(allocation.vertex_offset, num_vertices);
+		page.dirty_indices.Add(allocation.index_offset, num_indices);
+		page.num_allocations += 1;
+
+		GeometryArenaHandle handle;
+		if (free_list.empty())
+		{
+			allocations.push_back(allocation);
+			handle = GeometryArenaHandle(allocations.size());
+		}
+		else
+		{
+			handle = free_list.back();
+			free_list.pop_back();
+			allocations[handle - 1] = allocation;
+		}
+
+		return handle;
+	}
+
+	void free(GeometryArenaHandle handle)
+	{
+		RMLUI_ASSERT(handle > 0 && handle <= (GeometryArenaHandle)allocations.size());
+		Allocation& allocation = allocations[handle - 1];
+		Page* page = allocation.page;
+
+		page->vertex_allocator.Free(allocation.vertex_offset, allocation.num_vertices);
+		page->index_allocator.Free(allocation.index_offset, allocation.num_indices);
+		page->num_allocations -= 1;
+
+		allocation = {};
+		free_list.push_back(handle);
+
+		// Keep a single empty page around for each render interface, to avoid recreating pages when geometry is regenerated.
+		if (page->num_allocations == 0)
+		{
+			const bool other_empty_page = std::any_of(pages.begin(), pages.end(), [page](const UniquePtr<Page>& other) {
+				return other.get() != page && other->render_interface == page->render_interface && other->num_allocations == 0;
+			});
+
+			if (other_empty_page || !page->render_interface)
+				release_page(page);
+		}
+	}
+
+	void render(GeometryArenaHandle handle, RenderInterface* render_interface, TextureHandle texture, const Vector2f& translation)
+	{
+		RMLUI_ASSERT(handle > 0 && handle <= (GeometryArenaHandle)allocations.size());
+		const Allocation& allocation = allocations[handle - 1];
+		Page& page = *allocation.page;
+
+		if (page.render_interface == render_interface)
+		{
+			if (!page.handle)
+			{
+				// The page has been released, recreate it and submit its full contents.
+				page.handle = render_interface->CreateGeometryPage(page_vertex_capacity, page_index_capacity);
+				page.dirty_vertices.Add(0, page_vertex_capacity);
+				page.dirty_indices.Add(0, page_index_capacity);
+			}
+
+			if (page.handle)
+			{
+				upload(page);
+				render_interface->RenderGeometryPage(page.handle, allocation.vertex_offset, allocation.num_vertices, allocation.index_offset, allocation.num_indices, texture, translation);
+				return;
+			}
+		}
+
+		// The page is not available on this render interface, fall back to immediate mode rendering from the page data.
+		render_interface->RenderGeometry(&page.vertices[allocation.vertex_offset], allocation.num_vertices, &page.indices[allocation.index_offset], allocation.num_indices, texture, translation);
+	}
+
+	void upload_dirty_pages(RenderInterface* render_interface)
+	{
+		for (auto& page : pages)
+		{
+			if (page->render_interface == render_interface && page->handle)
+				upload(*page);
+		}
+	}
+
+	void release_all()
+	{
+		for (auto& page : pages)
+		{
+			if (page->handle && page->render_interface)
+				page->render_interface->ReleaseGeometryPage(page->handle);
+
+			page->handle = 0;
+			page->dirty_vertices.Clear();
+			page->dirty_indices.Clear();
+		}
+
+		remove_empty_pages();
+
+		// Give the render interfaces another chance, they may have been replaced or reconfigured.
+		unsupported_interfaces.clear();
+	}
+
+	void remove_render_interface(RenderInterface* render_interface)
+	{
+		// The render interface is being destroyed, so we can't call into it. Pages with live allocations are kept so that
+		// their geometry can still be freed, or rendered in immediate mode.
+		for (auto& page : pages)
+		{
+			if (page->render_interface == render_interface)
+			{
+				page->render_interface = nullptr;
+				page->handle = 0;
+			}
+		}
+
+		remove_empty_pages();
+
+		unsupported_interfaces.erase(std::remove(unsupported_interfaces.begin(), unsupported_interfaces.end(), render_interface), unsupported_interfaces.end());
+	}
+
+	void get_statistics(GeometryStatistics& statistics) const
+	{
+		statistics.num_paged_geometry += int(allocations.size() - free_list.size());
+		statistics.num_pages += int(pages.size());
+		statistics.page_memory += pages.size() * (page_vertex_capacity * sizeof(Vertex) + page_index_capacity * sizeof(int));
+		statistics.num_page_uploads += num_uploads;
+		statistics.page_upload_bytes += upload_bytes;
+	}
+
+private:
+	Page* create_page(RenderInterface* render_interface)
+	{
+		const GeometryPageHandle handle = render_interface->CreateGeometryPage(page_vertex_capacity, page_index_capacity);
+		if (!handle)
+		{
+			unsupported_interfaces.push_back(render_interface);
+			return nullptr;
+		}
+
+		pages.push_back(std::make_unique<Page>());
+		Page* page = pages.back().get();
+
+		page->render_interface = render_interface;
+		page->handle = handle;
+		page->vertices.resize(page_vertex_capacity);
+		page->indices.resize(page_index_capacity);
+		page->vertex_allocator.Initialise(page_vertex_capacity);
+		page->index_allocator.Initialise(page_index_capacity);
+
+		return page;
+	}
+
+	void release_page(Page* page)
+	{
+		if (page->handle && page->render_interface)
+			page->render_interface->ReleaseGeometryPage(page->handle);
+
+		auto it = std::find_if(pages.begin(), pages.end(), [page](const UniquePtr<Page>& other) { return other.get() == page; });
+		RMLUI_ASSERT(it != pages.end());
+		pages.erase(it);
+	}
+
+	void remove_empty_pages()
+	{
+		pages.erase(std::remove_if(pages.begin(), pages.end(), [](const UniquePtr<Page>& page) { return page->num_allocations == 0; }), pages.end());
+	}
+
+	void upload(Page& page)
+	{
+		if (page.dirty_vertices.IsEmpty() && page.dirty_indices.IsEmpty())
+			return;
+
+		const DirtyRange& dv = page.dirty_vertices;
+		const DirtyRange& di = page.dirty_indices;
+
+		page.render_interface->UpdateGeometryPage(page.handle,
+			page.vertices.data() + dv.begin, dv.begin, dv.end - dv.begin,
+			page.indices.data() + di.begin, di.begin, di.end - di.begin
+		);
+
+		num_uploads += 1;
+		upload_bytes += size_t(dv.end - dv.begin) * sizeof(Vertex) + size_t(di.end - di.begin) * sizeof(int);
+
+		page.dirty_vertices.Clear();
+		page.dirty_indices.Clear();
+	}
+
+	std::vector<UniquePtr<Page>> pages;
+
+	// List of all allocations, in addition to free slots. The handle of an allocation is its index plus one.
+	std::vector<Allocation> allocations;
+	// Declares free slots in the 'allocations' list as handles.
+	std::vector<GeometryArenaHandle> free_list;
+
+	// Render interfaces which have returned a null page, these render their geometry through the regular path.
+	std::vector<RenderInterface*> unsupported_interfaces;
+
+	size_t num_uploads = 0;
+	size_t upload_bytes = 0;
+};
+
+
+static Arena geometry_arena;
+
+GeometryArenaHandle Allocate(RenderInterface* render_interface, const Vertex* vertices, int num_vertices, const int* indices, int num_indices)
+{
+	return geometry_arena.allocate(render_interface, vertices, num_vertices, indices, num_indices);
+}
+
+void Free(GeometryArenaHandle handle)
+{
+	geometry_arena.free(handle);
+}
+
+void Render(GeometryArenaHandle handle, RenderInterface* render_interface, TextureHandle texture, const Vector2f& translation)
+{
+	geometry_arena.render(handle, render_interface, texture, translation);
+}
+
+void UploadDirtyPages(RenderInterface* render_interface)
+{
+	geometry_arena.upload_dirty_pages(render_interface);
+}
+
+void ReleaseAll()
+{
+	geometry_arena.release_all();
+}
+
+void RemoveRenderInterface(RenderInterface* render_interface)
+{
+	geometry_arena.remove_render_interface(render_interface);
+}
+
+void GetStatistics(GeometryStatistics& statistics)
+{
+	geometry_arena.get_statistics(statistics);
+}
+
+}
+}
+}
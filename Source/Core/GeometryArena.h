@@ -0,0 +1,79 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUICOREGEOMETRYARENA_H
+#define RMLUICOREGEOMETRYARENA_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+#include "../../Include/RmlUi/Core/Vertex.h"
+
+namespace Rml {
+namespace Core {
+
+class RenderInterface;
+struct GeometryStatistics;
+using GeometryArenaHandle = uint32_t;
+
+/**
+	The geometry arena stores the vertices and indices of geometry in large pages shared between many geometry objects.
+
+	Each page is created on the render interface as a single vertex and index buffer, and geometry is rendered as a
+	sub-range of its page. Modified ranges are tracked per page, so that only the dirty parts of each page are
+	submitted to the render interface. Pages are uploaded in bulk at the start of each frame, and otherwise only
+	before rendering geometry generated during the frame.
+
+	Paged geometry is only used when the render interface implements CreateGeometryPage().
+ */
+
+namespace GeometryArena {
+
+	/// Attempts to store the given geometry in a geometry page belonging to the render interface.
+	/// @return A handle to the stored geometry, or zero if geometry pages are not supported or the geometry does not fit in a page.
+	GeometryArenaHandle Allocate(RenderInterface* render_interface, const Vertex* vertices, int num_vertices, const int* indices, int num_indices);
+	/// Frees the range occupied by previously allocated geometry.
+	void Free(GeometryArenaHandle handle);
+
+	/// Renders previously allocated geometry, uploading the dirty ranges of its page first if necessary.
+	void Render(GeometryArenaHandle handle, RenderInterface* render_interface, TextureHandle texture, const Vector2f& translation);
+
+	/// Uploads the dirty ranges of all pages belonging to the given render interface.
+	void UploadDirtyPages(RenderInterface* render_interface);
+
+	/// Releases the render interface resources of all pages. The pages are recreated and fully uploaded on next use.
+	void ReleaseAll();
+	/// Forgets all pages belonging to a render interface which is being destroyed.
+	void RemoveRenderInterface(RenderInterface* render_interface);
+
+	/// Adds the page and upload statistics of the arena to the given statistics.
+	void GetStatistics(GeometryStatistics& statistics);
+}
+
+}
+}
+
+#endif
@@ -96,6 +96,11 @@ public:
 				func(geometry_list[i]);
 	}
 
+	size_t size() const
+	{
+		return geometry_list.size() - free_list.size();
+	}
+
 private:
 	// List of all active geometry, in addition to free slots.
 	// Free slots (as defined by the 'free_list') may contain dangling pointers and must not be dereferenced.
@@ -124,6 +129,19 @@ void ReleaseAll()
 	});
 }
 
+int GetNumGeometry()
+{
+	return (int)geometry_database.size();
+}
+
+void GetMemoryUsage(size_t& bytes, int& num_geometry)
+{
+	geometry_database.for_each([&bytes, &num_geometry](Geometry* geometry) {
+		bytes += sizeof(Geometry) + geometry->GetVertices().capacity() * sizeof(Vertex) + geometry->GetIndices().capacity() * sizeof(int);
+		num_geometry += 1;
+	});
+}
+
 
 
 #ifdef RMLUI_TESTS_ENABLED
@@ -29,6 +29,7 @@
 #ifndef RMLUICOREGEOMETRYDATABASE_H
 #define RMLUICOREGEOMETRYDATABASE_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 namespace Rml {
@@ -53,6 +54,11 @@ namespace GeometryDatabase {
 
     void ReleaseAll();
 
+    int GetNumGeometry();
+
+    // Sums the memory of all geometry objects and their vertex and index data.
+    void GetMemoryUsage(size_t& bytes, int& num_geometry);
+
 }
 
 }
@@ -28,7 +28,8 @@
 
 #include "LayoutEngine.h"
 #include "../../Include/RmlUi/Core/Math.h"
-#include "Pool.h"
+#include "ContextStatistics.h"
+#include "Memory.h"
 #include "LayoutBlockBoxSpace.h"
 #include "LayoutInlineBoxText.h"
 #include "../../Include/RmlUi/Core/Element.h"
@@ -43,15 +44,13 @@
 namespace Rml {
 namespace Core {
 
-#define MAX(a, b) (a > b ? a : b)
-
-struct LayoutChunk
+// Layout boxes only live for the duration of formatting, so they are allocated from a scratch arena which is rewound
+// once the outermost layout pass has destroyed all its boxes.
+static ScratchArena& GetLayoutArena()
 {
-	static const unsigned int size = MAX(sizeof(LayoutBlockBox), MAX(sizeof(LayoutInlineBox), MAX(sizeof(LayoutInlineBoxText), MAX(sizeof(LayoutLineBox), sizeof(LayoutBlockBoxSpace)))));
-	alignas(std::max_align_t) char buffer[size];
-};
-
-static Pool< LayoutChunk > layout_chunk_pool(200, true);
+	static ScratchArena layout_arena(32 * 1024, MemoryCategory::Layout);
+	return layout_arena;
+}
 
 LayoutEngine::LayoutEngine()
 {
@@ -72,6 +71,9 @@ bool LayoutEngine::FormatElement(Element* element, const Vector2f& containing_bl
 	RMLUI_ZoneName(name.c_str(), name.size());
 #endif
 
+	RMLUI_STATISTICS_COUNT(num_layouts_formatted, 1);
+	RMLUI_STATISTICS_TRACK_ELEMENT(formatted_elements, element);
+
 	block_box = new LayoutBlockBox(this, nullptr, nullptr);
 	block_box->GetBox().SetContent(containing_block);
 
@@ -261,15 +263,17 @@ float LayoutEngine::ClampHeight(float height, const ComputedValues& computed, fl
 
 void* LayoutEngine::AllocateLayoutChunk(size_t size)
 {
-	RMLUI_ASSERT(size <= LayoutChunk::size);
-	(void)size;
-	
-	return layout_chunk_pool.AllocateAndConstruct();
+	return GetLayoutArena().Allocate(size, alignof(std::max_align_t));
 }
 
 void LayoutEngine::DeallocateLayoutChunk(void* chunk)
 {
-	layout_chunk_pool.DestroyAndDeallocate((LayoutChunk*) chunk);
+	GetLayoutArena().Deallocate(chunk);
+}
+
+void LayoutEngine::ReleaseScratchMemory()
+{
+	GetLayoutArena().Release();
 }
 
 // Positions a single element and its children within this layout.
@@ -281,6 +285,9 @@ bool LayoutEngine::FormatElement(Element* element)
 	RMLUI_ZoneName(name.c_str(), name.size());
 #endif
 
+	RMLUI_STATISTICS_COUNT(num_elements_formatted, 1);
+	RMLUI_STATISTICS_TRACK_ELEMENT(formatted_elements, element);
+
 	auto& computed = element->GetComputedValues();
 
 	// Check if we have to do any special formatting for any elements that don't fit into the standard layout scheme.
@@ -80,8 +80,11 @@ public:
 	/// @return The clamped height.
 	static float ClampHeight(float height, const ComputedValues& computed, float containing_block_height);
 
+	/// Allocates and deallocates memory for layout boxes from the layout scratch arena.
 	static void* AllocateLayoutChunk(size_t size);
 	static void DeallocateLayoutChunk(void* chunk);
+	/// Returns the pages of the layout scratch arena to the memory interface.
+	static void ReleaseScratchMemory();
 
 private:
 	/// Positions a single element and its children within this layout.
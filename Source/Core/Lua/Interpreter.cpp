@@ -31,6 +31,7 @@
 #include <RmlUi/Core/Lua/Utilities.h>
 #include <RmlUi/Core/Log.h>
 #include <RmlUi/Core/FileInterface.h>
+#include <RmlUi/Core/MemoryStatistics.h>
 #include <RmlUi/Core/Lua/LuaType.h>
 #include "LuaDocumentElementInstancer.h"
 #include <RmlUi/Core/Factory.h>
@@ -55,6 +56,7 @@
 #include "ElementText.h"
 #include "GlobalLuaFunctions.h"
 #include "RmlUiContextsProxy.h"
+#include <stdlib.h>
 
 namespace Rml {
 namespace Core {
@@ -65,6 +67,37 @@ static lua_State* g_L = nullptr;
 //typedefs for nicer Lua names
 typedef Rml::Core::ElementDocument Document;
 
+// Allocator for the Lua state owned by the interpreter, which accounts the heap to the Lua memory category.
+static void* LuaAllocate(void* /*user_data*/, void* ptr, size_t old_size, size_t new_size)
+{
+	// When ptr is null, old_size holds the type of the object being allocated rather than a size.
+	if (ptr)
+		Memory::TrackDeallocation(MemoryCategory::Lua, old_size);
+
+	if (new_size == 0)
+	{
+		free(ptr);
+		return nullptr;
+	}
+
+	void* result = realloc(ptr, new_size);
+
+	if (result)
+		Memory::TrackAllocation(MemoryCategory::Lua, new_size);
+	else if (ptr)
+		Memory::TrackAllocation(MemoryCategory::Lua, old_size);
+
+	return result;
+}
+
+// Logs errors raised outside of any protected call, as luaL_newstate would have done.
+static int LuaPanic(lua_State* L)
+{
+	const char* message = lua_tostring(L, -1);
+	Log::Message(Log::LT_ERROR, "Unprotected error in call to Lua API: %s", message ? message : "");
+	return 0;
+}
+
 
 void Interpreter::Initialise()
 {
@@ -192,7 +225,8 @@ void Interpreter::OnInitialise()
 	if (g_L == nullptr)
 	{
 		Log::Message(Log::LT_INFO, "Loading Lua interpreter");
-		g_L = luaL_newstate();
+		g_L = lua_newstate(LuaAllocate, nullptr);
+		lua_atpanic(g_L, LuaPanic);
 		luaL_openlibs(g_L);
 		owns_lua_state = true;
 	}
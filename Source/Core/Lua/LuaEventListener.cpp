@@ -37,16 +37,19 @@ namespace Core {
 namespace Lua {
 typedef Rml::Core::ElementDocument Document;
 
-LuaEventListener::LuaEventListener(const String& code, Element* element) : EventListener()
+struct CompiledFunction
 {
-    //compose function
-    String function = "return function (event,element,document) ";
-    function.append(code);
-    function.append(" end");
+    int ref;
+    int num_listeners;
+};
+typedef UnorderedMap< String, CompiledFunction > CompiledFunctionMap;
 
-    //make sure there is an area to save the function
-    lua_State* L = Interpreter::GetLuaState();
-    int top = lua_gettop(L);
+//functions compiled from inline code, shared by all listeners with the same code in the same document
+static UnorderedMap< ElementDocument*, CompiledFunctionMap > compiled_functions;
+
+//pushes the table holding the listener functions, creating it if necessary
+static void PushFunctionTable(lua_State* L)
+{
     lua_getglobal(L,"EVENTLISTENERFUNCTIONS");
     if(lua_isnoneornil(L,-1))
     {
@@ -55,12 +58,55 @@ LuaEventListener::LuaEventListener(const String& code, Element* element) : Event
         lua_pop(L,1); //pop the unsucessful getglobal
         lua_getglobal(L,"EVENTLISTENERFUNCTIONS");
     }
+}
+
+LuaEventListener::LuaEventListener(const String& code, Element* element) : EventListener()
+{
+    attached = element;
+	if(element)
+		owner_document = element->GetOwnerDocument();
+	else
+		owner_document = nullptr;
+
+    //compose function
+    String function = "return function (event,element,document) ";
+    function.append(code);
+    function.append(" end");
+    strFunc = function;
+
+    //the element is passed as an argument, so the function can be shared with other listeners of the same code, but
+    //only within a document; listeners without one get a function of their own
+    if(owner_document)
+    {
+        compiled_document = owner_document;
+        compiled_code = code;
+        compiled = true;
+
+        auto it_document = compiled_functions.find(compiled_document);
+        if(it_document != compiled_functions.end())
+        {
+            auto it = it_document->second.find(code);
+            if(it != it_document->second.end())
+            {
+                it->second.num_listeners += 1;
+                luaFuncRef = it->second.ref;
+                return;
+            }
+        }
+    }
+
+    //make sure there is an area to save the function
+    lua_State* L = Interpreter::GetLuaState();
+    int top = lua_gettop(L);
+    PushFunctionTable(L);
     int tbl = lua_gettop(L);
 
     //compile,execute,and save the function
     if(luaL_loadstring(L,function.c_str()) != 0)
     {
         Report(L);
+        compiled = false;
+        lua_settop(L,top);
         return;
     }
     else
@@ -68,18 +114,17 @@ LuaEventListener::LuaEventListener(const String& code, Element* element) : Event
         if(lua_pcall(L,0,1,0) != 0)
         {
             Report(L);
+            compiled = false;
+            lua_settop(L,top);
             return;
         }
     }
     luaFuncRef = luaL_ref(L,tbl); //creates a reference to the item at the top of the stack in to the table we just created
     lua_pop(L,1); //pop the EVENTLISTENERFUNCTIONS table
 
-    attached = element;
-	if(element)
-		owner_document = element->GetOwnerDocument();
-	else
-		owner_document = nullptr;
-    strFunc = function;
+    if(compiled)
+        compiled_functions[compiled_document][code] = CompiledFunction{ luaFuncRef, 1 };
+
     lua_settop(L,top);
 }
 
@@ -87,14 +132,7 @@ LuaEventListener::LuaEventListener(const String& code, Element* element) : Event
 LuaEventListener::LuaEventListener(lua_State* L, int narg, Element* element)
 {
     int top = lua_gettop(L);
-    lua_getglobal(L,"EVENTLISTENERFUNCTIONS");
-	if(lua_isnoneornil(L,-1))
-	{
-		lua_newtable(L);
-		lua_setglobal(L,"EVENTLISTENERFUNCTIONS");
-		lua_pop(L,1); //pop the unsucessful getglobal
-		lua_getglobal(L,"EVENTLISTENERFUNCTIONS");
-	}
+    PushFunctionTable(L);
 	lua_pushvalue(L,narg);
 	luaFuncRef = luaL_ref(L,-2); //put the funtion as a ref in to that table
 	lua_pop(L,1); //pop the EVENTLISTENERFUNCTIONS table
@@ -109,6 +147,23 @@ LuaEventListener::LuaEventListener(lua_State* L, int narg, Element* element)
 
 LuaEventListener::~LuaEventListener()
 {
+	if (compiled)
+	{
+		// Functions compiled from code are shared, only remove it with its last listener
+		auto it_document = compiled_functions.find(compiled_document);
+		if (it_document == compiled_functions.end())
+			return;
+
+		CompiledFunctionMap& functions = it_document->second;
+		auto it = functions.find(compiled_code);
+		if (it == functions.end() || --it->second.num_listeners > 0)
+			return;
+
+		functions.erase(it);
+		if (functions.empty())
+			compiled_functions.erase(it_document);
+	}
+
 	// Remove the Lua function from its table
 	lua_State* L = Interpreter::GetLuaState();
 	lua_getglobal(L, "EVENTLISTENERFUNCTIONS");
@@ -40,7 +40,8 @@ class LuaEventListener : public EventListener
 {
 public:
     //The plan is to wrap the code in an anonymous function so that we can have named parameters to use,
-    //rather than putting them in global variables
+    //rather than putting them in global variables. The function is compiled once for each code string and
+    //document, and shared by all the listeners using it. Listeners without a document compile their own.
     LuaEventListener(const String& code, Element* element);
 
     //This is called from a Lua Element if in element:AddEventListener it passes a function in as the 2nd
@@ -64,6 +65,11 @@ private:
     Element* attached = nullptr;
     ElementDocument* owner_document = nullptr;
     String strFunc; //for debugging purposes
+
+    //set if the function was compiled from code, and is shared with the other listeners of the same code and document
+    bool compiled = false;
+    ElementDocument* compiled_document = nullptr;
+    String compiled_code;
 };
 
 }
@@ -27,6 +27,8 @@
  */
 
 #include "Memory.h"
+#include <algorithm>
+#include <cstddef>
 #include <memory>
 #include <stdlib.h>
 #include <stdint.h>
@@ -95,5 +97,118 @@ BasicStackAllocator& GetGlobalBasicStackAllocator()
 
 }
 
+
+ScratchArena::ScratchArena(size_t page_size, MemoryCategory category) : page_size(page_size), category(category)
+{}
+
+ScratchArena::~ScratchArena() noexcept
+{
+	Release();
+}
+
+void* ScratchArena::Allocate(size_t byte_size, size_t alignment)
+{
+	void* ptr = cursor;
+	size_t available_space = size_t(end - cursor);
+
+	if (!cursor || !Detail::rmlui_align(alignment, byte_size, ptr, available_space))
+	{
+		if (!NextPage(byte_size, alignment))
+			return nullptr;
+
+		ptr = cursor;
+		available_space = size_t(end - cursor);
+		Detail::rmlui_align(alignment, byte_size, ptr, available_space);
+	}
+
+	cursor = (byte*)ptr + byte_size;
+
+	num_live_allocations += 1;
+	Memory::TrackAllocation(category, 0, 1);
+
+	return ptr;
+}
+
+void ScratchArena::Deallocate(void* ptr) noexcept
+{
+	if (!ptr)
+		return;
+
+	RMLUI_ASSERT(num_live_allocations > 0);
+	num_live_allocations -= 1;
+	Memory::TrackDeallocation(category, 0, 1);
+
+	if (num_live_allocations == 0)
+		Rewind();
+}
+
+void ScratchArena::Release() noexcept
+{
+	RMLUI_ASSERTMSG(num_live_allocations == 0, "Scratch arena released while its memory is still in use.");
+
+	Page* page = first_page;
+	while (page)
+	{
+		Page* next_page = page->next;
+		const size_t page_byte_size = page_header_size + page->byte_size;
+
+		page->memory_interface->Deallocate(page, page_byte_size, alignof(std::max_align_t), category);
+		Memory::TrackDeallocation(category, page_byte_size, 0);
+
+		page = next_page;
+	}
+
+	first_page = nullptr;
+	capacity = 0;
+	Rewind();
+}
+
+bool ScratchArena::NextPage(size_t byte_size, size_t alignment)
+{
+	// Make room for aligning the allocation within the page.
+	const size_t required_size = byte_size + (alignment > alignof(std::max_align_t) ? alignment : 0);
+
+	Page* next_page = (current_page ? current_page->next : first_page);
+
+	if (!next_page || next_page->byte_size < required_size)
+	{
+		const size_t new_byte_size = std::max(page_size, required_size);
+		const size_t page_byte_size = page_header_size + new_byte_size;
+
+		MemoryInterface* memory_interface = GetMemoryInterface();
+		void* memory = memory_interface->Allocate(page_byte_size, alignof(std::max_align_t), category);
+		if (!memory)
+			return false;
+
+		Memory::TrackAllocation(category, page_byte_size, 0);
+		capacity += new_byte_size;
+
+		Page* new_page = reinterpret_cast<Page*>(memory);
+		new_page->byte_size = new_byte_size;
+		new_page->memory_interface = memory_interface;
+		new_page->next = next_page;
+
+		if (current_page)
+			current_page->next = new_page;
+		else
+			first_page = new_page;
+
+		next_page = new_page;
+	}
+
+	current_page = next_page;
+	cursor = (byte*)current_page + page_header_size;
+	end = cursor + current_page->byte_size;
+
+	return true;
+}
+
+void ScratchArena::Rewind() noexcept
+{
+	current_page = nullptr;
+	cursor = nullptr;
+	end = nullptr;
+}
+
 }
 }
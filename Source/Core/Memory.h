@@ -30,6 +30,9 @@
 #define RMLUICOREMEMORY_H
 
 
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/Debug.h"
+#include "../../Include/RmlUi/Core/MemoryInterface.h"
 #include "../../Include/RmlUi/Core/Types.h"
 #include "../../Include/RmlUi/Core/Traits.h"
 
@@ -108,6 +111,92 @@ bool operator!=(const GlobalStackAllocator<T>&, const GlobalStackAllocator<U>&)
 
 
 
+/**
+	Standard library allocator which allocates its memory through RmlUi's memory interface.
+
+	The memory interface can not change after initialisation, thus containers using this allocator must not outlive
+	the call to Core::Shutdown.
+*/
+
+template <typename T, MemoryCategory Category>
+class MemoryInterfaceAllocator
+{
+public:
+	using value_type = T;
+	template <class U> struct rebind { using other = MemoryInterfaceAllocator<U, Category>; };
+
+	MemoryInterfaceAllocator() = default;
+	template <class U> constexpr MemoryInterfaceAllocator(const MemoryInterfaceAllocator<U, Category>&) noexcept {}
+
+	T* allocate(size_t num_objects) {
+		void* ptr = GetMemoryInterface()->Allocate(num_objects * sizeof(T), alignof(T), Category);
+		RMLUI_ASSERTMSG(ptr, "Memory interface failed to allocate memory.");
+		return reinterpret_cast<T*>(ptr);
+	}
+
+	void deallocate(T* ptr, size_t num_objects) noexcept {
+		GetMemoryInterface()->Deallocate(ptr, num_objects * sizeof(T), alignof(T), Category);
+	}
+};
+
+template <class T, class U, MemoryCategory Category>
+bool operator==(const MemoryInterfaceAllocator<T, Category>&, const MemoryInterfaceAllocator<U, Category>&) { return true; }
+template <class T, class U, MemoryCategory Category>
+bool operator!=(const MemoryInterfaceAllocator<T, Category>&, const MemoryInterfaceAllocator<U, Category>&) { return false; }
+
+
+
+/**
+	Scratch arena.
+
+	Allocates memory for short-lived objects by bumping a pointer through pages allocated from the memory interface.
+	Deallocation only counts down the number of live allocations, once they are all gone the arena is rewound and its
+	pages are reused. Thus, memory is reclaimed once every temporary object has been destroyed, such as after each
+	layout pass.
+*/
+
+class ScratchArena : NonCopyMoveable {
+public:
+	ScratchArena(size_t page_size, MemoryCategory category);
+	~ScratchArena() noexcept;
+
+	void* Allocate(size_t byte_size, size_t alignment);
+	void Deallocate(void* ptr) noexcept;
+
+	/// Returns all pages to the memory interface. There must not be any live allocations.
+	void Release() noexcept;
+
+	/// Returns the number of bytes in the arena's pages.
+	size_t GetCapacity() const { return capacity; }
+
+private:
+	struct Page {
+		Page* next;
+		size_t byte_size;
+		MemoryInterface* memory_interface;
+	};
+
+	// The page header is placed in front of the page's memory, padded to keep the memory maximally aligned.
+	static constexpr size_t page_header_size = (sizeof(Page) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+
+	// Makes a page with room for the given allocation current, reusing the following page if it is large enough.
+	bool NextPage(size_t byte_size, size_t alignment);
+	void Rewind() noexcept;
+
+	const size_t page_size;
+	const MemoryCategory category;
+
+	Page* first_page = nullptr;
+	Page* current_page = nullptr;
+	byte* cursor = nullptr;
+	byte* end = nullptr;
+
+	size_t capacity = 0;
+	int num_live_allocations = 0;
+};
+
+
+
 /**
 	A poor man's dynamic array.
 
@@ -0,0 +1,80 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#include "../../Include/RmlUi/Core/MemoryInterface.h"
+#include "../../Include/RmlUi/Core/Debug.h"
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace Rml {
+namespace Core {
+
+MemoryInterface::MemoryInterface()
+{
+}
+
+MemoryInterface::~MemoryInterface()
+{
+}
+
+// Allocates a block of memory using malloc, over-allocating to satisfy alignments stricter than malloc provides.
+void* MemoryInterface::Allocate(size_t size, size_t alignment, MemoryCategory RMLUI_UNUSED_PARAMETER(category))
+{
+	RMLUI_UNUSED(category);
+	RMLUI_ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+	if (alignment <= alignof(std::max_align_t))
+		return malloc(size);
+
+	// Store the pointer returned by malloc right in front of the aligned block.
+	void* base = malloc(size + alignment + sizeof(void*));
+	if (!base)
+		return nullptr;
+
+	const uintptr_t aligned = (reinterpret_cast<uintptr_t>(base) + sizeof(void*) + alignment - 1) & ~(uintptr_t)(alignment - 1);
+	reinterpret_cast<void**>(aligned)[-1] = base;
+
+	return reinterpret_cast<void*>(aligned);
+}
+
+// Deallocates a block of memory previously allocated by the default implementation.
+void MemoryInterface::Deallocate(void* ptr, size_t RMLUI_UNUSED_PARAMETER(size), size_t alignment, MemoryCategory RMLUI_UNUSED_PARAMETER(category))
+{
+	RMLUI_UNUSED(size);
+	RMLUI_UNUSED(category);
+
+	if (!ptr)
+		return;
+
+	if (alignment <= alignof(std::max_align_t))
+		free(ptr);
+	else
+		free(reinterpret_cast<void**>(ptr)[-1]);
+}
+
+}
+}
@@ -0,0 +1,144 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../../Include/RmlUi/Core/MemoryStatistics.h"
+#include "../../Include/RmlUi/Core/Geometry.h"
+#include "../../Include/RmlUi/Core/Log.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include "GeometryDatabase.h"
+
+namespace Rml {
+namespace Core {
+namespace Memory {
+
+static MemoryCategoryStatistics categories[(size_t)MemoryCategory::Count];
+
+// Set while a category is above its budget, so that the warning is only logged once each time it is exceeded.
+static bool over_budget[(size_t)MemoryCategory::Count] = {};
+
+static const char* category_names[(size_t)MemoryCategory::Count] = {
+	"elements", "layout", "geometry", "style sheets", "fonts", "font textures", "textures", "lua", "other"
+};
+
+// Logs a warning when a category exceeds its budget.
+static void CheckBudget(MemoryCategory category, size_t bytes)
+{
+	const size_t index = (size_t)category;
+	const size_t budget = categories[index].budget;
+
+	if (budget > 0 && bytes > budget)
+	{
+		if (!over_budget[index])
+		{
+			over_budget[index] = true;
+			Log::Message(Log::LT_WARNING, "Memory budget for %s exceeded, %zu bytes in use of a budget of %zu bytes.", category_names[index], bytes, budget);
+		}
+	}
+	else
+	{
+		over_budget[index] = false;
+	}
+}
+
+void TrackAllocation(MemoryCategory category, size_t bytes, int num_objects)
+{
+	MemoryCategoryStatistics& statistics = categories[(size_t)category];
+	statistics.bytes += bytes;
+	statistics.num_objects += num_objects;
+
+	if (statistics.bytes > statistics.peak_bytes)
+		statistics.peak_bytes = statistics.bytes;
+
+	if (statistics.budget > 0)
+		CheckBudget(category, statistics.bytes);
+}
+
+void TrackDeallocation(MemoryCategory category, size_t bytes, int num_objects)
+{
+	MemoryCategoryStatistics& statistics = categories[(size_t)category];
+	RMLUI_ASSERT(statistics.bytes >= bytes && statistics.num_objects >= num_objects);
+
+	statistics.bytes -= bytes;
+	statistics.num_objects -= num_objects;
+
+	if (over_budget[(size_t)category])
+		CheckBudget(category, statistics.bytes);
+}
+
+void SetBudget(MemoryCategory category, size_t bytes)
+{
+	categories[(size_t)category].budget = bytes;
+	over_budget[(size_t)category] = false;
+}
+
+bool IsOverBudget()
+{
+	const MemoryStatistics statistics = GetStatistics();
+
+	for (const MemoryCategoryStatistics& category : statistics.categories)
+	{
+		if (category.budget > 0 && category.bytes > category.budget)
+			return true;
+	}
+
+	return false;
+}
+
+MemoryStatistics GetStatistics()
+{
+	MemoryStatistics statistics;
+	for (size_t i = 0; i < (size_t)MemoryCategory::Count; i++)
+		statistics.categories[i] = categories[i];
+
+	// Geometry is resized in too many places to track, instead it is measured here.
+	MemoryCategoryStatistics& geometry = statistics.categories[(size_t)MemoryCategory::Geometry];
+	size_t geometry_bytes = 0;
+	int num_geometry = 0;
+	GeometryDatabase::GetMemoryUsage(geometry_bytes, num_geometry);
+	geometry_bytes += Geometry::GetStatistics().page_memory;
+
+	geometry.bytes += geometry_bytes;
+	geometry.num_objects += num_geometry;
+	geometry.peak_bytes = Math::Max(geometry.peak_bytes, geometry.bytes);
+
+	if (geometry.budget > 0)
+		CheckBudget(MemoryCategory::Geometry, geometry.bytes);
+
+	return statistics;
+}
+
+const char* GetCategoryName(MemoryCategory category)
+{
+	if ((size_t)category < (size_t)MemoryCategory::Count)
+		return category_names[(size_t)category];
+	return "";
+}
+
+}
+}
+}
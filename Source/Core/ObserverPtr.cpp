@@ -36,7 +36,7 @@ namespace Core {
 static Pool< ObserverPtrBlock >& GetPool()
 {
 	// Wrap pool in a function to ensure it is initialized before use.
-	static Pool< ObserverPtrBlock > pool(400, true);
+	static Pool< ObserverPtrBlock > pool(400, true, MemoryCategory::Elements);
 	return pool;
 }
 
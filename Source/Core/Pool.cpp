@@ -0,0 +1,64 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#include "Pool.h"
+
+namespace Rml {
+namespace Core {
+
+PoolBase* PoolBase::first_pool = nullptr;
+
+PoolBase::PoolBase()
+{
+	previous_pool = nullptr;
+	next_pool = first_pool;
+
+	if (first_pool)
+		first_pool->previous_pool = this;
+	first_pool = this;
+}
+
+PoolBase::~PoolBase()
+{
+	if (previous_pool)
+		previous_pool->next_pool = next_pool;
+	else
+		first_pool = next_pool;
+
+	if (next_pool)
+		next_pool->previous_pool = previous_pool;
+}
+
+// Returns the chunks of all pools without any allocated objects to the memory interface.
+void PoolBase::ReleaseUnusedChunks()
+{
+	for (PoolBase* pool = first_pool; pool; pool = pool->next_pool)
+		pool->ReleaseChunksIfUnused();
+}
+
+}
+}
@@ -30,15 +30,44 @@
 #define RMLUICOREPOOL_H
 
 #include "../../Include/RmlUi/Core/Header.h"
+#include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/Debug.h"
+#include "../../Include/RmlUi/Core/MemoryInterface.h"
+#include "../../Include/RmlUi/Core/MemoryStatistics.h"
 #include "../../Include/RmlUi/Core/Traits.h"
 #include "../../Include/RmlUi/Core/Types.h"
 
 namespace Rml {
 namespace Core {
 
+class MemoryInterface;
+
+/**
+	Keeps track of all pools, so that their memory can be returned to the memory interface on shutdown.
+ */
+
+class PoolBase : public NonCopyMoveable
+{
+public:
+	/// Returns the chunks of all pools without any allocated objects to the memory interface.
+	static void ReleaseUnusedChunks();
+
+protected:
+	PoolBase();
+	virtual ~PoolBase();
+
+	/// Releases the chunks of the pool if none of its objects are allocated.
+	virtual void ReleaseChunksIfUnused() = 0;
+
+private:
+	PoolBase* previous_pool;
+	PoolBase* next_pool;
+
+	static PoolBase* first_pool;
+};
+
 template < typename PoolType >
-class Pool
+class Pool : public PoolBase
 {
 private:
 	static constexpr size_t N = sizeof(PoolType);
@@ -57,6 +86,8 @@ private:
 	public:
 		PoolNode* chunk;
 		PoolChunk* next;
+		// The interface the chunk was allocated from.
+		MemoryInterface* memory_interface;
 	};
 
 public:
@@ -107,10 +138,11 @@ public:
 		PoolNode* node;
 	};
 
-	Pool(int chunk_size = 0, bool grow = false);
+	/// @param[in] category The memory category the pool's chunks and objects are accounted to.
+	Pool(int chunk_size = 0, bool grow = false, MemoryCategory category = MemoryCategory::Other);
 	~Pool();
 
-	/// Initialises the pool to a given size.
+	/// Initialises the pool to a given size. The first chunk is allocated on first use.
 	void Initialise(int chunk_size, bool grow = false);
 
 	/// Returns the head of the linked list of allocated objects.
@@ -134,12 +166,22 @@ public:
 	/// Returns the number of allocated objects in the pool.
 	inline int GetNumAllocatedObjects() const;
 
+protected:
+	void ReleaseChunksIfUnused() override;
+
 private:
 	// Creates a new pool chunk and appends its nodes to the beginning of the free list.
 	void CreateChunk();
+	// Returns all chunks to the memory interface.
+	void ReleaseChunks();
+
+	// The chunk header is placed in front of its nodes, padded to the alignment of the nodes.
+	static constexpr size_t GetChunkHeaderSize() { return (sizeof(PoolChunk) + alignof(PoolNode) - 1) / alignof(PoolNode) * alignof(PoolNode); }
+	size_t GetChunkByteSize() const { return GetChunkHeaderSize() + size_t(chunk_size) * sizeof(PoolNode); }
 
 	int chunk_size;
 	bool grow;
+	MemoryCategory category;
 
 	PoolChunk* pool;
 
@@ -32,10 +32,11 @@ namespace Rml {
 namespace Core {
 
 template < typename PoolType >
-Pool< PoolType >::Pool(int _chunk_size, bool _grow)
+Pool< PoolType >::Pool(int _chunk_size, bool _grow, MemoryCategory _category)
 {
 	chunk_size = 0;
 	grow = _grow;
+	category = _category;
 
 	num_allocated_objects = 0;
 
@@ -50,16 +51,9 @@ Pool< PoolType >::Pool(int _chunk_size, bool _grow)
 template < typename PoolType >
 Pool< PoolType >::~Pool()
 {
-	PoolChunk* chunk = pool;
-	while (chunk)
-	{
-		PoolChunk* next_chunk = chunk->next;
-
-		delete[] chunk->chunk;
-		delete chunk;
+	ReleaseChunks();
 
-		chunk = next_chunk;
-	}
+	Memory::TrackDeallocation(category, 0, num_allocated_objects);
 }
 
 // Initialises the pool to a given size.
@@ -76,9 +70,6 @@ void Pool< PoolType >::Initialise(int _chunk_size, bool _grow)
 	grow = _grow;
 	chunk_size = _chunk_size;
 	pool = nullptr;
-
-	// Create the initial chunk.
-	CreateChunk();
 }
 
 // Returns the head of the linked list of allocated objects.
@@ -96,8 +87,8 @@ inline PoolType* Pool<PoolType>::AllocateAndConstruct(Args&&... args)
 	// We can't allocate a new object if the deallocated list is empty.
 	if (first_free_node == nullptr)
 	{
-		// Attempt to grow the pool first.
-		if (grow)
+		// Attempt to grow the pool first, or create the initial chunk.
+		if (grow || pool == nullptr)
 		{
 			CreateChunk();
 			if (first_free_node == nullptr)
@@ -109,6 +100,7 @@ inline PoolType* Pool<PoolType>::AllocateAndConstruct(Args&&... args)
 
 	// We're about to allocate an object.
 	++num_allocated_objects;
+	Memory::TrackAllocation(category, 0, 1);
 
 	// This one!
 	PoolNode* allocated_object = first_free_node;
@@ -143,6 +135,7 @@ void Pool< PoolType >::DestroyAndDeallocate(Iterator& iterator)
 {
 	// We're about to deallocate an object.
 	--num_allocated_objects;
+	Memory::TrackDeallocation(category, 0, 1);
 
 	PoolNode* object = iterator.node;
 	reinterpret_cast<PoolType*>(object->object)->~PoolType();
@@ -228,17 +221,28 @@ void Pool< PoolType >::CreateChunk()
 	if (chunk_size <= 0)
 		return;
 
+	// Allocate the chunk header and its pool nodes in a single block.
+	MemoryInterface* memory_interface = GetMemoryInterface();
+	void* memory = memory_interface->Allocate(GetChunkByteSize(), alignof(PoolNode), category);
+	if (!memory)
+		return;
+
+	Memory::TrackAllocation(category, GetChunkByteSize(), 0);
+
 	// Create the new chunk and mark it as the first chunk.
-	PoolChunk* new_chunk = new PoolChunk();
+	PoolChunk* new_chunk = new (memory) PoolChunk();
 	new_chunk->next = pool;
+	new_chunk->memory_interface = memory_interface;
 	pool = new_chunk;
 
 	// Create chunk's pool nodes.
-	new_chunk->chunk = new PoolNode[chunk_size];
+	new_chunk->chunk = reinterpret_cast<PoolNode*>(reinterpret_cast<unsigned char*>(memory) + GetChunkHeaderSize());
 
 	// Initialise the linked list.
 	for (int i = 0; i < chunk_size; i++)
 	{
+		new (&new_chunk->chunk[i]) PoolNode;
+
 		if (i == 0)
 			new_chunk->chunk[i].previous = nullptr ;
 		else
@@ -253,5 +257,37 @@ void Pool< PoolType >::CreateChunk()
 	first_free_node = new_chunk->chunk;
 }
 
+// Releases the chunks of the pool if none of its objects are allocated.
+template < typename PoolType >
+void Pool< PoolType >::ReleaseChunksIfUnused()
+{
+	if (num_allocated_objects == 0)
+		ReleaseChunks();
+}
+
+// Returns all chunks to the memory interface.
+template < typename PoolType >
+void Pool< PoolType >::ReleaseChunks()
+{
+	const size_t chunk_byte_size = GetChunkByteSize();
+
+	PoolChunk* chunk = pool;
+	while (chunk)
+	{
+		PoolChunk* next_chunk = chunk->next;
+		MemoryInterface* memory_interface = chunk->memory_interface;
+
+		chunk->~PoolChunk();
+		memory_interface->Deallocate(chunk, chunk_byte_size, alignof(PoolNode), category);
+		Memory::TrackDeallocation(category, chunk_byte_size, 0);
+
+		chunk = next_chunk;
+	}
+
+	pool = nullptr;
+	first_allocated_node = nullptr;
+	first_free_node = nullptr;
+}
+
 }
 }
@@ -0,0 +1,132 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "PropertyParseCache.h"
+#include "../../Include/RmlUi/Core/PropertyDictionary.h"
+#include "../../Include/RmlUi/Core/Transform.h"
+
+namespace Rml {
+namespace Core {
+
+// Maximum number of declarations held by the cache.
+static constexpr size_t MAX_NUM_DECLARATIONS = 2048;
+// Longer values are parsed every time.
+static constexpr size_t MAX_VALUE_LENGTH = 128;
+
+PropertyParseCache::PropertyParseCache()
+{
+}
+
+PropertyParseCache::~PropertyParseCache()
+{
+}
+
+PropertyParseCacheKey PropertyParseCache::CreateKey(PropertyId property_id, const String& value)
+{
+	return PropertyParseCacheKey{ uint32_t(property_id), value };
+}
+
+PropertyParseCacheKey PropertyParseCache::CreateKey(ShorthandId shorthand_id, const String& value)
+{
+	return PropertyParseCacheKey{ uint32_t(PropertyId::MaxNumIds) + uint32_t(shorthand_id), value };
+}
+
+bool PropertyParseCache::IsCacheable(const String& value)
+{
+	return value.size() <= MAX_VALUE_LENGTH;
+}
+
+bool PropertyParseCache::Find(const PropertyParseCacheKey& key, PropertyDictionary& dictionary)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	auto it = declarations.find(key);
+	if (it == declarations.end())
+	{
+		statistics.num_misses += 1;
+		return false;
+	}
+
+	statistics.num_hits += 1;
+
+	for (const auto& id_property : it->second)
+		dictionary.SetProperty(id_property.first, CopyProperty(id_property.second));
+
+	return true;
+}
+
+void PropertyParseCache::Insert(PropertyParseCacheKey&& key, const PropertyDictionary& properties)
+{
+	PropertyList property_list;
+	property_list.reserve(properties.GetNumProperties());
+
+	for (const auto& id_property : properties.GetProperties())
+		property_list.emplace_back(id_property.first, CopyProperty(id_property.second));
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	if (declarations.size() >= MAX_NUM_DECLARATIONS)
+	{
+		declarations.clear();
+		statistics.num_evictions += 1;
+	}
+
+	declarations.emplace(std::move(key), std::move(property_list));
+}
+
+void PropertyParseCache::Clear()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	declarations.clear();
+}
+
+PropertyParseCacheStatistics PropertyParseCache::GetStatistics() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	PropertyParseCacheStatistics result = statistics;
+	result.num_entries = (int)declarations.size();
+	return result;
+}
+
+Property PropertyParseCache::CopyProperty(const Property& property)
+{
+	Property result = property;
+
+	// Transforms may be modified in place when they are animated, so each copy needs its own instance.
+	if (property.unit == Property::TRANSFORM)
+	{
+		if (const TransformPtr& transform = property.value.GetReference<TransformPtr>())
+			result.value = std::make_shared<Transform>(*transform);
+	}
+
+	return result;
+}
+
+}
+}
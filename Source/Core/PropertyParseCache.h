@@ -0,0 +1,115 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUICOREPROPERTYPARSECACHE_H
+#define RMLUICOREPROPERTYPARSECACHE_H
+
+#include "../../Include/RmlUi/Core/Property.h"
+#include "../../Include/RmlUi/Core/PropertySpecification.h"
+#include "../../Include/RmlUi/Core/Types.h"
+#include "Utilities.h"
+#include <mutex>
+
+namespace Rml {
+namespace Core {
+
+class PropertyDictionary;
+
+struct PropertyParseCacheKey {
+	// The property or shorthand id, shorthands are offset by the maximum number of property ids.
+	uint32_t id;
+	String value;
+
+	bool operator==(const PropertyParseCacheKey& other) const { return id == other.id && value == other.value; }
+};
+
+}
+}
+
+namespace std {
+template <> struct hash<::Rml::Core::PropertyParseCacheKey> {
+	size_t operator()(const ::Rml::Core::PropertyParseCacheKey& key) const
+	{
+		size_t seed = std::hash<uint32_t>()(key.id);
+		::Rml::Core::Utilities::HashCombine(seed, key.value);
+		return seed;
+	}
+};
+}
+
+namespace Rml {
+namespace Core {
+
+/**
+	A cache of parsed property declarations, keyed on the property or shorthand id and the value string.
+
+	Only successful parses are cached. The cache is bounded, once full it is emptied before new declarations are added.
+	All functions may be called from multiple threads.
+ */
+
+class PropertyParseCache
+{
+public:
+	PropertyParseCache();
+	~PropertyParseCache();
+
+	/// Returns the key for a property or shorthand declaration.
+	static PropertyParseCacheKey CreateKey(PropertyId property_id, const String& value);
+	static PropertyParseCacheKey CreateKey(ShorthandId shorthand_id, const String& value);
+
+	/// Returns true if the value can be cached, very long values such as lists of decorators are not worth storing.
+	static bool IsCacheable(const String& value);
+
+	/// Looks up a previously parsed declaration, and sets its properties on the dictionary if found.
+	/// @return True if the declaration was found in the cache.
+	bool Find(const PropertyParseCacheKey& key, PropertyDictionary& dictionary);
+	/// Stores the properties of a successfully parsed declaration.
+	/// @param[in] properties The properties set by the declaration only.
+	void Insert(PropertyParseCacheKey&& key, const PropertyDictionary& properties);
+
+	/// Removes all cached declarations, required whenever property definitions change.
+	void Clear();
+
+	PropertyParseCacheStatistics GetStatistics() const;
+
+private:
+	using PropertyList = std::vector< std::pair<PropertyId, Property> >;
+
+	static Property CopyProperty(const Property& property);
+
+	mutable std::mutex mutex;
+
+	UnorderedMap< PropertyParseCacheKey, PropertyList > declarations;
+
+	PropertyParseCacheStatistics statistics;
+};
+
+}
+}
+
+#endif
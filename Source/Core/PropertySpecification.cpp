@@ -32,6 +32,7 @@
 #include "../../Include/RmlUi/Core/PropertyDefinition.h"
 #include "../../Include/RmlUi/Core/PropertyDictionary.h"
 #include "PropertyShorthandDefinition.h"
+#include "PropertyParseCache.h"
 #include "IdNameMap.h"
 #include <array>
 #include <limits.h>
@@ -44,7 +45,8 @@ namespace Core {
 PropertySpecification::PropertySpecification(size_t reserve_num_properties, size_t reserve_num_shorthands) : 
 	// Increment reserve numbers by one because the 'invalid' property occupies the first element
 	properties(reserve_num_properties + 1), shorthands(reserve_num_shorthands + 1),
-	property_map(std::make_unique<PropertyIdNameMap>(reserve_num_properties + 1)), shorthand_map(std::make_unique<ShorthandIdNameMap>(reserve_num_shorthands + 1))
+	property_map(std::make_unique<PropertyIdNameMap>(reserve_num_properties + 1)), shorthand_map(std::make_unique<ShorthandIdNameMap>(reserve_num_shorthands + 1)),
+	parse_cache(std::make_unique<PropertyParseCache>())
 {
 }
 
@@ -55,6 +57,8 @@ PropertySpecification::~PropertySpecification()
 // Registers a property with a new definition.
 PropertyDefinition& PropertySpecification::RegisterProperty(const String& property_name, const String& default_value, bool inherited, bool forces_layout, PropertyId id)
 {
+	parse_cache->Clear();
+
 	if (id == PropertyId::Invalid)
 		id = property_map->GetOrCreateId(property_name);
 	else
@@ -129,6 +133,8 @@ const PropertyIdSet& PropertySpecification::GetRegisteredPropertiesForcingLayout
 // Registers a shorthand property definition.
 ShorthandId PropertySpecification::RegisterShorthand(const String& shorthand_name, const String& property_names, ShorthandType type, ShorthandId id)
 {
+	parse_cache->Clear();
+
 	if (id == ShorthandId::Invalid)
 		id = shorthand_map->GetOrCreateId(shorthand_name);
 	else
@@ -226,17 +232,42 @@ const ShorthandDefinition* PropertySpecification::GetShorthand(const String& sho
 
 bool PropertySpecification::ParsePropertyDeclaration(PropertyDictionary& dictionary, const String& property_name, const String& property_value) const
 {
-	// Try as a property first
+	// Try as a property first, then as a shorthand
 	PropertyId property_id = property_map->GetId(property_name);
-	if (property_id != PropertyId::Invalid)
-		return ParsePropertyDeclaration(dictionary, property_id, property_value);
+	ShorthandId shorthand_id = ShorthandId::Invalid;
+	if (property_id == PropertyId::Invalid)
+	{
+		shorthand_id = shorthand_map->GetId(property_name);
+		if (shorthand_id == ShorthandId::Invalid)
+			return false;
+	}
 
-	// Then, as a shorthand
-	ShorthandId shorthand_id = shorthand_map->GetId(property_name);
-	if (shorthand_id != ShorthandId::Invalid)
+	if (!PropertyParseCache::IsCacheable(property_value))
+	{
+		if (property_id != PropertyId::Invalid)
+			return ParsePropertyDeclaration(dictionary, property_id, property_value);
 		return ParseShorthandDeclaration(dictionary, shorthand_id, property_value);
+	}
+
+	PropertyParseCacheKey key = (property_id != PropertyId::Invalid ? PropertyParseCache::CreateKey(property_id, property_value) : PropertyParseCache::CreateKey(shorthand_id, property_value));
+	if (parse_cache->Find(key, dictionary))
+		return true;
 
-	return false;
+	// Parse into a separate dictionary so that only the properties of this declaration are cached.
+	PropertyDictionary declaration;
+	bool result;
+	if (property_id != PropertyId::Invalid)
+		result = ParsePropertyDeclaration(declaration, property_id, property_value);
+	else
+		result = ParseShorthandDeclaration(declaration, shorthand_id, property_value);
+
+	for (const auto& id_property : declaration.GetProperties())
+		dictionary.SetProperty(id_property.first, id_property.second);
+
+	if (result)
+		parse_cache->Insert(std::move(key), declaration);
+
+	return result;
 }
 
 bool PropertySpecification::ParsePropertyDeclaration(PropertyDictionary& dictionary, PropertyId property_id, const String& property_value) const
@@ -403,6 +434,11 @@ void PropertySpecification::SetPropertyDefaults(PropertyDictionary& dictionary)
 	}
 }
 
+PropertyParseCacheStatistics PropertySpecification::GetParseCacheStatistics() const
+{
+	return parse_cache->GetStatistics();
+}
+
 String PropertySpecification::PropertiesToString(const PropertyDictionary& dictionary) const
 {
 	String result;
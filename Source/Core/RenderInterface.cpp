@@ -27,6 +27,7 @@
  */
 
 #include "../../Include/RmlUi/Core/RenderInterface.h"
+#include "GeometryArena.h"
 #include "TextureDatabase.h"
 
 namespace Rml {
@@ -40,6 +41,7 @@ RenderInterface::RenderInterface()
 RenderInterface::~RenderInterface()
 {
 	TextureDatabase::ReleaseTextures(this);
+	GeometryArena::RemoveRenderInterface(this);
 }
 
 // Called by RmlUi when it wants to compile geometry it believes will be static for the forseeable future.
@@ -58,6 +60,27 @@ void RenderInterface::ReleaseCompiledGeometry(CompiledGeometryHandle /*geometry*
 {
 }
 
+// Called by RmlUi when it wants to create a geometry page shared by many geometries.
+GeometryPageHandle RenderInterface::CreateGeometryPage(int /*max_vertices*/, int /*max_indices*/)
+{
+	return 0;
+}
+
+// Called by RmlUi when ranges of a geometry page have changed.
+void RenderInterface::UpdateGeometryPage(GeometryPageHandle /*page*/, Vertex* /*vertices*/, int /*vertex_offset*/, int /*num_vertices*/, int* /*indices*/, int /*index_offset*/, int /*num_indices*/)
+{
+}
+
+// Called by RmlUi when it wants to render geometry stored in a geometry page.
+void RenderInterface::RenderGeometryPage(GeometryPageHandle /*page*/, int /*vertex_offset*/, int /*num_vertices*/, int /*index_offset*/, int /*num_indices*/, TextureHandle /*texture*/, const Vector2f& /*translation*/)
+{
+}
+
+// Called by RmlUi when it wants to release a geometry page.
+void RenderInterface::ReleaseGeometryPage(GeometryPageHandle /*page*/)
+{
+}
+
 // Called by RmlUi when a texture is required by the library.
 bool RenderInterface::LoadTexture(TextureHandle& /*texture_handle*/, Vector2i& /*texture_dimensions*/, const String& /*source*/)
 {
@@ -75,6 +98,22 @@ void RenderInterface::ReleaseTexture(TextureHandle /*texture*/)
 {
 }
 
+// Called by RmlUi when it wants to cache the rendering of an element in a texture.
+bool RenderInterface::GenerateRenderTexture(TextureHandle& /*texture_handle*/, const Vector2i& /*dimensions*/)
+{
+	return false;
+}
+
+// Called by RmlUi when it wants to redirect rendering into a texture.
+void RenderInterface::PushRenderTexture(TextureHandle /*texture_handle*/, const Vector2i& /*origin*/)
+{
+}
+
+// Called by RmlUi when it is done rendering into a texture.
+void RenderInterface::PopRenderTexture()
+{
+}
+
 // Called by RmlUi when it wants to change the current transform matrix to a new matrix.
 void RenderInterface::SetTransform(const Matrix4f* /*transform*/)
 {
@@ -235,6 +235,11 @@ const PropertySpecification& StyleSheetSpecification::GetPropertySpecification()
 	return instance->properties;
 }
 
+PropertyParseCacheStatistics StyleSheetSpecification::GetPropertyParseCacheStatistics()
+{
+	return instance->properties.GetParseCacheStatistics();
+}
+
 // Registers RmlUi's default parsers.
 void StyleSheetSpecification::RegisterDefaultParsers()
 {
@@ -377,6 +382,7 @@ void StyleSheetSpecification::RegisterDefaultProperties()
 	RegisterProperty(PropertyId::Focus, "focus", "auto", true, false).AddParser("keyword", "none, auto");
 	RegisterProperty(PropertyId::ScrollbarMargin, "scrollbar-margin", "0", false, false).AddParser("length");
 	RegisterProperty(PropertyId::PointerEvents, "pointer-events", "auto", true, false).AddParser("keyword", "none, auto");
+	RegisterProperty(PropertyId::RenderCache, "render-cache", "none", false, false).AddParser("keyword", "none, layer");
 
 	// Perspective and Transform specifications
 	RegisterProperty(PropertyId::Perspective, "perspective", "none", false, false).AddParser("keyword", "none").AddParser("length");
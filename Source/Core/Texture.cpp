@@ -39,10 +39,10 @@ void Texture::Set(const String& source, const String& source_path)
 	resource = TextureDatabase::Fetch(source, source_path);
 }
 
-void Texture::Set(const String& name, const TextureCallback& callback)
+void Texture::Set(const String& name, const TextureCallback& callback, MemoryCategory category)
 {
 	resource = std::make_shared<TextureResource>();
-	resource->Set(name, callback);
+	resource->Set(name, callback, category);
 }
 
 // Returns the texture's source name. This is usually the name of the file the texture was loaded from.
@@ -83,5 +83,11 @@ Texture::operator bool() const
 	return static_cast<bool>(resource);
 }
 
+// Returns the number of textures currently loaded.
+int Texture::GetNumLoadedTextures()
+{
+	return TextureResource::GetNumLoadedTextures();
+}
+
 }
 }
@@ -27,15 +27,25 @@
  */
 
 #include "TextureResource.h"
+#include "ContextStatistics.h"
 #include "TextureDatabase.h"
 #include "../../Include/RmlUi/Core/Log.h"
+#include "../../Include/RmlUi/Core/MemoryStatistics.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 
 namespace Rml {
 namespace Core {
 
-TextureResource::TextureResource()
+static int num_loaded_textures = 0;
+
+// Estimates the memory used by a loaded texture, assuming four bytes per pixel.
+static size_t GetTextureMemory(const Vector2i& dimensions)
+{
+	return size_t(dimensions.x) * size_t(dimensions.y) * 4;
+}
+
+TextureResource::TextureResource() : category(MemoryCategory::Textures)
 {
 }
 
@@ -48,12 +58,14 @@ void TextureResource::Set(const String& _source)
 {
 	Reset();
 	source = _source;
+	category = MemoryCategory::Textures;
 }
 
-void TextureResource::Set(const String& name, const TextureCallback& callback)
+void TextureResource::Set(const String& name, const TextureCallback& callback, MemoryCategory _category)
 {
 	Reset();
 	source = name;
+	category = _category;
 	texture_callback = std::make_unique<TextureCallback>(callback);
 	TextureDatabase::AddCallbackTexture(this);
 }
@@ -112,7 +124,11 @@ void TextureResource::Release(RenderInterface* render_interface)
 		{
 			TextureHandle handle = interface_data_pair.second.first;
 			if (handle)
+			{
 				interface_data_pair.first->ReleaseTexture(handle);
+				num_loaded_textures -= 1;
+				Memory::TrackDeallocation(category, GetTextureMemory(interface_data_pair.second.second));
+			}
 		}
 
 		texture_data.clear();
@@ -125,7 +141,11 @@ void TextureResource::Release(RenderInterface* render_interface)
 
 		TextureHandle handle = texture_iterator->second.first;
 		if (handle)
+		{
 			texture_iterator->first->ReleaseTexture(handle);
+			num_loaded_textures -= 1;
+			Memory::TrackDeallocation(category, GetTextureMemory(texture_iterator->second.second));
+		}
 
 		texture_data.erase(render_interface);
 	}
@@ -153,10 +173,16 @@ bool TextureResource::Load(RenderInterface* render_interface)
 
 		TextureHandle handle;
 		bool success = render_interface->GenerateTexture(handle, data.get(), dimensions);
+		RMLUI_STATISTICS_COUNT(num_texture_uploads, 1);
 
 		if (success)
 		{
 			texture_data[render_interface] = TextureData(handle, dimensions);
+			if (handle)
+			{
+				num_loaded_textures += 1;
+				Memory::TrackAllocation(category, GetTextureMemory(dimensions));
+			}
 		}
 		else
 		{
@@ -170,6 +196,7 @@ bool TextureResource::Load(RenderInterface* render_interface)
 	// No callback function, load the texture through the render interface.
 	TextureHandle handle;
 	Vector2i dimensions;
+	RMLUI_STATISTICS_COUNT(num_texture_uploads, 1);
 	if (!render_interface->LoadTexture(handle, dimensions, source))
 	{
 		Log::Message(Log::LT_WARNING, "Failed to load texture from %s.", source.c_str());
@@ -179,8 +206,20 @@ bool TextureResource::Load(RenderInterface* render_interface)
 	}
 
 	texture_data[render_interface] = TextureData(handle, dimensions);
+	if (handle)
+	{
+		num_loaded_textures += 1;
+		Memory::TrackAllocation(category, GetTextureMemory(dimensions));
+	}
+
 	return true;
 }
 
+// Returns the number of textures currently loaded.
+int TextureResource::GetNumLoadedTextures()
+{
+	return num_loaded_textures;
+}
+
 }
 }
@@ -54,7 +54,7 @@ public:
 
 	/// Clear any existing data and set a callback function for loading the data.
 	/// Texture loading is delayed until the texture is accessed by a specific render interface.
-	void Set(const String& name, const TextureCallback& callback);
+	void Set(const String& name, const TextureCallback& callback, MemoryCategory category);
 
 	/// Returns the resource's underlying texture handle.
 	TextureHandle GetHandle(RenderInterface* render_interface);
@@ -67,6 +67,9 @@ public:
 	/// Releases the texture's handle.
 	void Release(RenderInterface* render_interface = nullptr);
 
+	/// Returns the number of textures currently loaded through any render interface.
+	static int GetNumLoadedTextures();
+
 private:
 	void Reset();
 
@@ -80,6 +83,9 @@ private:
 	TextureDataMap texture_data;
 
 	UniquePtr<TextureCallback> texture_callback;
+
+	// The memory category loaded textures are accounted to.
+	MemoryCategory category;
 };
 
 }
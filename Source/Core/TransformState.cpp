@@ -64,6 +64,14 @@ bool TransformState::SetLocalPerspective(const Matrix4f* in_perspective)
 	return is_changed;
 }
 
+void TransformState::SetLocalTransform(const Matrix4f* in_local_transform)
+{
+	if (in_local_transform)
+		local_transform = *in_local_transform;
+
+	have_local_transform = (in_local_transform != nullptr);
+}
+
 const Matrix4f* TransformState::GetTransform() const
 {
 	return have_transform ? &transform : nullptr;
@@ -74,6 +82,11 @@ const Matrix4f* TransformState::GetLocalPerspective() const
 	return have_perspective ? &local_perspective : nullptr;
 }
 
+const Matrix4f* TransformState::GetLocalTransform() const
+{
+	return have_local_transform ? &local_transform : nullptr;
+}
+
 const Matrix4f* TransformState::GetInverseTransform() const
 {
 	if (!have_transform)
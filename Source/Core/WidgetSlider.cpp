@@ -137,7 +137,7 @@ bool WidgetSlider::Initialise(Orientation _orientation)
 }
 
 // Updates the key repeats for the increment / decrement arrows.
-void WidgetSlider::Update()
+bool WidgetSlider::Update()
 {
 	for (int i = 0; i < 2; i++)
 	{
@@ -161,6 +161,8 @@ void WidgetSlider::Update()
 			}
 		}
 	}
+
+	return (arrow_timers[0] > 0 || arrow_timers[1] > 0);
 }
 
 // Sets the position of the bar.
@@ -438,12 +440,14 @@ void WidgetSlider::ProcessEvent(Event& event)
 			arrow_timers[0] = DEFAULT_REPEAT_DELAY;
 			last_update_time = Clock::GetElapsedTime();
 			SetBarPosition(OnLineDecrement());
+			RequestArrowUpdates();
 		}
 		else if (event.GetTargetElement() == arrows[1])
 		{
 			arrow_timers[1] = DEFAULT_REPEAT_DELAY;
 			last_update_time = Clock::GetElapsedTime();
 			SetBarPosition(OnLineIncrement());
+			RequestArrowUpdates();
 		}
 	}
 	else if (event == EventId::Mouseup ||
@@ -456,6 +460,13 @@ void WidgetSlider::ProcessEvent(Event& event)
 	}
 }
 
+// Requests an update of the scrolled element, which updates the key repeats of its scrollbars.
+void WidgetSlider::RequestArrowUpdates()
+{
+	if (Element* scrolled_element = parent->GetParentNode())
+		scrolled_element->RequestUpdate();
+}
+
 void WidgetSlider::PositionBar()
 {
 	const Vector2f& track_dimensions = track->GetBox().GetSize();
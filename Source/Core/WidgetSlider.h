@@ -59,7 +59,8 @@ public:
 	bool Initialise(Orientation orientation);
 
 	/// Updates the key repeats for the increment / decrement arrows.
-	void Update();
+	/// @return True if an arrow is held down, in which case the slider needs to be updated again on the next update.
+	bool Update();
 
 	/// Sets the position of the bar.
 	/// @param[in] bar_position The new position of the bar (0 representing the start of the track, 1 representing the end).
@@ -118,6 +119,8 @@ protected:
 
 private:
 	void PositionBar();
+	/// Requests an update of the scrolled element while an arrow is held down.
+	void RequestArrowUpdates();
 
 	Element* parent;
 
@@ -109,6 +109,7 @@ static bool TestPrettyFormat(Core::String original, Core::String should_be)
 
 ElementInfo::ElementInfo(const Core::String& tag) : Core::ElementDocument(tag)
 {
+	SetUpdateEveryFrame(true);
 	hover_element = nullptr;
 	source_element = nullptr;
 	enable_element_select = true;
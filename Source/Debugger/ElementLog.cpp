@@ -41,6 +41,7 @@ const int MAX_LOG_MESSAGES = 50;
 
 ElementLog::ElementLog(const Core::String& tag) : Core::ElementDocument(tag)
 {
+	SetUpdateEveryFrame(true);
 	dirty_logs = false;
 	beacon = nullptr;
 	current_beacon_level = Core::Log::LT_MAX;
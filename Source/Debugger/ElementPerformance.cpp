@@ -0,0 +1,389 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "ElementPerformance.h"
+#include "CommonSource.h"
+#include "Geometry.h"
+#include "PerformanceSource.h"
+#include "../../Include/RmlUi/Core/Context.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/ElementUtilities.h"
+#include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/FontEngineInterface.h"
+#include "../../Include/RmlUi/Core/Geometry.h"
+#include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "../../Include/RmlUi/Core/Texture.h"
+
+namespace Rml {
+namespace Debugger {
+
+// Time between each refresh of the shown values, in seconds.
+static constexpr double update_interval = 0.25;
+// Time an element is flashed after it was laid out or regenerated, in seconds.
+static constexpr float flash_duration = 0.5f;
+
+static const char* frame_labels[] = {
+	"Update", "Update: style", "Update: layout", "Render", "Input events", "Document loading"
+};
+static const char* counter_labels[] = {
+	"Elements updated", "Definitions resolved", "Properties computed", "Layouts formatted", "Elements formatted",
+	"Geometry regenerated", "Draw calls", "Elements culled", "Texture uploads", "Glyphs rasterized", "Text runs shaped",
+	"Events dispatched",
+	"Geometry in use", "Textures loaded"
+};
+static constexpr int num_frame_values = sizeof(frame_labels) / sizeof(frame_labels[0]);
+static constexpr int num_counter_values = sizeof(counter_labels) / sizeof(counter_labels[0]);
+
+static Core::String FormatTime(float seconds)
+{
+	return Core::CreateString(32, "%.2f", seconds * 1000.f);
+}
+
+static Core::String FormatCount(int count)
+{
+	return Core::CreateString(32, "%d", count);
+}
+
+ElementPerformance::ElementPerformance(const Core::String& tag) : Core::ElementDocument(tag)
+{
+	SetUpdateEveryFrame(true);
+	debug_context = nullptr;
+	statistics_enabled = false;
+	flash_enabled = false;
+	previous_update_time = 0.0;
+}
+
+ElementPerformance::~ElementPerformance()
+{
+}
+
+// Initialises the performance element.
+bool ElementPerformance::Initialise()
+{
+	SetInnerRML(performance_rml);
+	SetId("rmlui-debug-performance");
+
+	AddEventListener(Core::EventId::Click, this);
+
+	Core::SharedPtr<Core::StyleSheet> style_sheet = Core::Factory::InstanceStyleSheetString(Core::String(common_rcss) + Core::String(performance_rcss));
+	if (!style_sheet)
+		return false;
+
+	SetStyleSheet(std::move(style_sheet));
+
+	// The rows of the fixed sections are generated once, only their values are changed afterwards.
+	Core::Element* frame_element = GetElementById("frame");
+	Core::Element* counters_element = GetElementById("counters");
+	documents_table.element = GetElementById("documents");
+	fonts_table.element = GetElementById("fonts");
+	if (!frame_element || !counters_element || !documents_table.element || !fonts_table.element)
+		return false;
+
+	documents_table.header_rml = "<div class=\"row header\"><span class=\"name\">Document</span><span class=\"cell\">Elements</span>"
+		"<span class=\"cell\">Style</span><span class=\"cell\">Layout</span><span class=\"cell\">Render</span><span class=\"cell\">Events</span></div>";
+	documents_table.num_columns = 5;
+
+	fonts_table.header_rml = "<div class=\"row header\"><span class=\"name\">Font face</span><span class=\"cell\">Glyphs</span>"
+		"<span class=\"cell\">Layers</span><span class=\"cell\">Textures</span><span class=\"cell\">Used</span></div>";
+	fonts_table.num_columns = 4;
+
+	UpdateTable(documents_table, Core::StringList(), Core::StringList());
+	UpdateTable(fonts_table, Core::StringList(), Core::StringList());
+
+	Core::String frame_rml, counters_rml;
+	for (int i = 0; i < num_frame_values; i++)
+		frame_rml += Core::CreateString(128, "<div class=\"row\"><span class=\"value\" id=\"value-%d\"></span>%s</div>", i, frame_labels[i]);
+	for (int i = 0; i < num_counter_values; i++)
+		counters_rml += Core::CreateString(128, "<div class=\"row\"><span class=\"value\" id=\"value-%d\"></span>%s</div>", num_frame_values + i, counter_labels[i]);
+
+	frame_element->SetInnerRML(frame_rml);
+	counters_element->SetInnerRML(counters_rml);
+
+	values.resize(num_frame_values + num_counter_values);
+	for (int i = 0; i < (int)values.size(); i++)
+	{
+		values[i].element = GetElementById(Core::CreateString(32, "value-%d", i));
+		if (!values[i].element)
+			return false;
+	}
+
+	return true;
+}
+
+// Sets the context to show the statistics of.
+void ElementPerformance::SetDebugContext(Core::Context* context)
+{
+	if (statistics_enabled)
+		EnableStatistics(false);
+
+	debug_context = context;
+}
+
+// Renders the flashes of recently laid out and regenerated elements.
+void ElementPerformance::RenderFlashElements()
+{
+	if (!debug_context || !statistics_enabled || !flash_enabled)
+		return;
+
+	const double time = Core::GetSystemInterface()->GetElapsedTime();
+
+	const Core::ContextStatistics& statistics = debug_context->GetStatistics();
+	AddFlashElements(statistics.formatted_elements, false, time);
+	AddFlashElements(statistics.regenerated_elements, true, time);
+
+	for (auto it = flash_elements.begin(); it != flash_elements.end();)
+	{
+		Core::Element* element = it->second.element.get();
+		const float age = float(time - it->second.time);
+
+		if (!element || age > flash_duration)
+		{
+			it = flash_elements.erase(it);
+			continue;
+		}
+
+		if (element->IsVisible())
+		{
+			const Core::byte alpha = Core::byte(96.f * (1.f - age / flash_duration));
+			const Core::Colourb colour = (it->second.regenerated ? Core::Colourb(255, 0, 255, alpha) : Core::Colourb(0, 160, 255, alpha));
+
+			Core::ElementUtilities::ApplyTransform(*element);
+			for (int i = 0; i < element->GetNumBoxes(); i++)
+			{
+				const Core::Box& box = element->GetBox(i);
+				Geometry::RenderBox(element->GetAbsoluteOffset(Core::Box::BORDER) + box.GetPosition(Core::Box::BORDER), box.GetSize(Core::Box::BORDER), colour);
+			}
+		}
+
+		++it;
+	}
+}
+
+void ElementPerformance::OnUpdate()
+{
+	Core::ElementDocument::OnUpdate();
+
+	if (!debug_context)
+		return;
+
+	// Statistics are only gathered while the panel is shown.
+	const bool visible = IsVisible();
+	if (visible != statistics_enabled)
+		EnableStatistics(visible);
+
+	if (!visible)
+		return;
+
+	const double time = Core::GetSystemInterface()->GetElapsedTime();
+	if (time - previous_update_time >= update_interval)
+	{
+		previous_update_time = time;
+		UpdateValues();
+	}
+}
+
+void ElementPerformance::ProcessEvent(Core::Event& event)
+{
+	if (event == Core::EventId::Click)
+	{
+		Core::Element* target_element = event.GetTargetElement();
+
+		if (target_element->GetId() == "close_button")
+		{
+			SetProperty(Core::PropertyId::Visibility, Core::Property(Core::Style::Visibility::Hidden));
+		}
+		else if (target_element->GetId() == "flash_button")
+		{
+			flash_enabled = !flash_enabled;
+			target_element->SetClass("active", flash_enabled);
+
+			if (statistics_enabled)
+				EnableStatistics(true);
+		}
+	}
+}
+
+// Enables or disables the statistics of the debug context.
+void ElementPerformance::EnableStatistics(bool enable)
+{
+	if (debug_context)
+		debug_context->EnableStatistics(enable, enable && flash_enabled);
+
+	statistics_enabled = enable;
+	previous_update_time = 0.0;
+	flash_elements.clear();
+}
+
+// Updates all the shown values from the statistics.
+void ElementPerformance::UpdateValues()
+{
+	const Core::ContextStatistics& statistics = debug_context->GetStatistics();
+
+	const Core::String new_values[] = {
+		FormatTime(statistics.update_time),
+		FormatTime(statistics.style_time),
+		FormatTime(statistics.layout_time),
+		FormatTime(statistics.render_time),
+		FormatTime(statistics.event_time),
+		FormatTime(statistics.document_load_time),
+		FormatCount(statistics.num_elements_updated),
+		FormatCount(statistics.num_definitions_resolved),
+		FormatCount(statistics.num_properties_computed),
+		FormatCount(statistics.num_layouts_formatted),
+		FormatCount(statistics.num_elements_formatted),
+		FormatCount(statistics.num_geometry_regenerated),
+		FormatCount(statistics.num_draw_calls),
+		FormatCount(statistics.num_elements_culled),
+		FormatCount(statistics.num_texture_uploads),
+		FormatCount(statistics.num_glyphs_rasterized),
+		FormatCount(statistics.num_text_runs_shaped),
+		FormatCount(statistics.num_events_dispatched),
+		FormatCount(Core::Geometry::GetStatistics().num_geometry),
+		FormatCount(Core::Texture::GetNumLoadedTextures())
+	};
+	static_assert(sizeof(new_values) / sizeof(new_values[0]) == num_frame_values + num_counter_values, "Each value needs a label.");
+
+	for (size_t i = 0; i < values.size(); i++)
+		SetContents(values[i].element, values[i].contents, new_values[i]);
+
+	Core::StringList names, cells;
+
+	for (int i = 0; i < debug_context->GetNumDocuments(); i++)
+	{
+		Core::ElementDocument* document = debug_context->GetDocument(i);
+		if (IsDebuggerElement(document))
+			continue;
+
+		Core::String name = document->GetId();
+		if (name.empty())
+			name = document->GetTitle();
+		if (name.empty())
+			name = Core::CreateString(32, "#%d", i);
+
+		const Core::DocumentStatistics& document_statistics = document->GetStatistics();
+
+		names.push_back(name);
+		cells.push_back(FormatCount(document_statistics.num_elements));
+		cells.push_back(FormatTime(document_statistics.style_time));
+		cells.push_back(FormatTime(document_statistics.layout_time));
+		cells.push_back(FormatTime(document_statistics.render_time));
+		cells.push_back(FormatTime(document_statistics.event_time));
+	}
+
+	UpdateTable(documents_table, names, cells);
+
+	std::vector<Core::FontFaceStatistics> font_statistics;
+	if (Core::FontEngineInterface* font_interface = Core::GetFontEngineInterface())
+		font_interface->GetFontFaceStatistics(font_statistics);
+
+	names.clear();
+	cells.clear();
+
+	for (const Core::FontFaceStatistics& font : font_statistics)
+	{
+		if (font.family == "rmlui-debugger-font")
+			continue;
+
+		const int used_percentage = (font.texture_area > 0 ? (100 * font.used_texture_area) / font.texture_area : 0);
+
+		names.push_back(font.family + Core::CreateString(64, " %d%s%s", font.size,
+			font.weight == Core::Style::FontWeight::Bold ? " bold" : "", font.style == Core::Style::FontStyle::Italic ? " italic" : ""));
+		cells.push_back(FormatCount(font.num_glyphs));
+		cells.push_back(FormatCount(font.num_layers));
+		cells.push_back(FormatCount(font.num_textures));
+		cells.push_back(Core::CreateString(32, "%d%%", used_percentage));
+	}
+
+	UpdateTable(fonts_table, names, cells);
+}
+
+// Sets the contents of an element, if changed.
+void ElementPerformance::SetContents(Core::Element* element, Core::String& contents, const Core::String& new_contents)
+{
+	if (contents != new_contents)
+	{
+		contents = new_contents;
+		element->SetInnerRML(contents);
+	}
+}
+
+// Shows the given rows in the table, regenerating the rows only if their names changed.
+void ElementPerformance::UpdateTable(Table& table, const Core::StringList& names, const Core::StringList& cells)
+{
+	if (table.element->GetNumChildren() == 0 || names != table.names)
+	{
+		table.names = names;
+
+		Core::String rml = table.header_rml;
+		for (const Core::String& name : names)
+		{
+			rml += "<div class=\"row\"><span class=\"name\">" + Core::StringUtilities::EncodeRml(name) + "</span>";
+			for (int i = 0; i < table.num_columns; i++)
+				rml += "<span class=\"cell\"></span>";
+			rml += "</div>";
+		}
+
+		table.element->SetInnerRML(rml);
+
+		// Keep the cells of each row after the header, skipping the name of the row.
+		table.cells.clear();
+		for (int i = 1; i < table.element->GetNumChildren(); i++)
+		{
+			Core::Element* row = table.element->GetChild(i);
+			for (int j = 1; j < row->GetNumChildren(); j++)
+				table.cells.push_back(Value{ row->GetChild(j), Core::String() });
+		}
+	}
+
+	for (size_t i = 0; i < table.cells.size() && i < cells.size(); i++)
+		SetContents(table.cells[i].element, table.cells[i].contents, cells[i]);
+}
+
+void ElementPerformance::AddFlashElements(const std::vector< Core::ObserverPtr<Core::Element> >& elements, bool regenerated, double time)
+{
+	for (const Core::ObserverPtr<Core::Element>& observer : elements)
+	{
+		Core::Element* element = observer.get();
+		if (!element || IsDebuggerElement(element))
+			continue;
+
+		FlashElement& flash_element = flash_elements[element];
+		flash_element.element = observer;
+		flash_element.time = time;
+		flash_element.regenerated = regenerated;
+	}
+}
+
+bool ElementPerformance::IsDebuggerElement(Core::Element* element) const
+{
+	Core::ElementDocument* document = element->GetOwnerDocument();
+	return !document || document->GetId().find("rmlui-debug-") == 0;
+}
+
+}
+}
@@ -0,0 +1,118 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUIDEBUGGERELEMENTPERFORMANCE_H
+#define RMLUIDEBUGGERELEMENTPERFORMANCE_H
+
+#include "../../Include/RmlUi/Core/ElementDocument.h"
+#include "../../Include/RmlUi/Core/EventListener.h"
+
+namespace Rml {
+namespace Debugger {
+
+/**
+	Shows the frame statistics of the debugged context, and flashes the elements which were laid out or had their
+	geometry regenerated. The statistics of the context are only enabled while the panel is visible.
+ */
+
+class ElementPerformance : public Core::ElementDocument, public Core::EventListener
+{
+public:
+	RMLUI_RTTI_DefineWithParent(ElementPerformance, Core::ElementDocument)
+
+	ElementPerformance(const Core::String& tag);
+	~ElementPerformance();
+
+	/// Initialises the performance element.
+	/// @return True if the element initialised successfully, false otherwise.
+	bool Initialise();
+
+	/// Sets the context to show the statistics of.
+	void SetDebugContext(Core::Context* context);
+
+	/// Renders the flashes of recently laid out and regenerated elements.
+	void RenderFlashElements();
+
+protected:
+	void OnUpdate() override;
+	void ProcessEvent(Core::Event& event) override;
+
+private:
+	// Enables or disables the statistics of the debug context.
+	void EnableStatistics(bool enable);
+
+	// Updates all the shown values from the statistics.
+	void UpdateValues();
+	// Sets the contents of an element, if changed.
+	void SetContents(Core::Element* element, Core::String& contents, const Core::String& new_contents);
+
+	struct Table;
+	// Shows the given rows in the table, with the cells of all rows in order. The rows are only regenerated when their
+	// names change, otherwise only the cells with changed values are set.
+	void UpdateTable(Table& table, const Core::StringList& names, const Core::StringList& cells);
+
+	void AddFlashElements(const std::vector< Core::ObserverPtr<Core::Element> >& elements, bool regenerated, double time);
+
+	bool IsDebuggerElement(Core::Element* element) const;
+
+	Core::Context* debug_context;
+	bool statistics_enabled;
+	bool flash_enabled;
+
+	double previous_update_time;
+
+	// The value elements of the frame and counter sections, with their current contents.
+	struct Value {
+		Core::Element* element;
+		Core::String contents;
+	};
+	std::vector< Value > values;
+
+	// The document and font sections, with a row for each document or font face.
+	struct Table {
+		Core::Element* element = nullptr;
+		Core::String header_rml;
+		int num_columns = 0;
+		Core::StringList names;
+		std::vector< Value > cells;
+	};
+	Table documents_table, fonts_table;
+
+	struct FlashElement {
+		Core::ObserverPtr<Core::Element> element;
+		double time;
+		bool regenerated;
+	};
+	using FlashElementMap = Core::UnorderedMap< Core::Element*, FlashElement >;
+	FlashElementMap flash_elements;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,122 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+static const char* performance_rcss = R"RCSS(
+body
+{
+	width: 380dp;
+	min-width: 300dp;
+	min-height: 150dp;
+	top: 42dp;
+	left: 440dp;
+}
+div#content
+{
+	height: auto;
+	max-height: 650dp;
+}
+div#tools
+{
+	float: right;
+}
+div.button
+{
+	display: inline-block;
+	width: 70dp;
+	font-size: 13dp;
+	line-height: 20dp;
+	text-align: center;
+	border-width: 1px;
+	border-color: #666;
+	background-color: #aaa;
+	color: #111;
+}
+div.button:hover
+{
+	border-color: #ddd;
+}
+div.button.active
+{
+	background-color: #ddd;
+}
+div#content h2
+{
+	padding-left: 5dp;
+}
+div#content div.section
+{
+	font-size: 12dp;
+	padding: 2dp 10dp;
+}
+div.row
+{
+	height: 1.4em;
+}
+div.row span.value
+{
+	float: right;
+}
+div.row span.cell
+{
+	display: inline-block;
+	width: 11%;
+	text-align: right;
+}
+div.row span.name
+{
+	display: inline-block;
+	width: 40%;
+	color: #610;
+}
+div.header span.cell
+{
+	color: #888;
+}
+)RCSS";
+
+static const char* performance_rml = R"RML(
+<h1>
+	<handle id="position_handle" move_target="#document"/>
+	<div id="close_button">X</div>
+	<div id="tools">
+		<div id="flash_button" class="button">Flash</div>
+	</div>
+	<div style="width: 100dp;">Performance</div>
+</h1>
+<div id="content">
+	<h2>Frame (ms)</h2>
+	<div class="section" id="frame"></div>
+	<h2>Counters</h2>
+	<div class="section" id="counters"></div>
+	<h2>Documents (ms)</h2>
+	<div class="section" id="documents"></div>
+	<h2>Font atlases</h2>
+	<div class="section" id="fonts"></div>
+</div>
+<handle id="size_handle" size_target="#document" />
+)RML";
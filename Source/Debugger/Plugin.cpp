@@ -36,6 +36,7 @@
 #include "ElementContextHook.h"
 #include "ElementInfo.h"
 #include "ElementLog.h"
+#include "ElementPerformance.h"
 #include "FontSource.h"
 #include "Geometry.h"
 #include "MenuSource.h"
@@ -58,6 +59,7 @@ Plugin::Plugin()
 	menu_element = nullptr;
 	info_element = nullptr;
 	log_element = nullptr;
+	performance_element = nullptr;
 	hook_element = nullptr;
 
 	render_outlines = false;
@@ -84,7 +86,8 @@ bool Plugin::Initialise(Core::Context* context)
 
 	if (!LoadMenuElement() ||
 		!LoadInfoElement() ||
-		!LoadLogElement())
+		!LoadLogElement() ||
+		!LoadPerformanceElement())
 	{
 		Core::Log::Message(Core::Log::LT_ERROR, "Failed to initialise debugger, error while load debugger elements.");
 		return false;
@@ -142,6 +145,9 @@ bool Plugin::SetContext(Core::Context* context)
 		info_element->Reset();
 	}
 
+	if (performance_element)
+		performance_element->SetDebugContext(context);
+
 	debug_context = context;
 	return true;
 }
@@ -207,6 +213,10 @@ void Plugin::Render()
 		info_element->RenderHoverElement();
 		info_element->RenderSourceElement();
 	}
+
+	// Flash the elements which were recently laid out or regenerated.
+	if (performance_element && performance_element->IsVisible())
+		performance_element->RenderFlashElements();
 }
 
 // Called when RmlUi shuts down.
@@ -271,6 +281,13 @@ void Plugin::ProcessEvent(Core::Event& event)
 		{
 			render_outlines = !render_outlines;
 		}
+		else if (event.GetTargetElement()->GetId() == "performance-button")
+		{
+			if (performance_element->IsVisible())
+				performance_element->SetProperty(Core::PropertyId::Visibility, Core::Property(Core::Style::Visibility::Hidden));
+			else
+				performance_element->SetProperty(Core::PropertyId::Visibility, Core::Property(Core::Style::Visibility::Visible));
+		}
 	}
 }
 
@@ -320,6 +337,9 @@ bool Plugin::LoadMenuElement()
 	Core::Element* outlines_button = menu_element->GetElementById("outlines-button");
 	outlines_button->AddEventListener(Rml::Core::EventId::Click, this);
 
+	Core::Element* performance_button = menu_element->GetElementById("performance-button");
+	performance_button->AddEventListener(Rml::Core::EventId::Click, this);
+
 	return true;
 }
 
@@ -370,6 +390,27 @@ bool Plugin::LoadLogElement()
 	return true;
 }
 
+bool Plugin::LoadPerformanceElement()
+{
+	performance_element_instancer = std::make_unique< Core::ElementInstancerGeneric<ElementPerformance> >();
+	Core::Factory::RegisterElementInstancer("debug-performance", performance_element_instancer.get());
+	performance_element = rmlui_dynamic_cast< ElementPerformance* >(host_context->CreateDocument("debug-performance"));
+	if (!performance_element)
+		return false;
+
+	performance_element->SetProperty(Core::PropertyId::Visibility, Core::Property(Core::Style::Visibility::Hidden));
+
+	if (!performance_element->Initialise())
+	{
+		host_context->UnloadDocument(performance_element);
+		performance_element = nullptr;
+
+		return false;
+	}
+
+	return true;
+}
+
 void Plugin::ReleaseElements()
 {
 	if (host_context)
@@ -394,6 +435,13 @@ void Plugin::ReleaseElements()
 			application_interface = nullptr;
 			log_interface.reset();
 		}
+
+		if (performance_element)
+		{
+			performance_element->SetDebugContext(nullptr);
+			host_context->UnloadDocument(performance_element);
+			performance_element = nullptr;
+		}
 	}
 
 	if (debug_context)
@@ -43,6 +43,7 @@ class SystemInterface;
 namespace Debugger {
 
 class ElementLog;
+class ElementPerformance;
 class ElementInfo;
 class ElementContextHook;
 class SystemInterface;
@@ -103,6 +104,7 @@ private:
 	bool LoadMenuElement();
 	bool LoadInfoElement();
 	bool LoadLogElement();
+	bool LoadPerformanceElement();
 
 	// Release all loaded elements
 	void ReleaseElements();
@@ -116,12 +118,13 @@ private:
 	Core::ElementDocument* menu_element;
 	ElementInfo* info_element;
 	ElementLog* log_element;
+	ElementPerformance* performance_element;
 	ElementContextHook* hook_element;
 
 	Core::SystemInterface* application_interface;
 	std::unique_ptr<SystemInterface> log_interface;
 
-	std::unique_ptr<Core::ElementInstancer> hook_element_instancer, info_element_instancer, log_element_instancer;
+	std::unique_ptr<Core::ElementInstancer> hook_element_instancer, info_element_instancer, log_element_instancer, performance_element_instancer;
 
 	bool render_outlines;
 